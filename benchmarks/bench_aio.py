@@ -0,0 +1,132 @@
+"""Timer scheduling and priority queue throughput against asyncio's own.
+
+The timer workload keeps a million timers pending, like a server with a
+timeout per connection: it schedules them, cancels a tenth (connections that
+answered in time), then advances the clock in steps and fires whatever
+expired. The asyncio side is what BaseEventLoop does: TimerHandles in a
+heapq, cancelled handles left in place until they reach the top.
+
+The queue workload moves items through asyncio.PriorityQueue and
+pydatastructs.aio.PriorityQueue, once without waiting and once between a
+producer and consumer tasks that wait on each other.
+
+    python benchmarks/bench_aio.py --timers 1000000
+"""
+
+import argparse
+import asyncio
+import heapq
+import random
+import sys
+import time
+
+from pydatastructs.aio import PriorityQueue, TimerHeap
+
+
+def noop():
+    pass
+
+
+def timers_heapq(deadlines, cancelled, steps, loop):
+    scheduled = []
+    handles = []
+    start = time.perf_counter()
+    for when in deadlines:
+        handle = asyncio.TimerHandle(when, noop, (), loop)
+        heapq.heappush(scheduled, handle)
+        handles.append(handle)
+    scheduled_at = time.perf_counter()
+    for i in cancelled:
+        handles[i].cancel()
+    cancelled_at = time.perf_counter()
+    fired = 0
+    for now in steps:
+        while scheduled and scheduled[0]._when <= now:
+            handle = heapq.heappop(scheduled)
+            if not handle._cancelled:
+                fired += 1
+    return scheduled_at - start, cancelled_at - scheduled_at, time.perf_counter() - cancelled_at, fired
+
+
+def timers_native(deadlines, cancelled, steps, loop):
+    timers = TimerHeap()
+    schedule = timers.schedule
+    start = time.perf_counter()
+    handles = [schedule(when, noop) for when in deadlines]
+    scheduled_at = time.perf_counter()
+    cancel = timers.cancel
+    for i in cancelled:
+        cancel(handles[i])
+    cancelled_at = time.perf_counter()
+    fired = 0
+    for now in steps:
+        fired += len(timers.pop_expired(now))
+    return scheduled_at - start, cancelled_at - scheduled_at, time.perf_counter() - cancelled_at, fired
+
+
+async def queue_nowait(cls, items):
+    queue = cls()
+    put, get = queue.put_nowait, queue.get_nowait
+    start = time.perf_counter()
+    for item in items:
+        put(item)
+    for _ in items:
+        get()
+    return time.perf_counter() - start
+
+
+async def queue_tasks(cls, items, consumers=4):
+    queue = cls(maxsize=64)
+
+    async def consume():
+        while True:
+            await queue.get()
+            queue.task_done()
+
+    workers = [asyncio.create_task(consume()) for _ in range(consumers)]
+    start = time.perf_counter()
+    for item in items:
+        await queue.put(item)
+    await queue.join()
+    elapsed = time.perf_counter() - start
+    for worker in workers:
+        worker.cancel()
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--timers", type=int, default=1_000_000, help="pending timers")
+    parser.add_argument("--items", type=int, default=200_000, help="items sent through each queue")
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    deadlines = [rng.uniform(0, 60) for _ in range(args.timers)]
+    cancelled = rng.sample(range(args.timers), args.timers // 10)
+    steps = [i * 0.5 for i in range(1, 121)]
+    items = [(rng.randrange(1000), i) for i in range(args.items)]
+
+    print(f"Python {sys.version.split()[0]}")
+    print(f"{args.timers} timers, {len(cancelled)} cancelled, fired over {len(steps)} steps (ns per timer)")
+    print(f"{'':<28}{'schedule':>10}{'cancel':>10}{'fire':>10}")
+    loop = asyncio.new_event_loop()
+    try:
+        for name, run in [("heapq of TimerHandle", timers_heapq), ("TimerHeap", timers_native)]:
+            schedule, cancel, fire, fired = run(deadlines, cancelled, steps, loop)
+            assert fired == args.timers - len(cancelled)
+            print(f"{name:<28}{schedule / args.timers * 1e9:>10.0f}{cancel / len(cancelled) * 1e9:>10.0f}"
+                  f"{fire / fired * 1e9:>10.0f}")
+    finally:
+        loop.close()
+
+    print(f"\n{args.items} items (ns per item)")
+    print(f"{'':<28}{'nowait':>10}{'tasks':>10}")
+    for name, cls in [("asyncio.PriorityQueue", asyncio.PriorityQueue), ("aio.PriorityQueue", PriorityQueue)]:
+        nowait = asyncio.run(queue_nowait(cls, items))
+        tasks = asyncio.run(queue_tasks(cls, items))
+        print(f"{name:<28}{nowait / args.items * 1e9:>10.0f}{tasks / args.items * 1e9:>10.0f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+"""Per-call overhead of the pydatastructs methods, in nanoseconds.
+
+Most methods do a few nanoseconds of C work, so these numbers are dominated
+by argument parsing and boxing. Save a run before a change and compare after:
+
+    python benchmarks/bench_calls.py --save before.json
+    python benchmarks/bench_calls.py --compare before.json
+"""
+
+import argparse
+import json
+import sys
+import timeit
+
+CASES = [
+    # (name, setup, statement); setup runs once, the statement is timed
+    ("DoublyLinkedList()", "from pydatastructs.dllist import DoublyLinkedList as T", "T()"),
+    ("DoublyLinkedList.append+pop", "from pydatastructs.dllist import DoublyLinkedList\nl = DoublyLinkedList()\na, p = l.append, l.pop", "a(7); p(0)"),
+    ("DoublyLinkedList.prepend+pop", "from pydatastructs.dllist import DoublyLinkedList\nl = DoublyLinkedList()\na, p = l.prepend, l.pop", "a(7); p(0)"),
+    ("DoublyLinkedList.__len__", "from pydatastructs.dllist import DoublyLinkedList\nl = DoublyLinkedList()", "len(l)"),
+    ("MinHeap()", "from pydatastructs.min_heap import MinHeap as T", "T()"),
+    ("MinHeap.insert+remove", "from pydatastructs.min_heap import MinHeap\nh = MinHeap.heapify(list(range(1024)))\ni, r = h.insert, h.remove", "i(7); r()"),
+    ("MinHeap.pushpop", "from pydatastructs.min_heap import MinHeap\nh = MinHeap.heapify(list(range(1024)))\npp = h.pushpop", "pp(7)"),
+    ("MinHeap.peek", "from pydatastructs.min_heap import MinHeap\nh = MinHeap.heapify(list(range(1024)))\npk = h.peek", "pk()"),
+    ("LinkedList()", "from pydatastructs.linked_list import LinkedList as T", "T()"),
+    ("LinkedList.prepend+pop", "from pydatastructs.linked_list import LinkedList\nl = LinkedList()\na, p = l.prepend, l.pop", "a(7); p()"),
+    ("LinkedList.peek", "from pydatastructs.linked_list import LinkedList\nl = LinkedList()\nl.prepend(1)\npk = l.peek", "pk()"),
+    ("MonotonicIncreasingStack()", "from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack as T", "T()"),
+    ("MonotonicIncreasingStack.push+pop", "from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack\ns = MonotonicIncreasingStack()\na, p = s.push, s.pop", "a(7); p()"),
+    ("MonotonicIncreasingStack.top", "from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack\ns = MonotonicIncreasingStack()\ns.push(1)\nt = s.top", "t()"),
+    ("IntArray()", "from pydatastructs.int_array import IntArray as T", "T()"),
+    ("IntArray.append+pop", "from pydatastructs.int_array import IntArray\na = IntArray()\nap, p = a.append, a.pop", "ap(7); p()"),
+    ("IntArray[i]", "from pydatastructs.int_array import IntArray\na = IntArray()\na.append(1)", "a[0]"),
+    ("IntArray[i] = v", "from pydatastructs.int_array import IntArray\na = IntArray()\na.append(1)", "a[0] = 7"),
+]
+
+
+def measure(setup, stmt, number, repeat):
+    timer = timeit.Timer(stmt, setup)
+    return min(timer.repeat(repeat=repeat, number=number)) / number * 1e9
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--number", type=int, default=200_000, help="calls per timing run")
+    parser.add_argument("--repeat", type=int, default=7, help="timing runs; the fastest is reported")
+    parser.add_argument("--save", metavar="FILE", help="write the results as JSON")
+    parser.add_argument("--compare", metavar="FILE", help="show the change against a saved run")
+    args = parser.parse_args()
+
+    baseline = {}
+    if args.compare:
+        with open(args.compare) as f:
+            baseline = json.load(f)
+
+    print(f"Python {sys.version.split()[0]}")
+    print(f"{'case':<36}{'ns/call':>9}" + (f"{'before':>9}{'change':>9}" if baseline else ""))
+
+    results = {}
+    for name, setup, stmt in CASES:
+        ns = results[name] = measure(setup, stmt, args.number, args.repeat)
+        line = f"{name:<36}{ns:>9.1f}"
+        if name in baseline:
+            line += f"{baseline[name]:>9.1f}{(ns / baseline[name] - 1) * 100:>+8.0f}%"
+        print(line)
+
+    if args.save:
+        with open(args.save, "w") as f:
+            json.dump(results, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
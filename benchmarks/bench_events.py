@@ -0,0 +1,135 @@
+"""Event calendar throughput on a closed queueing network.
+
+Customers think for a while, then queue at one of the single-server FIFO
+stations, get served, and go back to thinking: the classic terminal model.
+Every thinking customer has an event pending, so the calendar holds about
+as many events as there are customers, nearly all scheduled later than
+everything pending. Times are whole ticks, so many events share a time and
+the calendar must keep them in schedule order. The same simulation runs on
+EventQueue and on a heapq of (time, sequence, id) entries, which is how
+Python simulators get FIFO ties. The calendar-only rows replay the recorded
+pushes and pops without the model, to show the queue's own cost.
+
+    python benchmarks/bench_events.py --stations 16 --customers 10000 --events 1000000
+"""
+
+import argparse
+import heapq
+import random
+import sys
+import time
+from collections import deque
+from itertools import count
+
+from pydatastructs.min_heap import EventQueue
+
+
+def simulate(calendar, stations, customers, events, services, thinks, routes):
+    """Runs the network and returns the (time, id) of every event.
+
+    Ids below stations are service completions at that station; the others
+    are customer id - stations done thinking.
+    """
+    push, pop = calendar
+    queues = [deque() for _ in range(stations)]
+    draw = 0
+    for customer in range(customers):
+        push(thinks[draw], stations + customer)
+        draw += 1
+
+    trace = []
+    for _ in range(events):
+        now, event = pop()
+        trace.append((now, event))
+        draw += 1
+        if event < stations:
+            customer = queues[event].popleft()
+            if queues[event]:
+                push(now + services[draw & 0xffff], event)
+            push(now + thinks[draw & 0xffff], stations + customer)
+        else:
+            station = routes[draw & 0xffff]
+            queues[station].append(event - stations)
+            if len(queues[station]) == 1:
+                push(now + services[draw & 0xffff], station)
+    return trace
+
+
+def event_queue_calendar():
+    queue = EventQueue()
+    return queue.push, queue.pop
+
+
+def heapq_calendar():
+    heap, sequence = [], count()
+
+    def push(when, event):
+        heapq.heappush(heap, (when, next(sequence), event))
+
+    def pop():
+        when, _, event = heapq.heappop(heap)
+        return when, event
+
+    return push, pop
+
+
+def replay(calendar, operations):
+    push, pop = calendar
+    start = time.perf_counter()
+    for when, event in operations:
+        if when is None:
+            pop()
+        else:
+            push(when, event)
+    return time.perf_counter() - start
+
+
+def record(stations, customers, events, services, thinks, routes):
+    """The calendar's pushes and pops, in order; a pop is (None, None)."""
+    push, pop = event_queue_calendar()
+    operations = []
+
+    def logged_push(when, event):
+        operations.append((when, event))
+        push(when, event)
+
+    def logged_pop():
+        operations.append((None, None))
+        return pop()
+
+    simulate((logged_push, logged_pop), stations, customers, events, services, thinks, routes)
+    return operations
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--stations", type=int, default=16)
+    parser.add_argument("--customers", type=int, default=10_000)
+    parser.add_argument("--events", type=int, default=1_000_000, help="events to simulate")
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    # Stations about 60% busy
+    services = [1 + int(rng.expovariate(1 / 10)) for _ in range(1 << 16)]
+    thinks = [int(rng.expovariate(1 / (args.customers * 11 // args.stations))) for _ in range(1 << 16)]
+    routes = [rng.randrange(args.stations) for _ in range(1 << 16)]
+    model = (args.stations, args.customers, args.events, services, thinks, routes)
+
+    print(f"Python {sys.version.split()[0]}")
+    print(f"{args.stations} stations, {args.customers} customers, {args.events} events (ns per event)")
+    traces = []
+    for name, calendar in [("heapq (time, seq, id)", heapq_calendar), ("EventQueue", event_queue_calendar)]:
+        start = time.perf_counter()
+        traces.append(simulate(calendar(), *model))
+        print(f"{name + ' model':<36}{(time.perf_counter() - start) / args.events * 1e9:>10.0f}")
+    assert traces[0] == traces[1]
+
+    operations = record(*model)
+    for name, calendar in [("heapq (time, seq, id)", heapq_calendar), ("EventQueue", event_queue_calendar)]:
+        elapsed = replay(calendar(), operations)
+        print(f"{name + ' calendar only':<36}{elapsed / args.events * 1e9:>10.0f}")
+
+
+if __name__ == "__main__":
+    main()
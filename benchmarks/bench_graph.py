@@ -0,0 +1,102 @@
+"""Shortest paths over a grid road network against pure Python and scipy.
+
+The graph is a side x side grid with random edge weights of at least 1, so
+the Manhattan distance to the target is an admissible A* heuristic. Each
+run reports milliseconds per search: Dijkstra from one source in
+CSRGraph and in a heapq loop over adjacency lists (and in
+scipy.sparse.csgraph when it is installed), A* across the grid, and a batch
+of sources split over a growing number of threads.
+
+    python benchmarks/bench_graph.py --side 1000 --sources 16 --threads 1 2 4
+"""
+
+import argparse
+import heapq
+import random
+import sys
+import time
+from array import array
+
+from pydatastructs.graph import CSRGraph
+
+
+def grid(side, rng):
+    indptr, indices, weights = array("i", [0]), array("i"), array("i")
+    for y in range(side):
+        for x in range(side):
+            for dx, dy in ((1, 0), (-1, 0), (0, 1), (0, -1)):
+                if 0 <= x + dx < side and 0 <= y + dy < side:
+                    indices.append((y + dy) * side + x + dx)
+                    weights.append(rng.randrange(1, 10))
+            indptr.append(len(indices))
+    return indptr, indices, weights
+
+
+def heapq_dijkstra(indptr, indices, weights, source):
+    distances = [-1] * (len(indptr) - 1)
+    distances[source] = 0
+    queue, pop, push = [(0, source)], heapq.heappop, heapq.heappush
+    while queue:
+        d, u = pop(queue)
+        if d > distances[u]:
+            continue
+        for e in range(indptr[u], indptr[u + 1]):
+            v, nd = indices[e], d + weights[e]
+            if distances[v] == -1 or nd < distances[v]:
+                distances[v] = nd
+                push(queue, (nd, v))
+    return distances
+
+
+def timed(run, repeat=1):
+    start = time.perf_counter()
+    for _ in range(repeat):
+        result = run()
+    return (time.perf_counter() - start) / repeat * 1e3, result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--side", type=int, default=1000, help="grid side, side**2 vertices")
+    parser.add_argument("--sources", type=int, default=16, help="sources in the batch")
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4])
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    side = args.side
+    indptr, indices, weights = grid(side, rng)
+    graph = CSRGraph(indptr, indices, weights)
+    target = side * side - 1
+
+    print(f"Python {sys.version.split()[0]}")
+    print(f"{len(graph)} vertices, {graph.edge_count} edges (ms per search)")
+    native, (distances, _) = timed(lambda: graph.dijkstra(0), 3)
+    print(f"{'dijkstra CSRGraph':<28}{native:>10.1f}")
+    python, expected = timed(lambda: heapq_dijkstra(indptr, indices, weights, 0))
+    assert list(distances) == expected
+    print(f"{'dijkstra heapq':<28}{python:>10.1f}")
+    try:
+        from scipy.sparse import csr_array
+        from scipy.sparse.csgraph import dijkstra
+    except ImportError:
+        pass
+    else:
+        matrix = csr_array((weights, indices, indptr), shape=(len(graph), len(graph)))
+        scipy, _ = timed(lambda: dijkstra(matrix, indices=0), 3)
+        print(f"{'dijkstra scipy':<28}{scipy:>10.1f}")
+
+    heuristic = array("i", [(side - 1 - v % side) + (side - 1 - v // side) for v in range(side * side)])
+    astar, (distance, _) = timed(lambda: graph.astar(0, target, heuristic), 3)
+    assert distance == distances[target]
+    print(f"{'astar CSRGraph':<28}{astar:>10.1f}")
+
+    sources = array("i", rng.sample(range(len(graph)), args.sources))
+    print(f"\n{args.sources} sources (ms per source)")
+    for threads in args.threads:
+        batch, _ = timed(lambda: graph.dijkstra(sources, threads=threads))
+        print(f"{f'threads={threads}':<28}{batch / args.sources:>10.1f}")
+
+
+if __name__ == "__main__":
+    main()
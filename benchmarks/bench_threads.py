@@ -0,0 +1,113 @@
+"""Multithreaded throughput of the pydatastructs containers.
+
+Run the same command on a regular interpreter and on a free-threaded one
+(e.g. python3.13t) and compare how throughput scales with the thread count:
+
+    python benchmarks/bench_threads.py --threads 1 2 4 8
+
+"private" gives every thread its own container, which scales with cores on
+a free-threaded build. "shared" makes all threads hammer one container,
+which serializes on its per-object critical section.
+"""
+
+import argparse
+import os
+import sys
+import threading
+import time
+
+from pydatastructs.dllist import DoublyLinkedList
+from pydatastructs.int_array import IntArray
+from pydatastructs.linked_list import LinkedList
+from pydatastructs.min_heap import MinHeap
+from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack
+
+
+def heap_work(heap, n):
+    insert, remove = heap.insert, heap.remove
+    for i in range(n):
+        insert(n - i)
+        if i & 1:
+            remove()
+
+
+def array_work(arr, n):
+    append, pop = arr.append, arr.pop
+    for i in range(n):
+        append(i)
+        if i & 1:
+            pop()
+
+
+def dllist_work(lst, n):
+    append, pop = lst.append, lst.pop
+    for i in range(n):
+        append(i)
+        if i & 1:
+            pop(0)
+
+
+def linked_list_work(lst, n):
+    prepend, pop = lst.prepend, lst.pop
+    for i in range(n):
+        prepend(i)
+        if i & 1:
+            pop()
+
+
+def stack_work(stack, n):
+    push = stack.push
+    for i in range(n):
+        push(i % 1024)
+
+
+WORKLOADS = {
+    "MinHeap": (MinHeap, heap_work),
+    "IntArray": (IntArray, array_work),
+    "DoublyLinkedList": (DoublyLinkedList, dllist_work),
+    "LinkedList": (LinkedList, linked_list_work),
+    "MonotonicIncreasingStack": (MonotonicIncreasingStack, stack_work),
+}
+
+
+def run(factory, work, threads, ops, shared):
+    containers = [factory()] * threads if shared else [factory() for _ in range(threads)]
+    barrier = threading.Barrier(threads + 1)
+
+    def target(container):
+        barrier.wait()
+        work(container, ops)
+
+    workers = [threading.Thread(target=target, args=(c,)) for c in containers]
+    for w in workers:
+        w.start()
+    barrier.wait()
+    start = time.perf_counter()
+    for w in workers:
+        w.join()
+    return threads * ops / (time.perf_counter() - start)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4, os.cpu_count() or 1])
+    parser.add_argument("--ops", type=int, default=200_000, help="operations per thread")
+    parser.add_argument("--only", choices=sorted(WORKLOADS), nargs="+", help="containers to run")
+    args = parser.parse_args()
+
+    gil = getattr(sys, "_is_gil_enabled", lambda: True)()
+    print(f"Python {sys.version.split()[0]}, GIL {'enabled' if gil else 'disabled'}, {os.cpu_count()} CPUs")
+    print(f"{'container':<26}{'mode':<9}{'threads':>8}{'Mops/s':>10}{'scaling':>9}")
+
+    for name in args.only or WORKLOADS:
+        factory, work = WORKLOADS[name]
+        for mode in ("private", "shared"):
+            base = None
+            for threads in args.threads:
+                rate = run(factory, work, threads, args.ops, mode == "shared")
+                base = base or rate
+                print(f"{name:<26}{mode:<9}{threads:>8}{rate / 1e6:>10.2f}{rate / base:>8.2f}x")
+
+
+if __name__ == "__main__":
+    main()
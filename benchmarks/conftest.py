@@ -0,0 +1,145 @@
+# benchmarks/conftest.py
+
+import ctypes
+import ctypes.util
+import json
+import os
+import random
+import tracemalloc
+
+import pytest
+
+ALL_SIZES = [10 ** k for k in range(2, 8)]
+DEFAULT_SIZES = [100, 10_000]
+
+
+def pytest_addoption(parser):
+    group = parser.getgroup("pydatastructs benchmarks")
+    group.addoption("--bench-sizes", default=",".join(map(str, DEFAULT_SIZES)),
+                    help="comma-separated workload sizes, or 'all' for 1e2..1e7")
+    group.addoption("--memory-save", metavar="FILE", help="write the memory results as JSON")
+    group.addoption("--memory-compare", metavar="FILE", help="fail cases that use more memory than a saved run")
+    group.addoption("--memory-threshold", type=float, default=10.0,
+                    help="percent growth over --memory-compare that fails a case")
+
+
+def pytest_generate_tests(metafunc):
+    if "size" in metafunc.fixturenames:
+        option = metafunc.config.getoption("--bench-sizes")
+        sizes = ALL_SIZES if option == "all" else [int(float(s)) for s in option.split(",")]
+        # Module scope groups the tests by size, so each workload is built once
+        metafunc.parametrize("size", sizes, ids=lambda n: f"n={n}", scope="module")
+
+
+@pytest.fixture(scope="module")
+def data(size):
+    """size pseudo-random int32 values, the same for every run."""
+    rng = random.Random(size)
+    return [rng.randrange(-2 ** 31, 2 ** 31) for _ in range(size)]
+
+
+def _rss():
+    """Current resident set size in bytes, or None off Linux."""
+    try:
+        with open("/proc/self/statm") as f:
+            return int(f.read().split()[1]) * os.sysconf("SC_PAGE_SIZE")
+    except (OSError, ValueError):
+        return None
+
+
+class _Mallinfo2(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_size_t) for name in
+                ("arena", "ordblks", "smblks", "hblks", "hblkhd", "usmblks", "fsmblks", "uordblks", "fordblks", "keepcost")]
+
+
+def _malloc_probe():
+    try:
+        libc = ctypes.CDLL(ctypes.util.find_library("c"))
+        mallinfo2 = libc.mallinfo2
+    except (OSError, AttributeError, TypeError):
+        return None
+    mallinfo2.restype = _Mallinfo2
+    return mallinfo2
+
+
+_mallinfo2 = _malloc_probe()
+
+
+def _malloc_bytes():
+    """Bytes in use by malloc (glibc 2.33+), or None elsewhere."""
+    if _mallinfo2 is None:
+        return None
+    info = _mallinfo2()
+    return info.uordblks + info.hblkhd
+
+
+class MemoryRecorder:
+    def __init__(self, config):
+        self.results = {}
+        self.threshold = config.getoption("--memory-threshold")
+        self.baseline = {}
+        path = config.getoption("--memory-compare")
+        if path:
+            with open(path) as f:
+                self.baseline = json.load(f)
+
+    def measure(self, key, build):
+        """Builds a container with build() and records the memory it holds.
+
+        tracemalloc sees Python allocations only. malloc counts every byte
+        the C heap hands out, including the containers' nodes and arrays.
+        RSS growth is what the process pays, but freed memory from earlier
+        cases is reused first, so it undercounts. Changes under 64 KiB never
+        fail.
+        """
+        tracemalloc.start()
+        malloc_before, rss_before = _malloc_bytes(), _rss()
+        container = build()
+        traced, _ = tracemalloc.get_traced_memory()
+        malloc_after, rss_after = _malloc_bytes(), _rss()
+        tracemalloc.stop()
+
+        result = {
+            "tracemalloc": traced,
+            "malloc": None if malloc_before is None else max(0, malloc_after - malloc_before),
+            "rss": None if rss_before is None else max(0, rss_after - rss_before),
+        }
+        self.results[key] = result
+
+        old = self.baseline.get(key)
+        if old:
+            for metric in ("tracemalloc", "malloc", "rss"):
+                before, after = old.get(metric), result[metric]
+                if before is None or after is None:
+                    continue
+                if after - before > 64 * 1024 and after > before * (1 + self.threshold / 100):
+                    pytest.fail(f"{key}: {metric} grew from {before} to {after} bytes")
+        del container
+        return result
+
+
+def pytest_configure(config):
+    config._pyds_memory = MemoryRecorder(config)
+
+
+@pytest.fixture
+def memory(request):
+    return request.config._pyds_memory
+
+
+def pytest_terminal_summary(terminalreporter, config):
+    recorder = getattr(config, "_pyds_memory", None)
+    if not recorder or not recorder.results:
+        return
+
+    terminalreporter.section("memory")
+    metrics = ("tracemalloc", "malloc", "rss")
+    terminalreporter.write_line(f"{'case':<40}" + "".join(f"{m:>14}" for m in metrics))
+    for key, result in sorted(recorder.results.items()):
+        cells = ("-" if result[m] is None else f"{result[m]:,}" for m in metrics)
+        terminalreporter.write_line(f"{key:<40}" + "".join(f"{c:>14}" for c in cells))
+
+    path = config.getoption("--memory-save")
+    if path:
+        with open(path, "w") as f:
+            json.dump(recorder.results, f, indent=2, sort_keys=True)
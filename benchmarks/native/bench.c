@@ -0,0 +1,436 @@
+// benchmarks/native/bench.c
+
+#define _GNU_SOURCE
+#include "bench.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifndef BENCH_REVISION
+#define BENCH_REVISION "unknown"
+#endif
+
+#define BENCH_MAX_SIZES 16
+
+typedef struct {
+    const char* group;
+    const bench_case_t* cases;
+} bench_group_t;
+
+static const bench_group_t groups[] = {
+    {"min_heap", min_heap_cases},
+    {"dllist", dllist_cases},
+    {"linked_list", linked_list_cases},
+    {"dynamic_array", dynamic_array_cases},
+    {"mis_da", mis_da_cases},
+    {"mis_ll", mis_ll_cases},
+    {"ws_deque", ws_deque_cases},
+};
+
+static const char* dist_names[BENCH_DIST_COUNT] = {"uniform", "sorted", "reversed", "few_unique"};
+
+typedef struct {
+    size_t sizes[BENCH_MAX_SIZES];
+    size_t size_count;
+    bool dists[BENCH_DIST_COUNT];
+    int samples;
+    int warmup;
+    int cpu;  // -2 pins to the CPU we start on, -1 disables pinning
+    uint64_t seed;
+    const char* filter;
+    const char* json_path;
+} bench_options_t;
+
+/* ---------- Counters ---------- */
+
+typedef struct {
+    int leader;  // cycles, or -1 when perf events are unavailable
+    int misses;  // cache misses, or -1
+} bench_perf_t;
+
+typedef struct {
+    double ns;
+    double cycles;  // < 0 when unavailable
+    double misses;  // < 0 when unavailable
+} bench_sample_t;
+
+#ifdef __linux__
+static int perf_open(uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group_fd == -1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+#endif
+
+static bench_perf_t perf_start(void) {
+    bench_perf_t perf = {-1, -1};
+#ifdef __linux__
+    if (getenv("BENCH_NO_PERF")) return perf;
+    perf.leader = perf_open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (perf.leader >= 0) perf.misses = perf_open(PERF_COUNT_HW_CACHE_MISSES, perf.leader);
+#endif
+    return perf;
+}
+
+static void perf_stop(bench_perf_t* perf) {
+#ifdef __linux__
+    if (perf->misses >= 0) close(perf->misses);
+    if (perf->leader >= 0) close(perf->leader);
+#endif
+    perf->leader = perf->misses = -1;
+}
+
+static void perf_enable(const bench_perf_t* perf) {
+#ifdef __linux__
+    if (perf->leader < 0) return;
+    ioctl(perf->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(perf->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+    (void)perf;
+#endif
+}
+
+static void perf_disable(const bench_perf_t* perf, bench_sample_t* sample) {
+    sample->cycles = sample->misses = -1;
+#ifdef __linux__
+    if (perf->leader < 0) return;
+    ioctl(perf->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    uint64_t values[3];  // nr, cycles, misses
+    ssize_t n = read(perf->leader, values, sizeof(values));
+    if (n >= (ssize_t)(2 * sizeof(uint64_t))) sample->cycles = (double)values[1];
+    if (n >= (ssize_t)(3 * sizeof(uint64_t)) && values[0] >= 2) sample->misses = (double)values[2];
+#else
+    (void)perf;
+#endif
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* ---------- Workloads ---------- */
+
+static uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void make_input(bench_input_t* input, size_t size, bench_dist_t dist, uint64_t seed) {
+    int32_t* values = malloc(sizeof(int32_t) * size);
+    size_t* indices = malloc(sizeof(size_t) * size);
+    if (!values || !indices) bench_fail("workload", "out of memory");
+
+    uint64_t state = seed;
+    for (size_t i = 0; i < size; i++) {
+        switch (dist) {
+            case BENCH_DIST_UNIFORM: values[i] = (int32_t)(uint32_t)splitmix64(&state); break;
+            case BENCH_DIST_SORTED: values[i] = (int32_t)i; break;
+            case BENCH_DIST_REVERSED: values[i] = (int32_t)(size - 1 - i); break;
+            default: values[i] = (int32_t)(splitmix64(&state) % 16); break;
+        }
+        indices[i] = (size_t)(splitmix64(&state) % size);
+    }
+
+    input->size = size;
+    input->dist = dist;
+    input->values = values;
+    input->indices = indices;
+}
+
+static void free_input(bench_input_t* input) {
+    free((void*)input->values);
+    free((void*)input->indices);
+}
+
+/* ---------- Statistics ---------- */
+
+static int compare_double(const void* a, const void* b) {
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted values.
+static double percentile(const double* sorted, int count, double p) {
+    int rank = (int)(p * count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+typedef struct {
+    double median_ns, p99_ns, min_ns;
+    double cycles, misses;  // medians, < 0 when unavailable
+} bench_summary_t;
+
+static bench_summary_t summarize(bench_sample_t* samples, int count, size_t ops) {
+    double* column = malloc(sizeof(double) * count);
+    if (!column) bench_fail("summary", "out of memory");
+    bench_summary_t s;
+
+    for (int i = 0; i < count; i++) column[i] = samples[i].ns / ops;
+    qsort(column, count, sizeof(double), compare_double);
+    s.median_ns = percentile(column, count, 0.5);
+    s.p99_ns = percentile(column, count, 0.99);
+    s.min_ns = column[0];
+
+    s.cycles = s.misses = -1;
+    if (samples[0].cycles >= 0) {
+        for (int i = 0; i < count; i++) column[i] = samples[i].cycles / ops;
+        qsort(column, count, sizeof(double), compare_double);
+        s.cycles = percentile(column, count, 0.5);
+    }
+    if (samples[0].misses >= 0) {
+        for (int i = 0; i < count; i++) column[i] = samples[i].misses / ops;
+        qsort(column, count, sizeof(double), compare_double);
+        s.misses = percentile(column, count, 0.5);
+    }
+
+    free(column);
+    return s;
+}
+
+/* ---------- Running ---------- */
+
+void bench_fail(const char* case_name, const char* what) {
+    fprintf(stderr, "bench: %s: %s\n", case_name, what);
+    exit(1);
+}
+
+static size_t run_once(const bench_case_t* c, const bench_input_t* input, const bench_perf_t* perf,
+                       bench_sample_t* sample) {
+    void* state = c->setup ? c->setup(input) : NULL;
+
+    perf_enable(perf);
+    double start = now_ns();
+    size_t ops = c->run(state, input);
+    double end = now_ns();
+    perf_disable(perf, sample);
+    sample->ns = end - start;
+
+    if (c->teardown) c->teardown(state);
+    return ops;
+}
+
+static int pin_cpu(int cpu) {
+#ifdef __linux__
+    if (cpu == -1) return -1;
+    if (cpu == -2) cpu = sched_getcpu();
+    if (cpu < 0) return -1;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        fprintf(stderr, "bench: could not pin to CPU %d: %s\n", cpu, strerror(errno));
+        return -1;
+    }
+    return cpu;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+static void json_number(FILE* out, double value) {
+    if (value < 0) fputs("null", out);
+    else fprintf(out, "%.3f", value);
+}
+
+static void usage(FILE* out) {
+    fputs("usage: bench_core [options]\n"
+          "  --size N[,N...]     operations per sample (default 1000,100000)\n"
+          "  --dist D[,D...]     uniform, sorted, reversed, few_unique or all (default uniform)\n"
+          "  --samples N         timed samples per case (default 21)\n"
+          "  --warmup N          untimed runs before sampling (default 3)\n"
+          "  --cpu N             pin to CPU N; -1 disables pinning (default: the starting CPU)\n"
+          "  --seed N            workload seed (default 1)\n"
+          "  --filter TEXT       only cases whose name contains TEXT\n"
+          "  --json FILE         write results as JSON (- for stdout)\n"
+          "  --list              list the cases and exit\n"
+          "Set BENCH_NO_PERF=1 to skip hardware counters.\n", out);
+}
+
+static void parse_sizes(bench_options_t* options, char* arg) {
+    options->size_count = 0;
+    for (char* tok = strtok(arg, ","); tok; tok = strtok(NULL, ",")) {
+        long long size = atoll(tok);
+        if (size <= 0 || options->size_count == BENCH_MAX_SIZES) bench_fail("--size", "expected up to 16 positive sizes");
+        options->sizes[options->size_count++] = (size_t)size;
+    }
+}
+
+static void parse_dists(bench_options_t* options, char* arg) {
+    memset(options->dists, 0, sizeof(options->dists));
+    for (char* tok = strtok(arg, ","); tok; tok = strtok(NULL, ",")) {
+        bool found = false;
+        for (int d = 0; d < BENCH_DIST_COUNT; d++) {
+            if (strcmp(tok, "all") == 0 || strcmp(tok, dist_names[d]) == 0) {
+                options->dists[d] = true;
+                found = true;
+            }
+        }
+        if (!found) bench_fail("--dist", "unknown distribution");
+    }
+}
+
+static void parse_options(bench_options_t* options, int argc, char** argv, bool* list) {
+    options->sizes[0] = 1000;
+    options->sizes[1] = 100000;
+    options->size_count = 2;
+    memset(options->dists, 0, sizeof(options->dists));
+    options->dists[BENCH_DIST_UNIFORM] = true;
+    options->samples = 21;
+    options->warmup = 3;
+    options->cpu = -2;
+    options->seed = 1;
+    options->filter = NULL;
+    options->json_path = NULL;
+    *list = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* opt = argv[i];
+        if (strcmp(opt, "--list") == 0) {
+            *list = true;
+            continue;
+        }
+        if (strcmp(opt, "--help") == 0 || strcmp(opt, "-h") == 0) {
+            usage(stdout);
+            exit(0);
+        }
+        if (i + 1 >= argc) {
+            usage(stderr);
+            exit(2);
+        }
+
+        char* value = argv[++i];
+        if (strcmp(opt, "--size") == 0) parse_sizes(options, value);
+        else if (strcmp(opt, "--dist") == 0) parse_dists(options, value);
+        else if (strcmp(opt, "--samples") == 0) options->samples = atoi(value);
+        else if (strcmp(opt, "--warmup") == 0) options->warmup = atoi(value);
+        else if (strcmp(opt, "--cpu") == 0) options->cpu = atoi(value);
+        else if (strcmp(opt, "--seed") == 0) options->seed = strtoull(value, NULL, 10);
+        else if (strcmp(opt, "--filter") == 0) options->filter = value;
+        else if (strcmp(opt, "--json") == 0) options->json_path = value;
+        else {
+            usage(stderr);
+            exit(2);
+        }
+    }
+    if (options->samples < 1 || options->warmup < 0) bench_fail("options", "--samples must be >= 1 and --warmup >= 0");
+}
+
+int main(int argc, char** argv) {
+    bench_options_t options;
+    bool list;
+    parse_options(&options, argc, argv, &list);
+
+    if (list) {
+        for (size_t g = 0; g < sizeof(groups) / sizeof(groups[0]); g++) {
+            for (const bench_case_t* c = groups[g].cases; c->name; c++) printf("%s/%s\n", groups[g].group, c->name);
+        }
+        return 0;
+    }
+
+    int cpu = pin_cpu(options.cpu);
+    bench_perf_t perf = perf_start();
+    bench_sample_t* samples = malloc(sizeof(bench_sample_t) * options.samples);
+    if (!samples) bench_fail("samples", "out of memory");
+
+    FILE* json = NULL;
+    if (options.json_path) {
+        json = strcmp(options.json_path, "-") == 0 ? stdout : fopen(options.json_path, "w");
+        if (!json) bench_fail(options.json_path, strerror(errno));
+        fprintf(json, "{\n  \"meta\": {\"revision\": \"%s\", \"compiler\": \"%s\", \"segmented_array\": %s, "
+                      "\"cpu\": %d, \"perf_counters\": %s, \"samples\": %d, \"warmup\": %d, \"seed\": %llu, "
+                      "\"timestamp\": %lld},\n  \"results\": [",
+                BENCH_REVISION, __VERSION__,
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+                "true",
+#else
+                "false",
+#endif
+                cpu, perf.leader >= 0 ? "true" : "false", options.samples, options.warmup,
+                (unsigned long long)options.seed, (long long)time(NULL));
+    }
+
+    FILE* table = json == stdout ? stderr : stdout;
+    fprintf(table, "%-36s %-10s %9s %10s %10s %10s %10s\n", "case", "dist", "size", "ns/op", "p99", "cycles/op",
+            "misses/op");
+
+    bool first = true;
+    for (size_t s = 0; s < options.size_count; s++) {
+        for (int d = 0; d < BENCH_DIST_COUNT; d++) {
+            if (!options.dists[d]) continue;
+            bench_input_t input;
+            make_input(&input, options.sizes[s], (bench_dist_t)d, options.seed);
+
+            for (size_t g = 0; g < sizeof(groups) / sizeof(groups[0]); g++) {
+                for (const bench_case_t* c = groups[g].cases; c->name; c++) {
+                    char name[128];
+                    snprintf(name, sizeof(name), "%s/%s", groups[g].group, c->name);
+                    if (options.filter && !strstr(name, options.filter)) continue;
+
+                    size_t ops = 0;
+                    bench_sample_t ignored;
+                    for (int w = 0; w < options.warmup; w++) run_once(c, &input, &perf, &ignored);
+                    for (int i = 0; i < options.samples; i++) ops = run_once(c, &input, &perf, &samples[i]);
+                    if (ops == 0) bench_fail(name, "ran no operations");
+
+                    bench_summary_t sum = summarize(samples, options.samples, ops);
+                    fprintf(table, "%-36s %-10s %9zu %10.2f %10.2f ", name, dist_names[d], input.size, sum.median_ns,
+                            sum.p99_ns);
+                    if (sum.cycles >= 0) fprintf(table, "%10.2f ", sum.cycles);
+                    else fprintf(table, "%10s ", "-");
+                    if (sum.misses >= 0) fprintf(table, "%10.3f\n", sum.misses);
+                    else fprintf(table, "%10s\n", "-");
+
+                    if (json) {
+                        fprintf(json, "%s\n    {\"name\": \"%s\", \"dist\": \"%s\", \"size\": %zu, \"ops\": %zu, "
+                                      "\"ns_per_op\": {\"median\": %.3f, \"p99\": %.3f, \"min\": %.3f}, "
+                                      "\"cycles_per_op\": ",
+                                first ? "" : ",", name, dist_names[d], input.size, ops, sum.median_ns, sum.p99_ns,
+                                sum.min_ns);
+                        json_number(json, sum.cycles);
+                        fputs(", \"cache_misses_per_op\": ", json);
+                        json_number(json, sum.misses);
+                        fputc('}', json);
+                        first = false;
+                    }
+                }
+            }
+            free_input(&input);
+        }
+    }
+
+    if (json) {
+        fputs("\n  ]\n}\n", json);
+        if (json != stdout) fclose(json);
+    }
+    free(samples);
+    perf_stop(&perf);
+    return 0;
+}
@@ -0,0 +1,77 @@
+// benchmarks/native/bench.h
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file bench.h
+ * @brief Microbenchmark harness for the C core, without the Python layer.
+ *
+ * A case builds its state in setup() outside the timed region, runs a batch
+ * of operations in run() and releases the state in teardown(). Each sample
+ * times one run() call; the harness reports the median and p99 of ns/op
+ * across samples, plus cycles/op and cache misses/op from perf_event_open
+ * when the kernel allows it.
+ */
+
+/**
+ * @brief Value distributions a workload can be generated from.
+ */
+typedef enum {
+    BENCH_DIST_UNIFORM = 0,  /**< Uniform over the full int32 range */
+    BENCH_DIST_SORTED,       /**< 0, 1, 2, ... */
+    BENCH_DIST_REVERSED,     /**< n-1, n-2, ..., 0 */
+    BENCH_DIST_FEW_UNIQUE,   /**< Uniform over 16 distinct values */
+    BENCH_DIST_COUNT
+} bench_dist_t;
+
+/**
+ * @brief Workload handed to every phase of a case.
+ */
+typedef struct {
+    size_t size;           ///< Number of operations (and values)
+    bench_dist_t dist;     ///< Distribution the values were drawn from
+    const int32_t* values; ///< size values drawn from dist
+    const size_t* indices; ///< size uniform indices in [0, size)
+} bench_input_t;
+
+/**
+ * @brief One benchmark case.
+ *
+ * run() returns the number of operations it performed, which divides the
+ * measured time and counters. setup() may return NULL if the case keeps no
+ * state; teardown() may be NULL.
+ */
+typedef struct {
+    const char* name;
+    void* (*setup)(const bench_input_t* input);
+    size_t (*run)(void* state, const bench_input_t* input);
+    void (*teardown)(void* state);
+} bench_case_t;
+
+/**
+ * @brief Keeps value observable so the compiler cannot drop the work that
+ * produced it.
+ */
+static inline void bench_consume(int64_t value) {
+    __asm__ __volatile__("" : : "r"(value) : "memory");
+}
+
+/**
+ * @brief Aborts the run with a message if a case's setup fails.
+ */
+void bench_fail(const char* case_name, const char* what);
+
+// Case tables, one per structure; each ends with an entry whose name is NULL.
+extern const bench_case_t min_heap_cases[];
+extern const bench_case_t dllist_cases[];
+extern const bench_case_t linked_list_cases[];
+extern const bench_case_t dynamic_array_cases[];
+extern const bench_case_t mis_da_cases[];
+extern const bench_case_t mis_ll_cases[];
+extern const bench_case_t ws_deque_cases[];
+
+#endif // BENCH_H
@@ -0,0 +1,69 @@
+// benchmarks/native/bench_dllist.c
+
+#include <stdlib.h>
+#include "bench.h"
+#include "../../src/alloc.h"
+#include "../../src/dllist.h"
+
+static void* empty_list(const bench_input_t* input) {
+    (void)input;
+    DoublyLinkedList* list = dll_create();
+    if (!list) bench_fail("dllist", "dll_create failed");
+    return list;
+}
+
+static void* full_list(const bench_input_t* input) {
+    DoublyLinkedList* list = empty_list(input);
+    for (size_t i = 0; i < input->size; i++) dll_append(list, input->values[i]);
+    return list;
+}
+
+static void free_list(void* state) {
+    dll_free(state);
+}
+
+static size_t run_append(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) dll_append(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_prepend(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) dll_prepend(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_pop_front(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) dll_pop(state, 0, &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+// Pops from the tail walk the whole list, so only the last 256 pops run.
+static size_t run_pop_back(void* state, const bench_input_t* input) {
+    DoublyLinkedList* list = state;
+    int removed = 0;
+    size_t ops = 0;
+    while (list->size > 0 && ops < 256) {
+        dll_pop(list, list->size - 1, &removed);
+        ops++;
+    }
+    bench_consume(removed);
+    return ops;
+}
+
+static size_t run_to_array(void* state, const bench_input_t* input) {
+    int* values = dll_to_array(state);
+    bench_consume(values ? values[0] : 0);
+    pyds_free(values);
+    return input->size;
+}
+
+const bench_case_t dllist_cases[] = {
+    {"append", empty_list, run_append, free_list},
+    {"prepend", empty_list, run_prepend, free_list},
+    {"pop_front", full_list, run_pop_front, free_list},
+    {"pop_back", full_list, run_pop_back, free_list},
+    {"to_array", full_list, run_to_array, free_list},
+    {NULL, NULL, NULL, NULL},
+};
@@ -0,0 +1,75 @@
+// benchmarks/native/bench_dynamic_array.c
+
+#include "bench.h"
+#include "../../src/dynamic_array.h"
+
+static void* empty_array(const bench_input_t* input) {
+    (void)input;
+    dynamic_array_t* array = dynamic_array_create(0);
+    if (!array) bench_fail("dynamic_array", "dynamic_array_create failed");
+    return array;
+}
+
+static void* full_array(const bench_input_t* input) {
+    dynamic_array_t* array = empty_array(input);
+    for (size_t i = 0; i < input->size; i++) {
+        if (dynamic_array_push_back(array, input->values[i]) != DYN_ARRAY_OK) {
+            bench_fail("dynamic_array", "dynamic_array_push_back failed");
+        }
+    }
+    return array;
+}
+
+static void free_array(void* state) {
+    dynamic_array_destroy(state);
+}
+
+static size_t run_push_back(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) dynamic_array_push_back(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_pop_back(void* state, const bench_input_t* input) {
+    int32_t removed = 0;
+    for (size_t i = 0; i < input->size; i++) dynamic_array_pop_back(state, &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+// get and set touch uniformly random indices.
+static size_t run_get(void* state, const bench_input_t* input) {
+    int64_t sum = 0;
+    for (size_t i = 0; i < input->size; i++) {
+        int32_t value = 0;
+        dynamic_array_get(state, input->indices[i], &value);
+        sum += value;
+    }
+    bench_consume(sum);
+    return input->size;
+}
+
+static size_t run_set(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) dynamic_array_set(state, input->indices[i], input->values[i]);
+    return input->size;
+}
+
+static size_t run_iterate(void* state, const bench_input_t* input) {
+    dynamic_array_iterator_t it;
+    int64_t sum = 0;
+    int32_t value;
+    bool has_next;
+
+    dynamic_array_iterator_init(state, &it);
+    while (dynamic_array_iterator_next(&it, &value, &has_next) == DYN_ARRAY_OK && has_next) sum += value;
+    bench_consume(sum);
+    return input->size;
+}
+
+const bench_case_t dynamic_array_cases[] = {
+    {"push_back", empty_array, run_push_back, free_array},
+    {"pop_back", full_array, run_pop_back, free_array},
+    {"get", full_array, run_get, free_array},
+    {"set", full_array, run_set, free_array},
+    {"iterate", full_array, run_iterate, free_array},
+    {NULL, NULL, NULL, NULL},
+};
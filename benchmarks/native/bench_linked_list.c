@@ -0,0 +1,47 @@
+// benchmarks/native/bench_linked_list.c
+
+#include "bench.h"
+#include "../../src/linked_list.h"
+
+static void* empty_list(const bench_input_t* input) {
+    (void)input;
+    LinkedList* list = linked_list_create();
+    if (!list) bench_fail("linked_list", "linked_list_create failed");
+    return list;
+}
+
+static void* full_list(const bench_input_t* input) {
+    LinkedList* list = empty_list(input);
+    for (size_t i = 0; i < input->size; i++) {
+        if (!linked_list_prepend(list, input->values[i])) bench_fail("linked_list", "linked_list_prepend failed");
+    }
+    return list;
+}
+
+static void free_list(void* state) {
+    linked_list_free(state);
+}
+
+static size_t run_prepend(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) linked_list_prepend(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_pop(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) linked_list_pop(state, &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+static size_t run_reverse(void* state, const bench_input_t* input) {
+    linked_list_reverse(state);
+    return input->size;
+}
+
+const bench_case_t linked_list_cases[] = {
+    {"prepend", empty_list, run_prepend, free_list},
+    {"pop", full_list, run_pop, free_list},
+    {"reverse", full_list, run_reverse, free_list},
+    {NULL, NULL, NULL, NULL},
+};
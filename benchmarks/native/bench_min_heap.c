@@ -0,0 +1,101 @@
+// benchmarks/native/bench_min_heap.c
+
+#include <stdlib.h>
+#include "bench.h"
+#include "../../src/min_heap.h"
+
+static void* empty_heap(const bench_input_t* input) {
+    (void)input;
+    MinHeap* heap = min_heap_create();
+    if (!heap) bench_fail("min_heap", "min_heap_create failed");
+    return heap;
+}
+
+static void* full_heap(const bench_input_t* input) {
+    MinHeap* heap = min_heap_heapify((int*)input->values, (int)input->size);
+    if (!heap) bench_fail("min_heap", "min_heap_heapify failed");
+    return heap;
+}
+
+static void free_heap(void* state) {
+    min_heap_free(state);
+}
+
+static size_t run_insert(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) min_heap_insert(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_remove(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) min_heap_remove(state, &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+static size_t run_pushpop(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) min_heap_pushpop(state, input->values[i], &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+// The heap built by run_heapify is freed in teardown, outside the timing.
+static void* heapify_slot(const bench_input_t* input) {
+    (void)input;
+    MinHeap** slot = calloc(1, sizeof(MinHeap*));
+    if (!slot) bench_fail("min_heap", "out of memory");
+    return slot;
+}
+
+static size_t run_heapify(void* state, const bench_input_t* input) {
+    MinHeap** slot = state;
+    *slot = min_heap_heapify((int*)input->values, (int)input->size);
+    return input->size;
+}
+
+static void free_heapify_slot(void* state) {
+    MinHeap** slot = state;
+    min_heap_free(*slot);
+    free(slot);
+}
+
+static void* full_min_max_heap(const bench_input_t* input) {
+    MinHeap* heap = min_max_heap_heapify((int*)input->values, (int)input->size);
+    if (!heap) bench_fail("min_heap", "min_max_heap_heapify failed");
+    return heap;
+}
+
+static size_t run_min_max_insert(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) min_max_heap_insert(state, input->values[i]);
+    return input->size;
+}
+
+// Alternates ends, so both trickle-down directions are timed
+static size_t run_min_max_pop(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) {
+        if (i & 1) min_max_heap_pop_max(state, &removed);
+        else min_max_heap_pop_min(state, &removed);
+    }
+    bench_consume(removed);
+    return input->size;
+}
+
+static size_t run_min_max_pushpop(void* state, const bench_input_t* input) {
+    int removed = 0;
+    for (size_t i = 0; i < input->size; i++) min_max_heap_pushpop_max(state, input->values[i], &removed);
+    bench_consume(removed);
+    return input->size;
+}
+
+const bench_case_t min_heap_cases[] = {
+    {"insert", empty_heap, run_insert, free_heap},
+    {"remove", full_heap, run_remove, free_heap},
+    {"pushpop", full_heap, run_pushpop, free_heap},
+    {"heapify", heapify_slot, run_heapify, free_heapify_slot},
+    {"minmax_insert", empty_heap, run_min_max_insert, free_heap},
+    {"minmax_pop", full_min_max_heap, run_min_max_pop, free_heap},
+    {"minmax_pushpop_max", full_min_max_heap, run_min_max_pushpop, free_heap},
+    {NULL, NULL, NULL, NULL},
+};
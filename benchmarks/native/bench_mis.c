@@ -0,0 +1,70 @@
+// benchmarks/native/bench_mis.c
+
+/*
+ * Cases for the monotonic increasing stack. The Makefile builds this file
+ * twice: as-is for the dynamic array backend, and with -DUSE_LINKED_LIST
+ * -include mis_ll_names.h for the linked list backend (mis_ll_cases).
+ */
+
+#include "bench.h"
+#include "../../src/monotonic_increasing_stack.h"
+
+#ifdef USE_LINKED_LIST
+#define MIS_GROUP "mis_ll"
+#else
+#define MIS_GROUP "mis_da"
+#endif
+
+static void* empty_stack(const bench_input_t* input) {
+    (void)input;
+    monotonic_increasing_stack_t* stack = NULL;
+    if (monotonic_increasing_stack_create(&stack) != MIS_SUCCESS) bench_fail(MIS_GROUP, "create failed");
+    return stack;
+}
+
+static void* full_stack(const bench_input_t* input) {
+    monotonic_increasing_stack_t* stack = empty_stack(input);
+    for (size_t i = 0; i < input->size; i++) {
+        if (monotonic_increasing_stack_push(stack, input->values[i]) != MIS_SUCCESS) {
+            bench_fail(MIS_GROUP, "push failed");
+        }
+    }
+    return stack;
+}
+
+static void free_stack(void* state) {
+    monotonic_increasing_stack_t* stack = state;
+    monotonic_increasing_stack_destroy(&stack);
+}
+
+static size_t run_push(void* state, const bench_input_t* input) {
+    for (size_t i = 0; i < input->size; i++) monotonic_increasing_stack_push(state, input->values[i]);
+    return input->size;
+}
+
+static size_t run_push_pop(void* state, const bench_input_t* input) {
+    int32_t removed = 0;
+    for (size_t i = 0; i < input->size; i++) {
+        monotonic_increasing_stack_push(state, input->values[i]);
+        monotonic_increasing_stack_pop(state, &removed);
+    }
+    bench_consume(removed);
+    return input->size;
+}
+
+// Pops whatever full_stack kept, which depends on the distribution.
+static size_t run_drain(void* state, const bench_input_t* input) {
+    (void)input;
+    int32_t removed = 0;
+    size_t ops = 0;
+    while (monotonic_increasing_stack_pop(state, &removed) == MIS_SUCCESS) ops++;
+    bench_consume(removed);
+    return ops;
+}
+
+const bench_case_t mis_da_cases[] = {
+    {"push", empty_stack, run_push, free_stack},
+    {"push_pop", empty_stack, run_push_pop, free_stack},
+    {"drain", full_stack, run_drain, free_stack},
+    {NULL, NULL, NULL, NULL},
+};
@@ -0,0 +1,105 @@
+// benchmarks/native/bench_ws_deque.c
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "bench.h"
+#include "../../src/ws_deque.h"
+
+static void* empty_deque(const bench_input_t* input) {
+    (void)input;
+    ws_deque_t* deque = ws_deque_create(0);
+    if (!deque) bench_fail("ws_deque", "ws_deque_create failed");
+    return deque;
+}
+
+static void* full_deque(const bench_input_t* input) {
+    ws_deque_t* deque = empty_deque(input);
+    for (size_t i = 0; i < input->size; i++) {
+        if (ws_deque_push(deque, input->values[i]) != WS_DEQUE_OK) bench_fail("ws_deque", "ws_deque_push failed");
+    }
+    return deque;
+}
+
+static void free_deque(void* state) {
+    ws_deque_destroy(state);
+}
+
+static size_t run_push_pop(void* state, const bench_input_t* input) {
+    int32_t value = 0;
+    for (size_t i = 0; i < input->size; i++) ws_deque_push(state, input->values[i]);
+    for (size_t i = 0; i < input->size; i++) ws_deque_pop(state, &value);
+    bench_consume(value);
+    return 2 * input->size;
+}
+
+static size_t run_push_steal(void* state, const bench_input_t* input) {
+    int32_t value = 0;
+    for (size_t i = 0; i < input->size; i++) ws_deque_push(state, input->values[i]);
+    for (size_t i = 0; i < input->size; i++) ws_deque_steal(state, &value);
+    bench_consume(value);
+    return 2 * input->size;
+}
+
+typedef struct {
+    ws_deque_t* deque;
+    int cpu;
+    int64_t sum;
+} thief_t;
+
+// The harness pins the main thread, so each thief moves to a CPU of its own
+static void* thief_main(void* arg) {
+    thief_t* thief = arg;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(thief->cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+
+    int32_t value;
+    ws_deque_status_t status;
+    while ((status = ws_deque_steal(thief->deque, &value)) != WS_DEQUE_EMPTY) {
+        if (status == WS_DEQUE_OK) thief->sum += value;
+    }
+    return NULL;
+}
+
+// Empties the deque with count thieves on separate CPUs, where there are enough
+static size_t run_steal(void* state, const bench_input_t* input, int count) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    pthread_t threads[8];
+    thief_t thieves[8];
+
+    for (int i = 0; i < count; i++) {
+        thieves[i] = (thief_t){state, (int)(i % (cpus > 0 ? cpus : 1)), 0};
+        if (pthread_create(&threads[i], NULL, thief_main, &thieves[i]) != 0) {
+            bench_fail("ws_deque", "pthread_create failed");
+        }
+    }
+
+    int64_t sum = 0;
+    for (int i = 0; i < count; i++) {
+        pthread_join(threads[i], NULL);
+        sum += thieves[i].sum;
+    }
+    bench_consume(sum);
+    return input->size;
+}
+
+static size_t run_steal_1(void* state, const bench_input_t* input) { return run_steal(state, input, 1); }
+static size_t run_steal_2(void* state, const bench_input_t* input) { return run_steal(state, input, 2); }
+static size_t run_steal_4(void* state, const bench_input_t* input) { return run_steal(state, input, 4); }
+static size_t run_steal_8(void* state, const bench_input_t* input) { return run_steal(state, input, 8); }
+
+// steal_N: N threads drain a full deque; ns/op is the wall time per value
+const bench_case_t ws_deque_cases[] = {
+    {"push_pop", empty_deque, run_push_pop, free_deque},
+    {"push_steal", empty_deque, run_push_steal, free_deque},
+    {"steal_1", full_deque, run_steal_1, free_deque},
+    {"steal_2", full_deque, run_steal_2, free_deque},
+    {"steal_4", full_deque, run_steal_4, free_deque},
+    {"steal_8", full_deque, run_steal_8, free_deque},
+    {NULL, NULL, NULL, NULL},
+};
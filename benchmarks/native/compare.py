@@ -0,0 +1,54 @@
+"""Compares two bench_core JSON files by median ns/op.
+
+    ./bench_core --dist all --json before.json
+    (change something, rebuild)
+    ./bench_core --dist all --json after.json
+    python compare.py before.json after.json --threshold 5
+
+Exits with status 1 if any case got slower by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return data["meta"], {(r["name"], r["dist"], r["size"]): r for r in data["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("before")
+    parser.add_argument("after")
+    parser.add_argument("--threshold", type=float, default=5.0, help="percent slowdown reported as a regression")
+    args = parser.parse_args()
+
+    before_meta, before = load(args.before)
+    after_meta, after = load(args.after)
+    print(f"before: {before_meta['revision']}  after: {after_meta['revision']}")
+    print(f"{'case':<32}{'dist':<12}{'size':>9}{'before':>10}{'after':>10}{'change':>9}")
+
+    regressions = 0
+    for key, new in after.items():
+        old = before.get(key)
+        if not old:
+            continue
+        old_ns, new_ns = old["ns_per_op"]["median"], new["ns_per_op"]["median"]
+        change = (new_ns / old_ns - 1) * 100 if old_ns else 0.0
+        mark = ""
+        if change > args.threshold:
+            regressions += 1
+            mark = "  <- slower"
+        name, dist, size = key
+        print(f"{name:<32}{dist:<12}{size:>9}{old_ns:>10.2f}{new_ns:>10.2f}{change:>+8.0f}%{mark}")
+
+    if regressions:
+        print(f"{regressions} case(s) slower by more than {args.threshold:g}%")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,28 @@
+// benchmarks/native/mis_ll_names.h
+
+#ifndef MIS_LL_NAMES_H
+#define MIS_LL_NAMES_H
+
+/*
+ * Renames the monotonic stack API so the linked list backend
+ * (USE_LINKED_LIST) links into the same binary as the dynamic array
+ * backend. Force-included with -include when building both the backend and
+ * its cases.
+ */
+#define monotonic_increasing_stack_create mis_ll_create
+#define monotonic_increasing_stack_attach mis_ll_attach
+#define monotonic_increasing_stack_lock mis_ll_lock
+#define monotonic_increasing_stack_unlock mis_ll_unlock
+#define monotonic_increasing_stack_destroy mis_ll_destroy
+#define monotonic_increasing_stack_push mis_ll_push
+#define monotonic_increasing_stack_pop mis_ll_pop
+#define monotonic_increasing_stack_top mis_ll_top
+#define monotonic_increasing_stack_is_empty mis_ll_is_empty
+#define monotonic_increasing_stack_size mis_ll_size
+#define monotonic_increasing_stack_to_array mis_ll_to_array
+#define monotonic_increasing_stack_get_stats mis_ll_get_stats
+#define monotonic_increasing_stack_reset_stats mis_ll_reset_stats
+#define monotonic_increasing_stack_memory_usage mis_ll_memory_usage
+#define mis_da_cases mis_ll_cases
+
+#endif // MIS_LL_NAMES_H
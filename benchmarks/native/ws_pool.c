@@ -0,0 +1,174 @@
+// benchmarks/native/ws_pool.c
+//
+// A small fork-join thread pool on ws_deque_t, as a demo and a stress test:
+//
+//   ./ws_pool [threads] [leaves] [work]
+//
+// Sums f(i) over [0, leaves) by recursive halving. A task is a range, stored
+// as its index in an implicit binary tree, so it fits an int32 deque value.
+// A worker pops its own newest task, splits it while it is wider than one
+// leaf and pushes the halves; idle workers steal the oldest, widest task of a
+// random victim. The result is checked against a single-threaded sum.
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../../src/ws_deque.h"
+
+#define MAX_WORKERS 64
+
+typedef struct pool pool_t;
+
+typedef struct {
+    pool_t* pool;
+    ws_deque_t* deque;
+    int id;
+    uint64_t seed;
+    uint64_t sum;
+    uint64_t executed;
+    uint64_t steals;
+} worker_t;
+
+struct pool {
+    worker_t workers[MAX_WORKERS];
+    int count;
+    int32_t leaves;
+    int work;
+    int64_t pending;  // Tasks pushed and not yet finished
+};
+
+// Deliberately dependent work so a leaf costs roughly `work` multiplies
+static uint64_t leaf(int32_t index, int work) {
+    uint64_t x = (uint64_t)index + 1;
+    for (int i = 0; i < work; i++) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    return x >> 33;
+}
+
+// Node 1 covers [0, leaves); node n splits into 2n and 2n + 1
+static void node_range(int32_t node, int32_t leaves, int32_t* lo, int32_t* hi) {
+    int depth = 0;
+    while ((node >> depth) > 1) depth++;
+    *lo = 0;
+    *hi = leaves;
+    for (int d = depth - 1; d >= 0; d--) {
+        int32_t mid = *lo + (*hi - *lo) / 2;
+        if ((node >> d) & 1) *lo = mid;
+        else *hi = mid;
+    }
+}
+
+static void run_task(worker_t* worker, int32_t node) {
+    pool_t* pool = worker->pool;
+    int32_t lo, hi;
+
+    // Split down to single leaves, keeping the left half to run next
+    node_range(node, pool->leaves, &lo, &hi);
+    while (hi - lo > 1) {
+        __atomic_fetch_add(&pool->pending, 1, __ATOMIC_RELAXED);
+        if (ws_deque_push(worker->deque, 2 * node + 1) != WS_DEQUE_OK) {
+            fprintf(stderr, "ws_pool: out of memory\n");
+            exit(1);
+        }
+        node = 2 * node;
+        hi = lo + (hi - lo) / 2;
+    }
+
+    if (lo < hi) worker->sum += leaf(lo, pool->work);
+    worker->executed++;
+    __atomic_fetch_sub(&pool->pending, 1, __ATOMIC_RELEASE);
+}
+
+static int steal_task(worker_t* worker, int32_t* node) {
+    pool_t* pool = worker->pool;
+
+    for (int attempt = 0; attempt < 2 * pool->count; attempt++) {
+        worker->seed = worker->seed * 6364136223846793005ULL + 1;
+        int victim = (int)((worker->seed >> 33) % (uint64_t)pool->count);
+        if (victim == worker->id) continue;
+        if (ws_deque_steal(pool->workers[victim].deque, node) == WS_DEQUE_OK) {
+            worker->steals++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void* worker_main(void* arg) {
+    worker_t* worker = arg;
+    pool_t* pool = worker->pool;
+    int32_t node;
+
+    while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) > 0) {
+        if (ws_deque_pop(worker->deque, &node) == WS_DEQUE_OK || steal_task(worker, &node)) {
+            run_task(worker, node);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static double seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv) {
+    static pool_t pool;
+    pool.count = argc > 1 ? atoi(argv[1]) : 4;
+    long leaves = argc > 2 ? atol(argv[2]) : 1L << 18;
+    pool.work = argc > 3 ? atoi(argv[3]) : 1000;
+    if (pool.count < 1 || pool.count > MAX_WORKERS || leaves < 1 || leaves > (1L << 29) || pool.work < 0) {
+        fprintf(stderr, "usage: %s [threads 1-%d] [leaves 1-2^29] [work]\n", argv[0], MAX_WORKERS);
+        return 2;
+    }
+    pool.leaves = (int32_t)leaves;
+
+    double start = seconds();
+    uint64_t expected = 0;
+    for (int32_t i = 0; i < pool.leaves; i++) expected += leaf(i, pool.work);
+    double serial = seconds() - start;
+
+    for (int i = 0; i < pool.count; i++) {
+        pool.workers[i] = (worker_t){.pool = &pool, .id = i, .seed = 0x9E3779B97F4A7C15ULL * (uint64_t)(i + 1)};
+        pool.workers[i].deque = ws_deque_create(0);
+        if (!pool.workers[i].deque) {
+            fprintf(stderr, "ws_pool: out of memory\n");
+            return 1;
+        }
+    }
+    pool.pending = 1;
+    ws_deque_push(pool.workers[0].deque, 1);
+
+    start = seconds();
+    pthread_t threads[MAX_WORKERS];
+    for (int i = 1; i < pool.count; i++) {
+        if (pthread_create(&threads[i], NULL, worker_main, &pool.workers[i]) != 0) {
+            fprintf(stderr, "ws_pool: pthread_create failed\n");
+            return 1;
+        }
+    }
+    worker_main(&pool.workers[0]);
+    for (int i = 1; i < pool.count; i++) pthread_join(threads[i], NULL);
+    double parallel = seconds() - start;
+
+    uint64_t sum = 0, executed = 0, steals = 0;
+    for (int i = 0; i < pool.count; i++) {
+        sum += pool.workers[i].sum;
+        executed += pool.workers[i].executed;
+        steals += pool.workers[i].steals;
+        ws_deque_destroy(pool.workers[i].deque);
+    }
+
+    printf("threads %d  leaves %d  tasks %llu  steals %llu\n", pool.count, pool.leaves,
+           (unsigned long long)executed, (unsigned long long)steals);
+    printf("serial %.3f s  pool %.3f s  speedup %.2fx\n", serial, parallel, serial / parallel);
+    if (sum != expected) {
+        fprintf(stderr, "ws_pool: sum %llu, expected %llu\n", (unsigned long long)sum, (unsigned long long)expected);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+// benchmarks/native/ws_retire.c
+//
+// Checks that ws_deque_t frees the rings it outgrows:
+//
+//   make check
+//
+// A steal in flight may still be reading a ring the owner replaces, so
+// growth keeps the old ring while one is running. This pins a steal the way
+// ws_deque_steal() announces itself, grows the deque past it, and checks
+// that the kept rings show up in ws_deque_memory_usage() and that the
+// owner's next push or pop frees them once the steal is gone.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../../src/ws_deque.h"
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "ws_retire: %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+        exit(1); \
+    } \
+} while (0)
+
+static void pin_steal(ws_deque_t* deque) {
+    __atomic_fetch_add(&deque->thieves, 1, __ATOMIC_SEQ_CST);
+}
+
+static void unpin_steal(ws_deque_t* deque) {
+    __atomic_fetch_sub(&deque->thieves, 1, __ATOMIC_RELEASE);
+}
+
+// Grows deque from 16 slots to 1024 with a steal pinned, then lets owner free the old rings
+static void check_freed_by(int (*owner_step)(ws_deque_t*), const char* name) {
+    ws_deque_t* empty = ws_deque_create(0);
+    ws_deque_t* deque = ws_deque_create(0);
+    CHECK(empty && deque);
+
+    pin_steal(deque);
+    for (int32_t v = 0; v < 1000; v++) CHECK(ws_deque_push(deque, v) == WS_DEQUE_OK);
+    size_t pinned = ws_deque_memory_usage(deque);
+    unpin_steal(deque);
+
+    // Rings of 16 to 512 slots are kept
+    size_t ring = sizeof(int32_t) * (1024 - 16);
+    size_t retired = sizeof(int32_t) * (1024 - 16);
+    CHECK(pinned > ws_deque_memory_usage(empty) + ring + retired);
+
+    CHECK(owner_step(deque));
+    size_t freed = ws_deque_memory_usage(deque);
+    CHECK(freed == ws_deque_memory_usage(empty) + ring);
+    printf("%-5s %zu bytes with a steal in flight, %zu after\n", name, pinned, freed);
+
+    // The values survived every grow
+    int32_t value;
+    for (int32_t v = 0; v < 999; v++) {
+        CHECK(ws_deque_steal(deque, &value) == WS_DEQUE_OK && value == v);
+    }
+    ws_deque_destroy(deque);
+    ws_deque_destroy(empty);
+}
+
+static int push_once(ws_deque_t* deque) {
+    int32_t value;
+    return ws_deque_push(deque, 1000) == WS_DEQUE_OK && ws_deque_pop(deque, &value) == WS_DEQUE_OK &&
+           value == 1000 && ws_deque_pop(deque, &value) == WS_DEQUE_OK && value == 999;
+}
+
+static int pop_once(ws_deque_t* deque) {
+    int32_t value;
+    return ws_deque_pop(deque, &value) == WS_DEQUE_OK && value == 999;
+}
+
+int main(void) {
+    check_freed_by(pop_once, "pop");
+    check_freed_by(push_once, "push");
+    return 0;
+}
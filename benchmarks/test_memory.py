@@ -0,0 +1,55 @@
+# benchmarks/test_memory.py
+#
+# Memory held by each container against its stdlib equivalent, as traced
+# Python allocations and RSS growth. Run with --memory-save to record a
+# baseline and --memory-compare to fail cases that grew past it.
+
+import heapq
+from bisect import bisect_right
+from collections import deque
+
+import pytest
+from pydatastructs.dllist import DoublyLinkedList
+from pydatastructs.linked_list import LinkedList
+from pydatastructs.min_heap import MinHeap
+from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack
+
+
+def fill(cls, method, values):
+    container = cls()
+    fn = getattr(container, method)
+    for value in values:
+        fn(value)
+    return container
+
+
+def heapq_of(data):
+    heap = list(data)
+    heapq.heapify(heap)
+    return heap
+
+
+def bisect_stack(data):
+    stack = []
+    for value in sorted(data):
+        del stack[bisect_right(stack, value):]
+        stack.append(value)
+    return stack
+
+
+BUILDERS = [
+    ("MinHeap", MinHeap.heapify),
+    ("heapq", heapq_of),
+    ("DoublyLinkedList", lambda d: fill(DoublyLinkedList, "append", d)),
+    ("deque", deque),
+    ("LinkedList", lambda d: fill(LinkedList, "prepend", d)),
+    ("list", list),
+    ("MonotonicIncreasingStack", lambda d: fill(MonotonicIncreasingStack, "push", sorted(d))),
+    ("bisect", bisect_stack),
+]
+
+
+@pytest.mark.parametrize("name, build", BUILDERS, ids=[name for name, _ in BUILDERS])
+def test_memory(memory, name, build, data, size):
+    result = memory.measure(f"{name} n={size}", lambda: build(data))
+    assert result["tracemalloc"] >= 0
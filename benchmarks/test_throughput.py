@@ -0,0 +1,507 @@
+# benchmarks/test_throughput.py
+#
+# Throughput of every public method against its closest stdlib equivalent:
+# MinHeap vs heapq, Deque and DoublyLinkedList vs collections.deque,
+# LinkedList vs a list used as a stack, MonotonicIncreasingStack vs a list kept sorted with
+# bisect, SlidingMedian vs a window kept sorted with bisect, TimerHeap vs a heapq
+# of (deadline, sequence, callback) entries, EventQueue vs a heapq of (time,
+# sequence, id) entries, CSRGraph.dijkstra vs a heapq
+# Dijkstra over adjacency lists. Each pair shares
+# a pytest-benchmark group, so the report puts them side by side.
+
+import heapq
+import pickle
+from itertools import count
+from operator import itemgetter
+from array import array
+from bisect import bisect_left, bisect_right, insort
+from collections import deque, namedtuple
+
+import pytest
+
+pytest.importorskip("pytest_benchmark")
+
+from pydatastructs.aio import TimerHeap
+from pydatastructs.deque import Deque
+from pydatastructs.dllist import DoublyLinkedList
+from pydatastructs.graph import CSRGraph
+from pydatastructs.linked_list import LinkedList
+from pydatastructs.merge import merge_sorted
+from pydatastructs.min_heap import EventQueue, ExternalMinHeap, MinHeap, MinMaxHeap
+from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack
+from pydatastructs.sliding_median import SlidingMedian
+
+# setup(data, tmp_path) builds the state outside the timing, run(state) is
+# timed, and ops(size) is the number of operations one run performs.
+Case = namedtuple("Case", "group impl setup run ops")
+
+ALL = lambda n: n
+# Methods that walk the structure on every call only run 100 times
+FEW = lambda n: min(n, 100)
+
+
+# ---------- Builders ----------
+
+def heapq_of(data):
+    heap = list(data)
+    heapq.heapify(heap)
+    return heap
+
+
+def records(data):
+    return [(value, "job") for value in data]
+
+
+def keyed_heap_of(data):
+    return MinHeap.heapify(records(data), key=itemgetter(0))
+
+
+# The usual heapq idiom for a key: (key, tie breaker, item) entries
+def decorated_of(data):
+    heap = [(record[0], i, record) for i, record in enumerate(records(data))]
+    heapq.heapify(heap)
+    return heap
+
+
+def decorated_push(heap, record, tie=count()):
+    heapq.heappush(heap, (record[0], next(tie), record))
+
+
+# Tracking both ends with a MinHeap and a reversed MinHeap kept in sync
+def heap_pair():
+    return MinHeap(), MinHeap(reverse=True)
+
+
+def pair_insert(pair, value):
+    pair[0].insert(value)
+    pair[1].insert(value)
+
+
+# The usual heapq idiom for the k smallest values: a max-heap of negations
+def insert_drain(state):
+    heap, values = state
+    for value in values:
+        heap.insert(value)
+    for _ in range(len(values)):
+        heap.remove()
+
+
+def sorted_window_medians(values, window=101):
+    """Running median with a list kept sorted by bisect, the usual pure-Python way."""
+    ordered, medians = [], []
+    for i, value in enumerate(values):
+        if i >= window:
+            del ordered[bisect_left(ordered, values[i - window])]
+        insort(ordered, value)
+        n = len(ordered)
+        medians.append((ordered[(n - 1) // 2] + ordered[n // 2]) / 2)
+    return medians
+
+
+# Timers at the data's values as deadlines, a tenth cancelled, the rest fired in ten steps
+def timer_heap_fire(values):
+    timers = TimerHeap()
+    schedule, cancel = timers.schedule, timers.cancel
+    handles = [schedule(value, print) for value in values]
+    for handle in handles[::10]:
+        cancel(handle)
+    for now in range(-(2 ** 31), 2 ** 31, 2 ** 29):
+        timers.pop_expired(now)
+
+
+# Cancelled entries stay in the heap until they reach the top, as in asyncio
+def heapq_timers_fire(values):
+    heap, entries, push, pop = [], [], heapq.heappush, heapq.heappop
+    for i, value in enumerate(values):
+        entry = [value, i, print]
+        push(heap, entry)
+        entries.append(entry)
+    for entry in entries[::10]:
+        entry[2] = None
+    for now in range(-(2 ** 31), 2 ** 31, 2 ** 29):
+        while heap and heap[0][0] <= now:
+            pop(heap)
+
+
+def bounded_push(heap, value, k=100):
+    if len(heap) < k:
+        heapq.heappush(heap, -value)
+    else:
+        heapq.heappushpop(heap, -value)
+
+
+# 64 sorted shards of the data
+# Events at the values' top bytes as times, so many share each, popped in same-time batches
+def event_queue_run(values):
+    queue = EventQueue()
+    push = queue.push
+    for i, value in enumerate(values):
+        push(value >> 24, i)
+    pop_batch = queue.pop_batch
+    while pop_batch():
+        pass
+
+
+def heapq_events_run(values):
+    heap, push, pop = [], heapq.heappush, heapq.heappop
+    for i, value in enumerate(values):
+        push(heap, (value >> 24, i, i))
+    while heap:
+        time = heap[0][0]
+        batch = []
+        while heap and heap[0][0] == time:
+            batch.append(pop(heap)[2])
+
+
+# A ring with four chords per vertex, weighted by the data
+def chord_edges(data):
+    n = len(data)
+    return [[((u + hop) % n, abs(data[(u * 4 + i) % n]) % 100) for i, hop in enumerate((1, 7, 61, 997))]
+            for u in range(n)]
+
+
+def csr_graph(data):
+    adjacency = chord_edges(data)
+    indptr = array("i", range(0, 4 * len(adjacency) + 1, 4))
+    return CSRGraph(indptr, array("i", [v for out in adjacency for v, _ in out]),
+                    array("i", [w for out in adjacency for _, w in out]))
+
+
+def heapq_dijkstra(adjacency, source=0):
+    distances = [-1] * len(adjacency)
+    distances[source] = 0
+    queue, pop, push = [(0, source)], heapq.heappop, heapq.heappush
+    while queue:
+        d, u = pop(queue)
+        if d > distances[u]:
+            continue
+        for v, w in adjacency[u]:
+            if distances[v] == -1 or d + w < distances[v]:
+                distances[v] = d + w
+                push(queue, (d + w, v))
+    return distances
+
+
+def shards(data, count=64):
+    return [sorted(data[i::count]) for i in range(count)]
+
+
+def heap_merge(runs):
+    """Merges through MinHeap entries keyed by value, one shard per entry."""
+    heap = MinHeap(key=itemgetter(0))
+    for shard, run in enumerate(runs):
+        if run:
+            heap.insert((run[0], shard, 1))
+    out = []
+    while heap:
+        value, shard, index = heap.remove()
+        out.append(value)
+        if index < len(runs[shard]):
+            heap.insert((runs[shard][index], shard, index + 1))
+    return out
+
+
+def dll_of(data):
+    dll = DoublyLinkedList()
+    append = dll.append
+    for value in data:
+        append(value)
+    return dll
+
+
+def linked_list_of(data):
+    ll = LinkedList()
+    prepend = ll.prepend
+    for value in data:
+        prepend(value)
+    return ll
+
+
+def mis_of(data):
+    # Sorted input keeps every value on the stack
+    stack = MonotonicIncreasingStack()
+    push = stack.push
+    for value in sorted(data):
+        push(value)
+    return stack
+
+
+def bisect_push(stack, value):
+    del stack[bisect_right(stack, value):]
+    stack.append(value)
+
+
+def empty(factory):
+    """Setup for an empty container and the values to feed it."""
+    return lambda data, tmp: (factory(), data)
+
+
+def built(builder):
+    """Setup for a container holding the data."""
+    return lambda data, tmp: builder(data)
+
+
+# ---------- Timed bodies ----------
+
+def each(method):
+    """Calls container.method(value) for every value."""
+    def run(state):
+        container, values = state
+        fn = getattr(container, method)
+        for value in values:
+            fn(value)
+    return run
+
+
+def each_fn(fn):
+    """Calls fn(container, value) for every value."""
+    def run(state):
+        container, values = state
+        for value in values:
+            fn(container, value)
+    return run
+
+
+def repeat(method, *args, limit=None):
+    """Calls container.method(*args) once per element, at most limit times."""
+    def run(container):
+        fn = getattr(container, method)
+        count = len(container) if limit is None else min(limit, len(container))
+        for _ in range(count):
+            fn(*args)
+    return run
+
+
+def dll_pop_last(dll):
+    pop = dll.pop
+    for _ in range(min(len(dll), 100)):
+        pop(len(dll) - 1)
+
+
+def middle_items(container):
+    middle = len(container) // 2
+    for _ in range(len(container)):
+        container[middle]
+
+
+def heap_open_sync(state):
+    path, values = state
+    heap = MinHeap.open(path)
+    insert = heap.insert
+    for value in values:
+        insert(value)
+    heap.sync()
+
+
+def heapq_pickle_file(state):
+    path, values = state
+    heap, push = [], heapq.heappush
+    for value in values:
+        push(heap, value)
+    with open(path, "wb") as f:
+        pickle.dump(heap, f, protocol=5)
+
+
+def attached(cls, method):
+    """Fills a structure attached to a fresh writable buffer."""
+    def run(state):
+        buffer, values = state
+        container = cls.attach(buffer, create=True)
+        fn = getattr(container, method)
+        for value in values:
+            fn(value)
+        del container
+    return run
+
+
+def shared_buffer(data, tmp):
+    return bytearray(4 * len(data) + 4096), data
+
+
+CASES = [
+    # MinHeap vs heapq
+    Case("heap.insert", "MinHeap", empty(MinHeap), each("insert"), ALL),
+    Case("heap.insert", "heapq", empty(list), each_fn(heapq.heappush), ALL),
+    Case("heap.remove", "MinHeap", built(MinHeap.heapify), repeat("remove"), ALL),
+    Case("heap.remove", "heapq", built(heapq_of), lambda h: [heapq.heappop(h) for _ in range(len(h))], ALL),
+    Case("heap.heapify", "MinHeap", lambda d, t: d, MinHeap.heapify, ALL),
+    Case("heap.heapify", "heapq", lambda d, t: list(d), heapq.heapify, ALL),
+    Case("heap.pushpop", "MinHeap", lambda d, t: (MinHeap.heapify(d), d), each("pushpop"), ALL),
+    Case("heap.pushpop", "heapq", lambda d, t: (heapq_of(d), d), each_fn(heapq.heappushpop), ALL),
+    Case("heap.peek", "MinHeap", built(MinHeap.heapify), repeat("peek"), ALL),
+    Case("heap.peek", "heapq", built(heapq_of), repeat("__getitem__", 0), ALL),
+    Case("heap.open+sync", "MinHeap", lambda d, t: (str(t / "heap.pyds"), d), heap_open_sync, ALL),
+    Case("heap.open+sync", "heapq", lambda d, t: (str(t / "heap.pickle"), d), heapq_pickle_file, ALL),
+    Case("heap.attach", "MinHeap", shared_buffer, attached(MinHeap, "insert"), ALL),
+    Case("heap.attach", "heapq", empty(list), each_fn(heapq.heappush), ALL),
+    Case("heap.insert(key)", "MinHeap", lambda d, t: (MinHeap(key=itemgetter(0)), records(d)), each("insert"), ALL),
+    Case("heap.insert(key)", "heapq", lambda d, t: ([], records(d)), each_fn(decorated_push), ALL),
+    Case("heap.remove(key)", "MinHeap", built(keyed_heap_of), repeat("remove"), ALL),
+    Case("heap.remove(key)", "heapq", built(decorated_of), lambda h: [heapq.heappop(h)[2] for _ in range(len(h))], ALL),
+    Case("heap.insert(reverse)", "MinHeap", empty(lambda: MinHeap(reverse=True)), each("insert"), ALL),
+    Case("heap.insert(reverse)", "heapq", empty(list), each_fn(lambda h, v: heapq.heappush(h, -v)), ALL),
+    Case("heap.remove(reverse)", "MinHeap", built(lambda d: MinHeap.heapify(d, reverse=True)), repeat("remove"), ALL),
+    Case("heap.remove(reverse)", "heapq", built(lambda d: heapq_of(-v for v in d)),
+         lambda h: [-heapq.heappop(h) for _ in range(len(h))], ALL),
+
+    # MinMaxHeap vs a pair of heaps
+    Case("minmax.insert", "MinMaxHeap", empty(MinMaxHeap), each("insert"), ALL),
+    Case("minmax.insert", "MinHeap pair", empty(heap_pair), each_fn(pair_insert), ALL),
+    Case("minmax.insert(maxlen)", "MinMaxHeap", empty(lambda: MinMaxHeap(maxlen=100)), each("insert"), ALL),
+    Case("minmax.insert(maxlen)", "heapq", empty(list), each_fn(bounded_push), ALL),
+
+    # ExternalMinHeap with a 64 KiB budget, spilling runs to tmp_path, vs MinHeap
+    Case("heap.external", "ExternalMinHeap",
+         lambda d, t: (ExternalMinHeap(memory_limit=64 * 1024, directory=t), d), insert_drain, ALL),
+    Case("heap.external", "MinHeap", empty(MinHeap), insert_drain, ALL),
+
+    # SlidingMedian over a 101-sample window vs a bisect-sorted list
+    Case("median", "SlidingMedian.update", lambda d, t: (SlidingMedian(101), array("i", d)),
+         lambda state: state[0].update(state[1]), ALL),
+    Case("median", "SlidingMedian.push", lambda d, t: (SlidingMedian(101), d), each("push"), ALL),
+    Case("median", "bisect", lambda d, t: d, sorted_window_medians, ALL),
+
+    # TimerHeap vs heapq: schedule every value, cancel a tenth, fire the rest
+    Case("timers", "TimerHeap", lambda d, t: d, timer_heap_fire, ALL),
+    Case("timers", "heapq", lambda d, t: d, heapq_timers_fire, ALL),
+
+    # EventQueue vs heapq: push every value's high byte as a time, pop same-time batches
+    Case("events", "EventQueue", lambda d, t: d, event_queue_run, ALL),
+    Case("events", "heapq", lambda d, t: d, heapq_events_run, ALL),
+
+    # CSRGraph.dijkstra vs heapq over adjacency lists, one vertex per value
+    Case("graph.dijkstra", "CSRGraph", lambda d, t: csr_graph(d), lambda graph: graph.dijkstra(0), ALL),
+    Case("graph.dijkstra", "heapq", lambda d, t: chord_edges(d), heapq_dijkstra, ALL),
+
+    # merge_sorted vs heapq.merge and a MinHeap of (value, shard) entries
+    Case("merge", "merge_sorted", lambda d, t: [array("i", run) for run in shards(d)], merge_sorted, ALL),
+    Case("merge", "heapq.merge", lambda d, t: shards(d), lambda runs: list(heapq.merge(*runs)), ALL),
+    Case("merge", "MinHeap", lambda d, t: shards(d), heap_merge, ALL),
+
+    # Deque vs deque
+    Case("deque.append", "Deque", empty(Deque), each("append"), ALL),
+    Case("deque.append", "deque", empty(deque), each("append"), ALL),
+    Case("deque.appendleft", "Deque", empty(Deque), each("appendleft"), ALL),
+    Case("deque.appendleft", "deque", empty(deque), each("appendleft"), ALL),
+    Case("deque.pop", "Deque", built(Deque), repeat("pop"), ALL),
+    Case("deque.pop", "deque", built(deque), repeat("pop"), ALL),
+    Case("deque.popleft", "Deque", built(Deque), repeat("popleft"), ALL),
+    Case("deque.popleft", "deque", built(deque), repeat("popleft"), ALL),
+    Case("deque.extend(array)", "Deque", lambda d, t: array("i", d), Deque, ALL),
+    Case("deque.extend(array)", "deque", lambda d, t: array("i", d), deque, ALL),
+    Case("deque.append(maxlen)", "Deque", empty(lambda: Deque(maxlen=100)), each("append"), ALL),
+    Case("deque.append(maxlen)", "deque", empty(lambda: deque(maxlen=100)), each("append"), ALL),
+    Case("deque[middle]", "Deque", built(Deque), middle_items, ALL),
+    Case("deque[middle]", "deque", built(deque), middle_items, ALL),
+
+    # DoublyLinkedList vs deque
+    Case("dllist.append", "DoublyLinkedList", empty(DoublyLinkedList), each("append"), ALL),
+    Case("dllist.append", "deque", empty(deque), each("append"), ALL),
+    Case("dllist.prepend", "DoublyLinkedList", empty(DoublyLinkedList), each("prepend"), ALL),
+    Case("dllist.prepend", "deque", empty(deque), each("appendleft"), ALL),
+    Case("dllist.pop(0)", "DoublyLinkedList", built(dll_of), repeat("pop", 0), ALL),
+    Case("dllist.pop(0)", "deque", built(deque), repeat("popleft"), ALL),
+    Case("dllist.pop(-1)", "DoublyLinkedList", built(dll_of), dll_pop_last, FEW),
+    Case("dllist.pop(-1)", "deque", built(deque), repeat("pop", limit=100), FEW),
+    Case("dllist.remove", "DoublyLinkedList", lambda d, t: (dll_of(d), d[:-101:-1]), each("remove"), FEW),
+    Case("dllist.remove", "deque", lambda d, t: (deque(d), d[:-101:-1]), each("remove"), FEW),
+
+    # LinkedList vs list as a stack
+    Case("linked_list.prepend", "LinkedList", empty(LinkedList), each("prepend"), ALL),
+    Case("linked_list.prepend", "list", empty(list), each("append"), ALL),
+    Case("linked_list.pop", "LinkedList", built(linked_list_of), repeat("pop"), ALL),
+    Case("linked_list.pop", "list", built(list), repeat("pop"), ALL),
+    Case("linked_list.peek", "LinkedList", built(linked_list_of), repeat("peek"), ALL),
+    Case("linked_list.peek", "list", built(list), repeat("__getitem__", -1), ALL),
+
+    # MonotonicIncreasingStack vs list + bisect
+    Case("mis.push", "MonotonicIncreasingStack", empty(MonotonicIncreasingStack), each("push"), ALL),
+    Case("mis.push", "bisect", empty(list), each_fn(bisect_push), ALL),
+    Case("mis.pop", "MonotonicIncreasingStack", built(mis_of), repeat("pop"), ALL),
+    Case("mis.pop", "bisect", built(sorted), repeat("pop"), ALL),
+    Case("mis.top", "MonotonicIncreasingStack", built(mis_of), repeat("top"), ALL),
+    Case("mis.top", "bisect", built(sorted), repeat("__getitem__", -1), ALL),
+    Case("mis.attach", "MonotonicIncreasingStack", shared_buffer, attached(MonotonicIncreasingStack, "push"), ALL),
+    Case("mis.attach", "bisect", empty(list), each_fn(bisect_push), ALL),
+]
+
+
+# ---------- Methods every container shares ----------
+
+def dump_to(path, container):
+    with open(path, "wb") as f:
+        container.dump(f)
+    return path
+
+
+def pickle_to(path, container):
+    with open(path, "wb") as f:
+        pickle.dump(container, f, protocol=5)
+    return path
+
+
+def load_from(cls):
+    def run(path):
+        with open(path, "rb") as f:
+            cls.load(f)
+    return run
+
+
+def unpickle_from(path):
+    with open(path, "rb") as f:
+        pickle.load(f)
+
+
+def len_1000(container):
+    for _ in range(1000):
+        len(container)
+
+
+def roundtrip(container):
+    pickle.loads(pickle.dumps(container, protocol=5))
+
+
+# (group prefix, our type, builds ours, stdlib name, builds the stdlib equivalent)
+CONTAINERS = [
+    ("heap", MinHeap, MinHeap.heapify, "heapq", heapq_of),
+    ("deque", Deque, Deque, "deque", deque),
+    ("dllist", DoublyLinkedList, dll_of, "deque", deque),
+    ("linked_list", LinkedList, linked_list_of, "list", list),
+    ("mis", MonotonicIncreasingStack, mis_of, "bisect", sorted),
+]
+
+for prefix, cls, build, stdlib, build_stdlib in CONTAINERS:
+    ours, theirs = cls.__name__, stdlib
+    CASES += [
+        Case(f"{prefix}.__len__", ours, built(build), len_1000, lambda n: 1000),
+        Case(f"{prefix}.__len__", theirs, built(build_stdlib), len_1000, lambda n: 1000),
+        Case(f"{prefix}.to_list", ours, built(build), lambda c: c.to_list(), ALL),
+        Case(f"{prefix}.to_list", theirs, built(build_stdlib), list, ALL),
+        Case(f"{prefix}.to_list(as_array)", ours, built(build), lambda c: c.to_list(as_array=True), ALL),
+        Case(f"{prefix}.to_list(as_array)", theirs, built(build_stdlib), lambda c: array("i", c), ALL),
+        Case(f"{prefix}.tobytes", ours, built(build), lambda c: c.tobytes(), ALL),
+        Case(f"{prefix}.tobytes", theirs, built(build_stdlib), lambda c: pickle.dumps(c, protocol=5), ALL),
+        Case(f"{prefix}.frombytes", ours, lambda d, t, b=build: b(d).tobytes(), cls.frombytes, ALL),
+        Case(f"{prefix}.frombytes", theirs, lambda d, t, b=build_stdlib: pickle.dumps(b(d), protocol=5),
+             pickle.loads, ALL),
+        Case(f"{prefix}.dump", ours, lambda d, t, b=build: (t / "c.bin", b(d)), lambda s: dump_to(*s), ALL),
+        Case(f"{prefix}.dump", theirs, lambda d, t, b=build_stdlib: (t / "c.pickle", b(d)),
+             lambda s: pickle_to(*s), ALL),
+        Case(f"{prefix}.load", ours, lambda d, t, b=build: dump_to(t / "c.bin", b(d)), load_from(cls), ALL),
+        Case(f"{prefix}.load", theirs, lambda d, t, b=build_stdlib: pickle_to(t / "c.pickle", b(d)),
+             unpickle_from, ALL),
+        Case(f"{prefix}.pickle", ours, built(build), roundtrip, ALL),
+        Case(f"{prefix}.pickle", theirs, built(build_stdlib), roundtrip, ALL),
+    ]
+
+
+@pytest.mark.parametrize("case", CASES, ids=lambda c: f"{c.group}-{c.impl}")
+def test_throughput(benchmark, case, data, size, tmp_path):
+    benchmark.group = f"{case.group} n={size}"
+    rounds = max(5, min(100, 1_000_000 // size))
+    benchmark.pedantic(case.run, setup=lambda: ((case.setup(data, tmp_path),), {}), rounds=rounds, warmup_rounds=1)
+
+    ops = case.ops(size)
+    median = benchmark.stats.stats.median
+    benchmark.extra_info["ops"] = ops
+    benchmark.extra_info["ops_per_s"] = ops / median if median else None
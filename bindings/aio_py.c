@@ -0,0 +1,1061 @@
+// bindings/aio_py.c
+//
+// PriorityQueue parks the tasks that wait on it on futures of the running
+// loop and wakes them from C. Its get(), put() and join() return awaitables
+// that run the retry loop of asyncio.Queue's coroutines without a Python
+// frame. TimerHeap holds the callbacks of pending timers for an event loop.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <math.h>
+#include "../src/min_heap.h"
+#include "../src/timer_heap.h"
+#include "compat.h"
+#include "memory.h"
+#include "objects.h"
+#include "stats.h"
+
+typedef struct {
+    PyObject* queue_type;      // PriorityQueue
+    PyObject* operation_type;  // PriorityQueueOperation, not exposed by the module
+    PyObject* timers_type;     // TimerHeap
+} aio_module_state;
+
+#if PY_VERSION_HEX < 0x03090000
+// 3.8 cannot find a type's module, so the operation type of the last module executed is shared
+static PyObject* PyPriorityQueue_operation_type_38;
+#endif
+
+// ---------- Waiters ----------
+
+/**
+ * @brief FIFO of the futures that tasks wait on, holding strong references.
+ */
+typedef struct {
+    PyObject** items;
+    Py_ssize_t head;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+} PyWaiters;
+
+static int PyWaiters_push(PyWaiters* waiters, PyObject* waiter) {
+    if (waiters->size == waiters->capacity) {
+        Py_ssize_t capacity = waiters->capacity ? waiters->capacity * 2 : 4;
+        PyObject** items = PyMem_Malloc(sizeof(PyObject*) * (size_t)capacity);
+        if (!items) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        for (Py_ssize_t i = 0; i < waiters->size; i++) {
+            items[i] = waiters->items[(waiters->head + i) % waiters->capacity];
+        }
+        PyMem_Free(waiters->items);
+        waiters->items = items;
+        waiters->head = 0;
+        waiters->capacity = capacity;
+    }
+
+    Py_INCREF(waiter);
+    waiters->items[(waiters->head + waiters->size) % waiters->capacity] = waiter;
+    waiters->size++;
+    return 0;
+}
+
+// Returns the list's reference to the oldest waiter, or NULL if there is none
+static PyObject* PyWaiters_pop(PyWaiters* waiters) {
+    if (waiters->size == 0) return NULL;
+
+    PyObject* waiter = waiters->items[waiters->head];
+    waiters->head = (waiters->head + 1) % waiters->capacity;
+    waiters->size--;
+    return waiter;
+}
+
+// Returns the list's reference to waiter, or NULL if it is not listed
+static PyObject* PyWaiters_remove(PyWaiters* waiters, PyObject* waiter) {
+    for (Py_ssize_t i = 0; i < waiters->size; i++) {
+        if (waiters->items[(waiters->head + i) % waiters->capacity] != waiter) continue;
+
+        for (; i + 1 < waiters->size; i++) {
+            waiters->items[(waiters->head + i) % waiters->capacity] =
+                waiters->items[(waiters->head + i + 1) % waiters->capacity];
+        }
+        waiters->size--;
+        return waiter;
+    }
+    return NULL;
+}
+
+static int PyWaiters_traverse(PyWaiters* waiters, visitproc visit, void* arg) {
+    for (Py_ssize_t i = 0; i < waiters->size; i++) {
+        Py_VISIT(waiters->items[(waiters->head + i) % waiters->capacity]);
+    }
+    return 0;
+}
+
+static void PyWaiters_clear(PyWaiters* waiters) {
+    PyObject* waiter;
+    while ((waiter = PyWaiters_pop(waiters))) Py_DECREF(waiter);
+    PyMem_Free(waiters->items);
+    waiters->items = NULL;
+    waiters->head = 0;
+    waiters->capacity = 0;
+}
+
+// Calls a method that returns a bool, such as Future.done()
+static int PyWaiters_call_bool(PyObject* obj, const char* name) {
+    PyObject* result = PyObject_CallMethod(obj, name, NULL);
+    if (!result) return -1;
+
+    int value = PyObject_IsTrue(result);
+    Py_DECREF(result);
+    return value;
+}
+
+// Resolves a waiter that is still pending; 1 if it was, 0 if it was done already
+static int PyWaiters_resolve(PyObject* waiter) {
+    int done = PyWaiters_call_bool(waiter, "done");
+    if (done != 0) return done < 0 ? -1 : 0;
+
+    PyObject* result = PyObject_CallMethod(waiter, "set_result", "O", Py_None);
+    if (!result) return -1;
+    Py_DECREF(result);
+    return 1;
+}
+
+// Raises asyncio.QueueEmpty or asyncio.QueueFull
+static PyObject* PyWaiters_raise(const char* name) {
+    PyObject* asyncio = PyImport_ImportModule("asyncio");
+    if (!asyncio) return NULL;
+
+    PyObject* exc = PyObject_GetAttrString(asyncio, name);
+    Py_DECREF(asyncio);
+    if (exc) {
+        PyErr_SetNone(exc);
+        Py_DECREF(exc);
+    }
+    return NULL;
+}
+
+// ---------- PriorityQueue ----------
+
+typedef struct {
+    PyObject_HEAD;
+    MinHeap* heap;          // Keyed by priority; the payloads are the items
+    Py_ssize_t maxsize;     // Most items before put() waits, or 0 for no limit
+    Py_ssize_t unfinished;  // Items put and not yet marked by task_done()
+    PyObject* loop;         // Loop of the first task that waited, or NULL
+    PyWaiters getters;
+    PyWaiters putters;
+    PyWaiters joiners;
+} PyPriorityQueueObject;
+
+typedef enum {
+    PY_QUEUE_GET,
+    PY_QUEUE_PUT,
+    PY_QUEUE_JOIN,
+} PyQueueOperationKind;
+
+typedef struct {
+    PyObject_HEAD;
+    PyPriorityQueueObject* queue;  // NULL once the operation has finished
+    PyObject* item;                // Item put() has yet to insert
+    PyObject* waiter;              // Future the awaiting task waits on, or NULL
+    int32_t key;
+    PyQueueOperationKind kind;
+} PyQueueOperationObject;
+
+static int PyPriorityQueue_traverse(PyPriorityQueueObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    Py_VISIT(self->loop);
+    if (self->heap) {
+        for (int i = 0; i < self->heap->size; i++) Py_VISIT((PyObject*)self->heap->payloads[i]);
+    }
+    int status = PyWaiters_traverse(&self->getters, visit, arg);
+    if (!status) status = PyWaiters_traverse(&self->putters, visit, arg);
+    if (!status) status = PyWaiters_traverse(&self->joiners, visit, arg);
+    return status;
+}
+
+// Dropping the last item keeps the heap valid, so code run by a release
+// always sees a consistent queue
+static int PyPriorityQueue_clear(PyPriorityQueueObject* self) {
+    MinHeap* heap = self->heap;
+    if (heap) {
+        while (heap->size > 0) {
+            PyObject* item = (PyObject*)heap->payloads[--heap->size];
+            Py_DECREF(item);
+        }
+    }
+    PyWaiters_clear(&self->getters);
+    PyWaiters_clear(&self->putters);
+    PyWaiters_clear(&self->joiners);
+    Py_CLEAR(self->loop);
+    return 0;
+}
+
+static void PyPriorityQueue_dealloc(PyPriorityQueueObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyPriorityQueue_clear(self);
+    min_heap_free(self->heap);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyPriorityQueue_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"maxsize", NULL};
+    Py_ssize_t maxsize = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n:PriorityQueue", kwlist, &maxsize)) return NULL;
+
+    MinHeap* heap = min_heap_create_keyed();
+    if (!heap) return PyErr_NoMemory();
+
+    PyPriorityQueueObject* self = (PyPriorityQueueObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        min_heap_free(heap);
+        return NULL;
+    }
+    self->heap = heap;
+    // Like asyncio.Queue, a maxsize of 0 or less means no limit
+    self->maxsize = maxsize > 0 ? maxsize : 0;
+    return (PyObject*)self;
+}
+
+// Items order by an int32 priority: the item itself, or a tuple's first element
+static int PyPriorityQueue_priority(PyObject* item, int32_t* key) {
+    if (PyTuple_Check(item)) {
+        PyObject* first = PyTuple_GetItem(item, 0);
+        if (!first) {
+            PyErr_SetString(PyExc_TypeError, "PriorityQueue items must be an int or a tuple that starts with one");
+            return -1;
+        }
+        item = first;
+    }
+    return pyds_as_int32(item, key);
+}
+
+// 1 if item went in, 0 if the queue is full, -1 with MemoryError set
+static int PyPriorityQueue_try_put(PyPriorityQueueObject* self, int32_t key, PyObject* item) {
+    int status;
+    Py_INCREF(item);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->maxsize > 0 && (Py_ssize_t)min_heap_length(self->heap) >= self->maxsize) {
+        status = 0;
+    } else if (self->heap->size == INT32_MAX || !min_heap_insert_keyed(self->heap, key, item)) {
+        status = -1;
+    } else {
+        self->unfinished++;
+        status = 1;
+    }
+    Py_END_CRITICAL_SECTION();
+
+    if (status <= 0) Py_DECREF(item);
+    if (status < 0) PyErr_NoMemory();
+    return status;
+}
+
+// The item with the lowest priority, or NULL without an exception if the queue is empty
+static PyObject* PyPriorityQueue_try_get(PyPriorityQueueObject* self) {
+    int key;
+    void* item = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (!min_heap_remove_keyed(self->heap, &key, &item)) item = NULL;
+    Py_END_CRITICAL_SECTION();
+
+    return (PyObject*)item;
+}
+
+// Wakes the oldest waiter that is still waiting, like asyncio.Queue._wakeup_next()
+static int PyPriorityQueue_wake(PyPriorityQueueObject* self, PyWaiters* waiters) {
+    while (1) {
+        PyObject* waiter;
+        Py_BEGIN_CRITICAL_SECTION(self);
+        waiter = PyWaiters_pop(waiters);
+        Py_END_CRITICAL_SECTION();
+        if (!waiter) return 0;
+
+        int woken = PyWaiters_resolve(waiter);
+        Py_DECREF(waiter);
+        if (woken != 0) return woken < 0 ? -1 : 0;
+    }
+}
+
+static int PyPriorityQueue_wake_all(PyPriorityQueueObject* self, PyWaiters* waiters) {
+    while (1) {
+        PyObject* waiter;
+        Py_BEGIN_CRITICAL_SECTION(self);
+        waiter = PyWaiters_pop(waiters);
+        Py_END_CRITICAL_SECTION();
+        if (!waiter) return 0;
+
+        int woken = PyWaiters_resolve(waiter);
+        Py_DECREF(waiter);
+        if (woken < 0) return -1;
+    }
+}
+
+/**
+ * @brief Adds a future of the running loop to waiters.
+ *
+ * The queue binds to the loop of the first task that waits on it, like
+ * asyncio.Queue, since futures of another loop could never be woken.
+ *
+ * @return New reference to the future, or NULL with an exception set.
+ */
+static PyObject* PyPriorityQueue_add_waiter(PyPriorityQueueObject* self, PyWaiters* waiters) {
+    PyObject* asyncio = PyImport_ImportModule("asyncio");
+    if (!asyncio) return NULL;
+    PyObject* loop = PyObject_CallMethod(asyncio, "get_running_loop", NULL);
+    Py_DECREF(asyncio);
+    if (!loop) return NULL;
+
+    int same;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (!self->loop) {
+        Py_INCREF(loop);
+        self->loop = loop;
+    }
+    same = self->loop == loop;
+    Py_END_CRITICAL_SECTION();
+
+    if (!same) {
+        Py_DECREF(loop);
+        PyErr_SetString(PyExc_RuntimeError, "PriorityQueue is bound to a different event loop");
+        return NULL;
+    }
+
+    PyObject* waiter = PyObject_CallMethod(loop, "create_future", NULL);
+    Py_DECREF(loop);
+    if (!waiter) return NULL;
+
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyWaiters_push(waiters, waiter);
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) {
+        Py_DECREF(waiter);
+        return NULL;
+    }
+    return waiter;
+}
+
+static PyObject* PyPriorityQueue_put_nowait(PyPriorityQueueObject* self, PyObject* item) {
+    int32_t key;
+    if (PyPriorityQueue_priority(item, &key) < 0) return NULL;
+
+    int status = PyPriorityQueue_try_put(self, key, item);
+    if (status < 0) return NULL;
+    if (status == 0) return PyWaiters_raise("QueueFull");
+    if (PyPriorityQueue_wake(self, &self->getters) < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyPriorityQueue_get_nowait(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* item = PyPriorityQueue_try_get(self);
+    if (!item) return PyWaiters_raise("QueueEmpty");
+
+    if (PyPriorityQueue_wake(self, &self->putters) < 0) {
+        Py_DECREF(item);
+        return NULL;
+    }
+    return item;
+}
+
+static PyObject* PyPriorityQueue_operation(PyPriorityQueueObject* self, PyQueueOperationKind kind, PyObject* item,
+                                           int32_t key) {
+#if PY_VERSION_HEX >= 0x03090000
+    PyObject* module = PyType_GetModule(Py_TYPE((PyObject*)self));
+    if (!module) return NULL;
+    PyTypeObject* type = (PyTypeObject*)((aio_module_state*)PyModule_GetState(module))->operation_type;
+#else
+    PyTypeObject* type = (PyTypeObject*)PyPriorityQueue_operation_type_38;
+#endif
+
+    PyQueueOperationObject* operation = (PyQueueOperationObject*)PyType_GenericAlloc(type, 0);
+    if (!operation) return NULL;
+
+    Py_INCREF((PyObject*)self);
+    operation->queue = self;
+    Py_XINCREF(item);
+    operation->item = item;
+    operation->key = key;
+    operation->kind = kind;
+    return (PyObject*)operation;
+}
+
+static PyObject* PyPriorityQueue_put(PyPriorityQueueObject* self, PyObject* item) {
+    int32_t key;
+    if (PyPriorityQueue_priority(item, &key) < 0) return NULL;
+    return PyPriorityQueue_operation(self, PY_QUEUE_PUT, item, key);
+}
+
+static PyObject* PyPriorityQueue_get(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyPriorityQueue_operation(self, PY_QUEUE_GET, NULL, 0);
+}
+
+static PyObject* PyPriorityQueue_join(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyPriorityQueue_operation(self, PY_QUEUE_JOIN, NULL, 0);
+}
+
+static PyObject* PyPriorityQueue_task_done(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_ssize_t unfinished;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    unfinished = self->unfinished;
+    if (unfinished > 0) self->unfinished = --unfinished;
+    else unfinished = -1;
+    Py_END_CRITICAL_SECTION();
+
+    if (unfinished < 0) {
+        PyErr_SetString(PyExc_ValueError, "task_done() called too many times");
+        return NULL;
+    }
+    if (unfinished == 0 && PyPriorityQueue_wake_all(self, &self->joiners) < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t PyPriorityQueue_length(PyPriorityQueueObject* self) {
+    int size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = min_heap_length(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyPriorityQueue_qsize(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSsize_t(PyPriorityQueue_length(self));
+}
+
+static PyObject* PyPriorityQueue_empty(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyBool_FromLong(PyPriorityQueue_length(self) == 0);
+}
+
+static PyObject* PyPriorityQueue_full(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyBool_FromLong(self->maxsize > 0 && PyPriorityQueue_length(self) >= self->maxsize);
+}
+
+static PyObject* PyPriorityQueue_get_maxsize(PyPriorityQueueObject* self, void* Py_UNUSED(closure)) {
+    return PyLong_FromSsize_t(self->maxsize);
+}
+
+static PyObject* PyPriorityQueue_sizeof(PyPriorityQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t waiters = (size_t)(self->getters.capacity + self->putters.capacity + self->joiners.capacity);
+    return PyLong_FromSize_t(sizeof(PyPriorityQueueObject) + min_heap_memory_usage(self->heap) +
+                             waiters * sizeof(PyObject*));
+}
+
+static PyGetSetDef PyPriorityQueue_getset[] = {
+    {"maxsize", (getter)PyPriorityQueue_get_maxsize, NULL, "Most items before put() waits, or 0 for no limit.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyPriorityQueue_methods[] = {
+    {"put", (PyCFunction)PyPriorityQueue_put, METH_O, "Put an item into the queue, waiting while it is full."},
+    {"get", (PyCFunction)PyPriorityQueue_get, METH_NOARGS, "Remove and return the item with the lowest priority, waiting while the queue is empty."},
+    {"put_nowait", (PyCFunction)PyPriorityQueue_put_nowait, METH_O, "Put an item into the queue without waiting."},
+    {"get_nowait", (PyCFunction)PyPriorityQueue_get_nowait, METH_NOARGS, "Remove and return the item with the lowest priority without waiting."},
+    {"join", (PyCFunction)PyPriorityQueue_join, METH_NOARGS, "Wait until every item put has been marked by task_done()."},
+    {"task_done", (PyCFunction)PyPriorityQueue_task_done, METH_NOARGS, "Mark an item taken from the queue as processed."},
+    {"qsize", (PyCFunction)PyPriorityQueue_qsize, METH_NOARGS, "Return the number of items in the queue."},
+    {"empty", (PyCFunction)PyPriorityQueue_empty, METH_NOARGS, "Return True if the queue is empty."},
+    {"full", (PyCFunction)PyPriorityQueue_full, METH_NOARGS, "Return True if the queue holds maxsize items."},
+    {"__sizeof__", (PyCFunction)PyPriorityQueue_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyPriorityQueue_slots[] = {
+    {Py_tp_doc, (void*)"Awaitable Priority Queue\n"
+        "\n"
+        "PriorityQueue(maxsize=0) is asyncio.PriorityQueue over a keyed MinHeap. Items are an int32 priority or "
+        "a tuple that starts with one, and items of equal priority come out in no particular order. The queue "
+        "belongs to the event loop of the first task that waits on it and, like asyncio.Queue, is not thread-safe.\n"
+        "\n"
+        "- put(item) -> awaitable - Put an item into the queue, waiting while it is full.\n"
+        "- get() -> awaitable - Remove and return the item with the lowest priority, waiting while the queue is empty.\n"
+        "- put_nowait(item) - Put an item into the queue, or raise asyncio.QueueFull.\n"
+        "- get_nowait() -> object - Remove and return the item with the lowest priority, or raise asyncio.QueueEmpty.\n"
+        "- join() -> awaitable - Wait until every item put has been marked by task_done().\n"
+        "- task_done() - Mark an item taken from the queue as processed.\n"
+        "- qsize() -> int, empty() -> bool, full() -> bool - The number of items, and whether it is 0 or maxsize.\n"
+        "- maxsize -> int - Most items before put() waits, or 0 for no limit.\n"},
+    {Py_tp_methods, PyPriorityQueue_methods},
+    {Py_tp_getset, PyPriorityQueue_getset},
+    {Py_tp_new, PyPriorityQueue_new},
+    {Py_tp_dealloc, PyPriorityQueue_dealloc},
+    {Py_tp_traverse, PyPriorityQueue_traverse},
+    {Py_tp_clear, PyPriorityQueue_clear},
+    {Py_sq_length, PyPriorityQueue_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyPriorityQueue_spec = {
+    .name = "pydatastructs.aio.PriorityQueue",
+    .basicsize = sizeof(PyPriorityQueueObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyPriorityQueue_slots,
+};
+
+// ---------- PriorityQueueOperation ----------
+
+static int PyQueueOperation_traverse(PyQueueOperationObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    Py_VISIT(self->queue);
+    Py_VISIT(self->item);
+    Py_VISIT(self->waiter);
+    return 0;
+}
+
+static int PyQueueOperation_clear(PyQueueOperationObject* self) {
+    Py_CLEAR(self->queue);
+    Py_CLEAR(self->item);
+    Py_CLEAR(self->waiter);
+    return 0;
+}
+
+/**
+ * @brief Finishes the operation without completing it.
+ *
+ * Its waiter leaves the queue. A waiter that was already woken passes the
+ * wakeup on to the next task, as asyncio.Queue does when a woken task is
+ * cancelled, so the item or free slot it was woken for is not stranded.
+ *
+ * @return 0, or -1 with an exception set.
+ */
+static int PyQueueOperation_abandon(PyQueueOperationObject* self) {
+    PyPriorityQueueObject* queue = self->queue;
+    PyObject* waiter = self->waiter;
+    self->queue = NULL;
+    self->waiter = NULL;
+    Py_CLEAR(self->item);
+    if (!queue || !waiter) {
+        Py_XDECREF((PyObject*)queue);
+        Py_XDECREF(waiter);
+        return 0;
+    }
+
+    PyWaiters* waiters = self->kind == PY_QUEUE_GET ? &queue->getters
+                       : self->kind == PY_QUEUE_PUT ? &queue->putters : &queue->joiners;
+    PyObject* listed;
+    Py_BEGIN_CRITICAL_SECTION(queue);
+    listed = PyWaiters_remove(waiters, waiter);
+    Py_END_CRITICAL_SECTION();
+    Py_XDECREF(listed);
+
+    // Still listed means nobody woke it
+    int status = 0;
+    if (!listed && self->kind != PY_QUEUE_JOIN) {
+        int cancelled = PyWaiters_call_bool(waiter, "cancelled");
+        int ready = self->kind == PY_QUEUE_GET ? PyPriorityQueue_length(queue) > 0
+                  : queue->maxsize == 0 || PyPriorityQueue_length(queue) < queue->maxsize;
+        if (cancelled < 0) status = -1;
+        else if (!cancelled && ready) status = PyPriorityQueue_wake(queue, waiters);
+    }
+    if (status == 0) {
+        PyObject* result = PyObject_CallMethod(waiter, "cancel", NULL);
+        if (result) Py_DECREF(result);
+        else status = -1;
+    }
+
+    Py_DECREF(queue);
+    Py_DECREF(waiter);
+    return status;
+}
+
+static void PyQueueOperation_dealloc(PyQueueOperationObject* self) {
+    PyObject_GC_UnTrack(self);
+    if (self->waiter) {
+        // Dropped while waiting, as when its task is destroyed
+#if PY_VERSION_HEX >= 0x030C0000
+        PyObject* exc = PyErr_GetRaisedException();
+        if (PyQueueOperation_abandon(self) < 0) PyErr_WriteUnraisable(NULL);
+        PyErr_SetRaisedException(exc);
+#else
+        PyObject *type, *value, *traceback;
+        PyErr_Fetch(&type, &value, &traceback);
+        if (PyQueueOperation_abandon(self) < 0) PyErr_WriteUnraisable(NULL);
+        PyErr_Restore(type, value, traceback);
+#endif
+    }
+    PyQueueOperation_clear(self);
+    pyds_type_free((PyObject*)self);
+}
+
+/**
+ * @brief Runs the operation until it completes or has to wait.
+ *
+ * Every resumption retries from the start: a wakeup only means the queue
+ * changed, and another task may have taken the item or slot first, in which
+ * case the operation waits again at the back of the line.
+ *
+ * @return 1 with a new reference to the future to wait on in *result, 0 with
+ * the operation's value in *result, or -1 with an exception set.
+ */
+static int PyQueueOperation_step(PyQueueOperationObject* self, PyObject** result) {
+    PyPriorityQueueObject* queue = self->queue;
+    if (!queue) {
+        PyErr_SetString(PyExc_RuntimeError, "cannot reuse already awaited PriorityQueue operation");
+        return -1;
+    }
+    Py_CLEAR(self->waiter);
+
+    PyWaiters* waiters;
+    PyObject* value = NULL;
+    int status = 0;
+    if (self->kind == PY_QUEUE_GET) {
+        value = PyPriorityQueue_try_get(queue);
+        if (value) status = PyPriorityQueue_wake(queue, &queue->putters);
+        waiters = &queue->getters;
+    } else if (self->kind == PY_QUEUE_PUT) {
+        status = PyPriorityQueue_try_put(queue, self->key, self->item);
+        if (status > 0) {
+            Py_INCREF(Py_None);
+            value = Py_None;
+            status = PyPriorityQueue_wake(queue, &queue->getters);
+        }
+        waiters = &queue->putters;
+    } else {
+        Py_ssize_t unfinished;
+        Py_BEGIN_CRITICAL_SECTION(queue);
+        unfinished = queue->unfinished;
+        Py_END_CRITICAL_SECTION();
+
+        if (unfinished == 0) {
+            Py_INCREF(Py_None);
+            value = Py_None;
+        }
+        waiters = &queue->joiners;
+    }
+
+    if (value || status < 0) {
+        self->queue = NULL;
+        Py_CLEAR(self->item);
+        Py_DECREF(queue);
+        if (status < 0) {
+            Py_XDECREF(value);
+            return -1;
+        }
+        *result = value;
+        return 0;
+    }
+
+    PyObject* waiter = PyPriorityQueue_add_waiter(queue, waiters);
+    if (!waiter) {
+        self->queue = NULL;
+        Py_CLEAR(self->item);
+        Py_DECREF(queue);
+        return -1;
+    }
+    // Task only accepts futures that ask to be waited on
+    if (PyObject_SetAttrString(waiter, "_asyncio_future_blocking", Py_True) < 0) {
+        self->waiter = waiter;
+        PyQueueOperation_abandon(self);
+        return -1;
+    }
+
+    Py_INCREF(waiter);
+    self->waiter = waiter;
+    *result = waiter;
+    return 1;
+}
+
+// Ends the iteration with value as the result of the await
+static PyObject* PyQueueOperation_return(PyObject* value) {
+    if (value == Py_None) {
+        PyErr_SetNone(PyExc_StopIteration);
+    } else {
+        // A tuple passed to PyErr_SetObject() would become the exception's arguments
+        PyObject* stop = PyObject_CallFunctionObjArgs(PyExc_StopIteration, value, NULL);
+        if (stop) {
+            PyErr_SetObject(PyExc_StopIteration, stop);
+            Py_DECREF(stop);
+        }
+    }
+    Py_DECREF(value);
+    return NULL;
+}
+
+static PyObject* PyQueueOperation_iternext(PyQueueOperationObject* self) {
+    PyObject* result;
+    int status = PyQueueOperation_step(self, &result);
+    if (status < 0) return NULL;
+    if (status == 0) return PyQueueOperation_return(result);
+    return result;
+}
+
+static PyObject* PyQueueOperation_send(PyQueueOperationObject* self, PyObject* Py_UNUSED(value)) {
+    return PyQueueOperation_iternext(self);
+}
+
+#if PY_VERSION_HEX >= 0x030A0000
+// Task steps through am_send, which returns the result without raising StopIteration
+static PySendResult PyQueueOperation_am_send(PyQueueOperationObject* self, PyObject* Py_UNUSED(value),
+                                             PyObject** result) {
+    int status = PyQueueOperation_step(self, result);
+    if (status < 0) {
+        *result = NULL;
+        return PYGEN_ERROR;
+    }
+    return status ? PYGEN_NEXT : PYGEN_RETURN;
+}
+#endif
+
+static PyObject* PyQueueOperation_throw(PyQueueOperationObject* self, PyObject* args) {
+    PyObject* type;
+    PyObject* value = NULL;
+    PyObject* traceback = NULL;
+    if (!PyArg_UnpackTuple(args, "throw", 1, 3, &type, &value, &traceback)) return NULL;
+    if (PyQueueOperation_abandon(self) < 0) return NULL;
+
+    if (PyExceptionInstance_Check(type)) {
+        if (traceback && traceback != Py_None && PyException_SetTraceback(type, traceback) < 0) return NULL;
+        PyErr_SetObject((PyObject*)Py_TYPE(type), type);
+    } else if (PyExceptionClass_Check(type)) {
+        PyErr_SetObject(type, value ? value : Py_None);
+    } else {
+        PyErr_SetString(PyExc_TypeError, "exceptions must be classes or instances deriving from BaseException");
+    }
+    return NULL;
+}
+
+static PyObject* PyQueueOperation_close(PyQueueOperationObject* self, PyObject* Py_UNUSED(ignored)) {
+    if (PyQueueOperation_abandon(self) < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyQueueOperation_await(PyQueueOperationObject* self) {
+    Py_INCREF((PyObject*)self);
+    return (PyObject*)self;
+}
+
+static PyMethodDef PyQueueOperation_methods[] = {
+    {"send", (PyCFunction)PyQueueOperation_send, METH_O, "Resume the operation."},
+    {"throw", (PyCFunction)PyQueueOperation_throw, METH_VARARGS, "Abandon the operation and raise the exception."},
+    {"close", (PyCFunction)PyQueueOperation_close, METH_NOARGS, "Abandon the operation."},
+    {NULL}
+};
+
+static PyType_Slot PyQueueOperation_slots[] = {
+    {Py_tp_doc, (void*)"A pending PriorityQueue get(), put() or join(), to await once."},
+    {Py_tp_methods, PyQueueOperation_methods},
+    {Py_tp_iternext, PyQueueOperation_iternext},
+    {Py_am_await, PyQueueOperation_await},
+#if PY_VERSION_HEX >= 0x030A0000
+    {Py_am_send, PyQueueOperation_am_send},
+#endif
+    {Py_tp_dealloc, PyQueueOperation_dealloc},
+    {Py_tp_traverse, PyQueueOperation_traverse},
+    {Py_tp_clear, PyQueueOperation_clear},
+    {0, NULL}
+};
+
+static PyType_Spec PyQueueOperation_spec = {
+    .name = "pydatastructs.aio.PriorityQueueOperation",
+    .basicsize = sizeof(PyQueueOperationObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyQueueOperation_slots,
+};
+
+// ---------- TimerHeap ----------
+
+// Payloads pop_expired() moves per call into the core
+#define PY_TIMER_HEAP_BATCH 64
+
+typedef struct {
+    PyObject_HEAD;
+    timer_heap_t* timers;  // Payloads are the callbacks
+} PyTimerHeapObject;
+
+static int PyTimerHeap_traverse(PyTimerHeapObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    timer_heap_t* timers = self->timers;
+    if (timers) {
+        for (uint32_t i = 0; i < timers->size; i++) Py_VISIT((PyObject*)timers->payloads[timers->heap[i].slot]);
+    }
+    return 0;
+}
+
+// Empties the heap before releasing the callbacks, so code run by a release
+// sees an empty heap
+static int PyTimerHeap_clear(PyTimerHeapObject* self) {
+    timer_heap_t* timers = self->timers;
+    if (!timers || timers->size == 0) return 0;
+
+    PyObject** callbacks = PyMem_Malloc(sizeof(PyObject*) * timers->size);
+    if (!callbacks) {
+        // Release them in deadline order instead
+        void* callback;
+        while (timer_heap_pop_expired(timers, INFINITY, &callback, 1)) Py_DECREF((PyObject*)callback);
+        return 0;
+    }
+
+    uint32_t count = timers->size;
+    for (uint32_t i = 0; i < count; i++) callbacks[i] = (PyObject*)timers->payloads[timers->heap[i].slot];
+    timer_heap_clear(timers);
+    for (uint32_t i = 0; i < count; i++) Py_DECREF(callbacks[i]);
+    PyMem_Free(callbacks);
+    return 0;
+}
+
+static void PyTimerHeap_dealloc(PyTimerHeapObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyTimerHeap_clear(self);
+    timer_heap_free(self->timers);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyTimerHeap_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    Py_ssize_t nargs = PyTuple_Size(args);
+    if (pyds_check_no_args(type, nargs, kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+
+    timer_heap_t* timers = timer_heap_create();
+    if (!timers) return PyErr_NoMemory();
+
+    PyTimerHeapObject* self = (PyTimerHeapObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        timer_heap_free(timers);
+        return NULL;
+    }
+    self->timers = timers;
+    return (PyObject*)self;
+}
+
+static PyObject* PyTimerHeap_schedule(PyTimerHeapObject* self, PyObject* args) {
+    double when;
+    PyObject* callback;
+
+    if (!PyArg_ParseTuple(args, "dO:schedule", &when, &callback)) return NULL;
+    if (isnan(when)) {
+        PyErr_SetString(PyExc_ValueError, "when must not be NaN");
+        return NULL;
+    }
+
+    char scheduled;
+    uint64_t handle;
+    Py_INCREF(callback);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    scheduled = timer_heap_schedule(self->timers, when, callback, &handle);
+    Py_END_CRITICAL_SECTION();
+
+    if (!scheduled) {
+        Py_DECREF(callback);
+        return PyErr_NoMemory();
+    }
+    return PyLong_FromUnsignedLongLong(handle);
+}
+
+static PyObject* PyTimerHeap_cancel(PyTimerHeapObject* self, PyObject* arg) {
+    unsigned long long handle = PyLong_AsUnsignedLongLong(arg);
+    if (handle == (unsigned long long)-1 && PyErr_Occurred()) {
+        // No timer has a negative or oversized handle
+        if (!PyErr_ExceptionMatches(PyExc_OverflowError)) return NULL;
+        PyErr_Clear();
+        Py_RETURN_FALSE;
+    }
+
+    char cancelled;
+    void* callback;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    cancelled = timer_heap_cancel(self->timers, (uint64_t)handle, &callback);
+    Py_END_CRITICAL_SECTION();
+
+    if (!cancelled) Py_RETURN_FALSE;
+    Py_DECREF((PyObject*)callback);
+    Py_RETURN_TRUE;
+}
+
+static PyObject* PyTimerHeap_pop_expired(PyTimerHeapObject* self, PyObject* arg) {
+    double now = PyFloat_AsDouble(arg);
+    if (now == -1.0 && PyErr_Occurred()) return NULL;
+
+    PyObject* result = PyList_New(0);
+    if (!result) return NULL;
+
+    // The callbacks come out in batches, and each batch is in the list
+    // before any reference is dropped
+    void* batch[PY_TIMER_HEAP_BATCH];
+    size_t count;
+    do {
+        Py_BEGIN_CRITICAL_SECTION(self);
+        count = timer_heap_pop_expired(self->timers, now, batch, PY_TIMER_HEAP_BATCH);
+        Py_END_CRITICAL_SECTION();
+
+        int status = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (status == 0) status = PyList_Append(result, (PyObject*)batch[i]);
+            Py_DECREF((PyObject*)batch[i]);
+        }
+        if (status < 0) {
+            Py_DECREF(result);
+            return NULL;
+        }
+    } while (count == PY_TIMER_HEAP_BATCH);
+
+    return result;
+}
+
+static PyObject* PyTimerHeap_clear_method(PyTimerHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyTimerHeap_clear(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyTimerHeap_get_next_deadline(PyTimerHeapObject* self, void* Py_UNUSED(closure)) {
+    double deadline;
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    found = timer_heap_peek(self->timers, &deadline, NULL);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) Py_RETURN_NONE;
+    return PyFloat_FromDouble(deadline);
+}
+
+static Py_ssize_t PyTimerHeap_length(PyTimerHeapObject* self) {
+    uint32_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = self->timers->size;
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyTimerHeap_sizeof(PyTimerHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSize_t(sizeof(PyTimerHeapObject) + timer_heap_memory_usage(self->timers));
+}
+
+static PyGetSetDef PyTimerHeap_getset[] = {
+    {"next_deadline", (getter)PyTimerHeap_get_next_deadline, NULL, "Deadline of the earliest pending timer, or None.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyTimerHeap_methods[] = {
+    {"schedule", (PyCFunction)PyTimerHeap_schedule, METH_VARARGS, "Add a timer that expires at when and return its handle."},
+    {"cancel", (PyCFunction)PyTimerHeap_cancel, METH_O, "Remove a pending timer by handle and return whether it was pending."},
+    {"pop_expired", (PyCFunction)PyTimerHeap_pop_expired, METH_O, "Remove the timers that expire at or before now and return their callbacks, earliest first."},
+    {"clear", (PyCFunction)PyTimerHeap_clear_method, METH_NOARGS, "Remove every timer."},
+    {"__sizeof__", (PyCFunction)PyTimerHeap_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyTimerHeap_slots[] = {
+    {Py_tp_doc, (void*)"Timer Heap\n"
+        "\n"
+        "TimerHeap() keeps the callbacks of pending timers by deadline, for an event loop's scheduler. Cancelling "
+        "removes a timer at once in O(log n) instead of leaving it in the heap until it expires, and the callbacks "
+        "of every expired timer come out of one call. Timers with equal deadlines expire in no particular order.\n"
+        "\n"
+        "- schedule(when: float, callback) -> int - Add a timer that expires at when and return its handle.\n"
+        "- cancel(handle: int) -> bool - Remove a pending timer and return whether it was pending.\n"
+        "- pop_expired(now: float) -> list - Remove the timers that expire at or before now and return their callbacks, earliest first.\n"
+        "- clear() - Remove every timer.\n"
+        "- next_deadline -> Optional[float] - Deadline of the earliest pending timer.\n"},
+    {Py_tp_methods, PyTimerHeap_methods},
+    {Py_tp_getset, PyTimerHeap_getset},
+    {Py_tp_new, PyTimerHeap_new},
+    {Py_tp_dealloc, PyTimerHeap_dealloc},
+    {Py_tp_traverse, PyTimerHeap_traverse},
+    {Py_tp_clear, PyTimerHeap_clear},
+    {Py_sq_length, PyTimerHeap_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyTimerHeap_spec = {
+    .name = "pydatastructs.aio.TimerHeap",
+    .basicsize = sizeof(PyTimerHeapObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyTimerHeap_slots,
+};
+
+// ---------- Module ----------
+
+// Registering the operations as coroutines lets asyncio.create_task() and
+// asyncio.run() take them directly
+static int aio_register_coroutine(PyObject* type) {
+    PyObject* abc = PyImport_ImportModule("collections.abc");
+    if (!abc) return -1;
+
+    PyObject* coroutine = PyObject_GetAttrString(abc, "Coroutine");
+    PyObject* result = coroutine ? PyObject_CallMethod(coroutine, "register", "O", type) : NULL;
+    Py_XDECREF(coroutine);
+    Py_DECREF(abc);
+    if (!result) return -1;
+    Py_DECREF(result);
+    return 0;
+}
+
+static int aio_module_exec(PyObject* m) {
+    aio_module_state* state = PyModule_GetState(m);
+    state->queue_type = pyds_add_type(m, &PyPriorityQueue_spec, NULL);
+    if (!state->queue_type) return -1;
+    state->timers_type = pyds_add_type(m, &PyTimerHeap_spec, NULL);
+    if (!state->timers_type) return -1;
+
+#if PY_VERSION_HEX >= 0x03090000
+    state->operation_type = PyType_FromModuleAndSpec(m, &PyQueueOperation_spec, NULL);
+    if (!state->operation_type) return -1;
+#else
+    state->operation_type = PyType_FromSpec(&PyQueueOperation_spec);
+    if (!state->operation_type) return -1;
+    Py_INCREF(state->operation_type);
+    Py_XSETREF(PyPriorityQueue_operation_type_38, state->operation_type);
+#endif
+    if (aio_register_coroutine(state->operation_type) < 0) return -1;
+
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int aio_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    aio_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->queue_type);
+        Py_VISIT(state->operation_type);
+        Py_VISIT(state->timers_type);
+    }
+    return 0;
+}
+
+static int aio_module_clear(PyObject* m) {
+    aio_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->queue_type);
+        Py_CLEAR(state->operation_type);
+        Py_CLEAR(state->timers_type);
+    }
+    return 0;
+}
+
+static void aio_module_free(void* m) {
+    aio_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot aio_module_slots[] = {
+    {Py_mod_exec, (void*)aio_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef aio_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "aio",
+    .m_doc = "This module exposes an asyncio priority queue and a timer heap "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(aio_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = aio_module_slots,
+    .m_traverse = aio_module_traverse,
+    .m_clear = aio_module_clear,
+    .m_free = aio_module_free,
+};
+
+PyMODINIT_FUNC PyInit_aio(void) {
+    return PyModuleDef_Init(&aio_module);
+}
@@ -0,0 +1,161 @@
+// bindings/boxing.h
+
+#ifndef PYDS_BOXING_H
+#define PYDS_BOXING_H
+
+/**
+ * @file boxing.h
+ * @brief Builds Python results from the int32 values of a container.
+ *
+ * Results are built from the same pyds_fill_fn cursors that serialization
+ * uses, one stack chunk at a time. Lists are allocated at their final size
+ * and filled with PyList_SET_ITEM. Small values already come from the
+ * interpreter's int cache, and a run of equal values shares one int object.
+ * For large results, as_array=True returns an array('i') that holds the raw
+ * values and boxes nothing.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include "compat.h"
+#include "serialize.h"
+
+#define PYDS_BOX_CHUNK 1024
+
+/**
+ * @brief Builds a list of count values read from fill.
+ */
+static inline PyObject* pyds_list_from_fill(Py_ssize_t count, pyds_fill_fn fill, void* ctx) {
+    PyObject* list = PyList_New(count);
+    if (!list) return NULL;
+
+    int32_t chunk[PYDS_BOX_CHUNK];
+    PyObject* previous = NULL;
+    int32_t previous_value = 0;
+    Py_ssize_t written = 0;
+    while (written < count) {
+        Py_ssize_t n = fill(ctx, chunk, Py_MIN(count - written, (Py_ssize_t)PYDS_BOX_CHUNK));
+        if (n <= 0) break;
+
+        for (Py_ssize_t i = 0; i < n; i++) {
+            PyObject* item;
+            if (previous && previous_value == chunk[i]) {
+                item = previous;
+                Py_INCREF(item);
+            } else {
+                item = PyLong_FromLong(chunk[i]);
+                if (!item) {
+                    Py_DECREF(list);
+                    return NULL;
+                }
+            }
+            PYDS_LIST_SET_ITEM(list, written++, item);
+            previous = item;
+            previous_value = chunk[i];
+        }
+    }
+
+    if (written != count) {
+        Py_DECREF(list);
+        PyErr_SetString(PyExc_RuntimeError, "container changed size during conversion");
+        return NULL;
+    }
+    return list;
+}
+
+/**
+ * @brief Builds an array('i') of count values read from fill.
+ *
+ * The array is created at its final size by repeating a one-element array,
+ * then filled in place through its buffer, so the values are copied once.
+ */
+static inline PyObject* pyds_array_from_fill(Py_ssize_t count, pyds_fill_fn fill, void* ctx) {
+    PyObject* module = PyImport_ImportModule("array");
+    if (!module) return NULL;
+
+    PyObject* unit = PyObject_CallMethod(module, "array", "s(i)", "i", 0);
+    Py_DECREF(module);
+    if (!unit) return NULL;
+
+    PyObject* result = PySequence_Repeat(unit, count);
+    Py_DECREF(unit);
+    if (!result) return NULL;
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(result, &view, PyBUF_WRITABLE | PyBUF_FORMAT) < 0) {
+        Py_DECREF(result);
+        return NULL;
+    }
+    if (view.itemsize != (Py_ssize_t)sizeof(int32_t)) {
+        PyBuffer_Release(&view);
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_SystemError, "array('i') items are not 32-bit on this platform");
+        return NULL;
+    }
+
+    int32_t* out = (int32_t*)view.buf;
+    Py_ssize_t written = 0;
+    while (written < count) {
+        Py_ssize_t n = fill(ctx, out + written, count - written);
+        if (n <= 0) break;
+        written += n;
+    }
+    PyBuffer_Release(&view);
+
+    if (written != count) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_RuntimeError, "container changed size during conversion");
+        return NULL;
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the values as a list, or as an array('i') if as_array is set.
+ */
+static inline PyObject* pyds_int32_result(Py_ssize_t count, pyds_fill_fn fill, void* ctx, int as_array) {
+    return as_array ? pyds_array_from_fill(count, fill, ctx) : pyds_list_from_fill(count, fill, ctx);
+}
+
+/**
+ * @brief Parses the arguments of to_list(as_array=False).
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_parse_as_array(PyObject* args, PyObject* kwargs, int* as_array) {
+    static char* kwlist[] = {"as_array", NULL};
+
+    *as_array = 0;
+    return PyArg_ParseTupleAndKeywords(args, kwargs, "|p:to_list", kwlist, as_array) ? 0 : -1;
+}
+
+/**
+ * @brief Gets a C-contiguous buffer of native int32 values, such as an
+ * array('i') or a numpy int32 array, so bulk methods can copy it directly.
+ * @param flags Extra request flags, such as PyBUF_WRITABLE.
+ * @return 1 with view filled, 0 if obj has no such buffer (nothing to
+ * release, no exception), or -1 with an exception set.
+ */
+static inline int pyds_get_int32_buffer_flags(PyObject* obj, Py_buffer* view, int flags) {
+    if (!PyObject_CheckBuffer(obj)) return 0;
+    if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS | flags) < 0) {
+        if (!PyErr_ExceptionMatches(PyExc_BufferError)) return -1;
+        PyErr_Clear();
+        return 0;
+    }
+
+    // Native or explicit little/big-endian order matching this machine, then 'i' or a 32-bit 'l'
+    const char* format = view->format ? view->format : "B";
+    if (*format == '@' || *format == '=' || *format == (PY_LITTLE_ENDIAN ? '<' : '>')) format++;
+    if (view->itemsize == (Py_ssize_t)sizeof(int32_t) && (format[0] == 'i' || format[0] == 'l') && !format[1]) {
+        return 1;
+    }
+    PyBuffer_Release(view);
+    return 0;
+}
+
+static inline int pyds_get_int32_buffer(PyObject* obj, Py_buffer* view) {
+    return pyds_get_int32_buffer_flags(obj, view, 0);
+}
+
+#endif // PYDS_BOXING_H
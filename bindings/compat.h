@@ -0,0 +1,220 @@
+// bindings/compat.h
+
+#ifndef PYDS_COMPAT_H
+#define PYDS_COMPAT_H
+
+/**
+ * @file compat.h
+ * @brief Shims for CPython APIs that only exist on newer interpreters.
+ *
+ * Free-threaded builds (PEP 703, Py_GIL_DISABLED) run methods of one object
+ * from several threads at once. Every method that touches the C structure
+ * of a container runs inside Py_BEGIN_CRITICAL_SECTION(self), which locks
+ * the object's per-object mutex there and compiles to a plain block on
+ * builds with a GIL.
+ *
+ * Hot methods take their int argument as METH_O and unbox it with
+ * pyds_as_int32() instead of building an argument tuple for
+ * PyArg_ParseTuple. Constructors are exposed through tp_vectorcall where
+ * the interpreter calls it (3.9+).
+ *
+ * Types are heap types created from a PyType_Spec when the module executes,
+ * and each module keeps its type in per-module state, so every interpreter
+ * that imports a module gets its own copy (PEP 489, PEP 684). Everything
+ * here also compiles under Py_LIMITED_API (3.11+), which drops the
+ * vectorcall constructors and the compact-int fast path.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef Py_BEGIN_CRITICAL_SECTION
+#define Py_BEGIN_CRITICAL_SECTION(op) {
+#define Py_END_CRITICAL_SECTION() }
+#endif
+
+#ifndef Py_BEGIN_CRITICAL_SECTION2
+#define Py_BEGIN_CRITICAL_SECTION2(a, b) {
+#define Py_END_CRITICAL_SECTION2() }
+#endif
+
+#if PY_VERSION_HEX >= 0x03090000 && !defined(Py_LIMITED_API)
+#define PYDS_HAVE_TYPE_VECTORCALL 1
+#endif
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+#define PYDS_VECTORCALL(fn) ((void*)(fn))
+#else
+#define PYDS_VECTORCALL(fn) NULL
+#endif
+
+#ifdef Py_LIMITED_API
+#define PYDS_LIST_SET_ITEM(list, index, item) PyList_SetItem(list, index, item)
+#else
+#define PYDS_LIST_SET_ITEM(list, index, item) PyList_SET_ITEM(list, index, item)
+#endif
+
+#ifdef Py_TPFLAGS_IMMUTABLETYPE
+#define PYDS_TPFLAGS_DEFAULT (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE)
+#else
+#define PYDS_TPFLAGS_DEFAULT Py_TPFLAGS_DEFAULT
+#endif
+
+/**
+ * @brief Converts an int argument to int32_t with the same rules and errors
+ * as the "i" format of PyArg_ParseTuple.
+ *
+ * On 3.12+ exact ints that fit in a machine word are read straight from the
+ * object; everything else goes through PyLong_AsLong, which honours __index__.
+ *
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_as_int32(PyObject* obj, int32_t* out) {
+    long value;
+#if PY_VERSION_HEX >= 0x030C0000 && !defined(Py_LIMITED_API)
+    if (PyLong_CheckExact(obj) && PyUnstable_Long_IsCompact((PyLongObject*)obj)) {
+        Py_ssize_t compact = PyUnstable_Long_CompactValue((PyLongObject*)obj);
+        if (compact >= INT32_MIN && compact <= INT32_MAX) {
+            *out = (int32_t)compact;
+            return 0;
+        }
+    }
+#endif
+    if (PyFloat_Check(obj)) {
+        PyErr_SetString(PyExc_TypeError, "integer argument expected, got float");
+        return -1;
+    }
+
+    value = PyLong_AsLong(obj);
+    if (value == -1 && PyErr_Occurred()) return -1;
+    if (value > INT32_MAX) {
+        PyErr_SetString(PyExc_OverflowError, "signed integer is greater than maximum");
+        return -1;
+    }
+    if (value < INT32_MIN) {
+        PyErr_SetString(PyExc_OverflowError, "signed integer is less than minimum");
+        return -1;
+    }
+
+    *out = (int32_t)value;
+    return 0;
+}
+
+/**
+ * @brief Rejects arguments passed to a constructor that takes none.
+ * @return 0 if there were no arguments, -1 with TypeError set otherwise.
+ */
+static inline int pyds_check_no_args(PyTypeObject* type, Py_ssize_t nargs, Py_ssize_t nkwargs) {
+    if (nargs == 0 && nkwargs == 0) return 0;
+
+    PyObject* name = PyObject_GetAttrString((PyObject*)type, "__name__");
+    if (name) {
+        PyErr_Format(PyExc_TypeError, "%U() takes no arguments", name);
+        Py_DECREF(name);
+    }
+    return -1;
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+/**
+ * @brief Calls tp_new with the tuple and dict a vectorcall constructor was
+ * spared, for constructors whose fast path only covers the common call.
+ */
+static inline PyObject* pyds_vectorcall_new(PyTypeObject* type, PyObject* const* args, size_t nargsf,
+                                            PyObject* kwnames, newfunc tp_new) {
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    PyObject* tuple = PyTuple_New(nargs);
+    if (!tuple) return NULL;
+    for (Py_ssize_t i = 0; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(tuple, i, args[i]);
+    }
+
+    PyObject* kwargs = kwnames ? PyDict_New() : NULL;
+    if (kwnames && !kwargs) {
+        Py_DECREF(tuple);
+        return NULL;
+    }
+    for (Py_ssize_t i = 0; kwnames && i < PyTuple_GET_SIZE(kwnames); i++) {
+        if (PyDict_SetItem(kwargs, PyTuple_GET_ITEM(kwnames, i), args[nargs + i]) < 0) {
+            Py_DECREF(tuple);
+            Py_DECREF(kwargs);
+            return NULL;
+        }
+    }
+
+    PyObject* result = tp_new(type, tuple, kwargs);
+    Py_DECREF(tuple);
+    Py_XDECREF(kwargs);
+    return result;
+}
+#endif
+
+/**
+ * @brief Frees an instance of a heap type and drops its reference to the type.
+ */
+static inline void pyds_type_free(PyObject* self) {
+    PyTypeObject* type = Py_TYPE(self);
+    freefunc tp_free = (freefunc)PyType_GetSlot(type, Py_tp_free);
+    tp_free(self);
+    Py_DECREF(type);
+}
+
+/**
+ * @brief Creates a heap type from spec and adds it to module.
+ *
+ * vectorcall comes from PYDS_VECTORCALL(), so it is NULL where type
+ * vectorcall is unavailable.
+ *
+ * @return New reference to the type, or NULL with an exception set.
+ */
+static inline PyObject* pyds_add_type(PyObject* module, PyType_Spec* spec, void* vectorcall) {
+#if PY_VERSION_HEX >= 0x03090000
+    PyObject* type = PyType_FromModuleAndSpec(module, spec, NULL);
+#else
+    PyObject* type = PyType_FromSpec(spec);
+#endif
+    if (!type) return NULL;
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+    ((PyTypeObject*)type)->tp_vectorcall = (vectorcallfunc)vectorcall;
+#else
+    (void)vectorcall;
+#endif
+
+    const char* name = strrchr(spec->name, '.');
+    Py_INCREF(type);
+    if (PyModule_AddObject(module, name ? name + 1 : spec->name, type) < 0) {
+        Py_DECREF(type);
+        Py_DECREF(type);
+        return NULL;
+    }
+    return type;
+}
+
+/**
+ * @brief Module slots shared by every extension, after its Py_mod_exec slot.
+ *
+ * The modules keep no global state, so each interpreter may run with its own
+ * GIL, and free-threaded builds may keep the GIL disabled.
+ */
+#ifdef Py_mod_multiple_interpreters
+#define PYDS_MOD_MULTIPLE_INTERPRETERS_SLOT {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+#else
+#define PYDS_MOD_MULTIPLE_INTERPRETERS_SLOT
+#endif
+
+#ifdef Py_mod_gil
+#define PYDS_MOD_GIL_SLOT {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+#else
+#define PYDS_MOD_GIL_SLOT
+#endif
+
+#define PYDS_MODULE_SLOTS \
+    PYDS_MOD_MULTIPLE_INTERPRETERS_SLOT \
+    PYDS_MOD_GIL_SLOT \
+    {0, NULL}
+
+#endif // PYDS_COMPAT_H
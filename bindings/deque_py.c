@@ -0,0 +1,782 @@
+// bindings/deque_py.c
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/deque.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "serialize.h"
+#include "stats.h"
+
+typedef struct {
+    PyObject_HEAD;
+    deque_t* deque;
+    Py_ssize_t exports;  // Live buffer exports; the storage must not move while there are any
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
+} PyDequeObject;
+
+static PyObject* PyDeque_set_error(dyn_array_status_t status) {
+    if (status == DYN_ARRAY_ERROR_NO_MEMORY) return PyErr_NoMemory();
+
+    PyErr_SetString(PyExc_RuntimeError, "Deque operation failed");
+    return NULL;
+}
+
+static PyObject* PyDeque_exported_error(void) {
+    PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+    return NULL;
+}
+
+// Called inside the critical section of self
+static inline int PyDeque_can_add(PyDequeObject* self, size_t count) {
+    return self->exports == 0 || deque_fits(self->deque, count);
+}
+
+// maxlen=None means unbounded
+static int PyDeque_parse_maxlen(PyObject* arg, size_t* maxlen) {
+    if (!arg || arg == Py_None) {
+        *maxlen = DEQUE_UNBOUNDED;
+        return 0;
+    }
+
+    Py_ssize_t value = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if (value == -1 && PyErr_Occurred()) return -1;
+    if (value < 0) {
+        PyErr_SetString(PyExc_ValueError, "maxlen must be non-negative");
+        return -1;
+    }
+
+    *maxlen = (size_t)value;
+    return 0;
+}
+
+static void PyDeque_dealloc(PyDequeObject* self) {
+    deque_destroy(self->deque);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyDeque_alloc(PyTypeObject* type, size_t maxlen) {
+    PyDequeObject* self;
+    self = (PyDequeObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
+    self->deque = deque_create(maxlen);
+    if (!self->deque) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject*)self;
+}
+
+/**
+ * @brief Adds count values at one end. Called inside the critical section
+ * of self.
+ *
+ * values may point into the deque's own storage through a segment; they are
+ * copied first, since a bounded deque overwrites the slots it drops.
+ *
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static int PyDeque_add(PyDequeObject* self, const int32_t* values, size_t count, int front) {
+    if (!PyDeque_can_add(self, count)) {
+        PyDeque_exported_error();
+        return -1;
+    }
+
+    int32_t* copy = NULL;
+#ifndef DYNAMIC_ARRAY_SEGMENTED
+    uintptr_t start = (uintptr_t)self->deque->storage.data;
+    uintptr_t end = start + self->deque->storage.capacity * sizeof(int32_t);
+    if ((uintptr_t)values < end && (uintptr_t)(values + count) > start) {
+        copy = PyMem_Malloc(count * sizeof(int32_t));
+        if (!copy) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(copy, values, count * sizeof(int32_t));
+        values = copy;
+    }
+#endif
+
+    dyn_array_status_t status;
+    PYDS_TIMED(self, status = front ? deque_extend_front(self->deque, values, count)
+                                    : deque_extend_back(self->deque, values, count));
+    PyMem_Free(copy);
+    if (status != DYN_ARRAY_OK) {
+        PyDeque_set_error(status);
+        return -1;
+    }
+    return 0;
+}
+
+static int PyDeque_add_locked(PyDequeObject* self, const int32_t* values, size_t count, int front) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyDeque_add(self, values, count, front);
+    Py_END_CRITICAL_SECTION();
+
+    return status;
+}
+
+// Copies the values front to back; the caller frees *values with PyMem_Free
+static int PyDeque_snapshot(PyDequeObject* self, int32_t** values, size_t* size) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    *size = deque_size(self->deque);
+    *values = PyMem_Malloc((*size + 1) * sizeof(int32_t));
+    for (size_t i = 0; *values && i < *size; i++) {
+        (*values)[i] = *deque_slot(self->deque, i);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    if (!*values) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Adds the values of iterable at one end, like extend() and
+ * extendleft().
+ *
+ * A C-contiguous int32 buffer goes to the core in one call. Anything else is
+ * converted in chunks outside the critical section, since its iterator may
+ * run Python code, and each chunk is added under it.
+ *
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static int PyDeque_extend_from(PyDequeObject* self, PyObject* iterable, int front) {
+    Py_buffer view;
+    int has_buffer = pyds_get_int32_buffer(iterable, &view);
+    if (has_buffer < 0) return -1;
+    if (has_buffer) {
+        int status = PyDeque_add_locked(self, view.buf, (size_t)(view.len / (Py_ssize_t)sizeof(int32_t)), front);
+        PyBuffer_Release(&view);
+        return status;
+    }
+
+    // Iterating self while adding to it would never end
+    if (iterable == (PyObject*)self) {
+        int32_t* values;
+        size_t size;
+        if (PyDeque_snapshot(self, &values, &size) < 0) return -1;
+
+        int status = PyDeque_add_locked(self, values, size, front);
+        PyMem_Free(values);
+        return status;
+    }
+
+    PyObject* iterator = PyObject_GetIter(iterable);
+    if (!iterator) return -1;
+
+    int32_t chunk[PYDS_BOX_CHUNK];
+    size_t n = 0;
+    int status = 0;
+    PyObject* item;
+    while (status == 0 && (item = PyIter_Next(iterator))) {
+        status = pyds_as_int32(item, &chunk[n]);
+        Py_DECREF(item);
+        if (status == 0 && ++n == PYDS_BOX_CHUNK) {
+            status = PyDeque_add_locked(self, chunk, n, front);
+            n = 0;
+        }
+    }
+    Py_DECREF(iterator);
+
+    if (status == 0 && PyErr_Occurred()) status = -1;
+    if (status == 0 && n > 0) status = PyDeque_add_locked(self, chunk, n, front);
+    return status;
+}
+
+static PyObject* PyDeque_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"iterable", "maxlen", NULL};
+    PyObject* iterable = NULL;
+    PyObject* maxlen_arg = Py_None;
+    size_t maxlen;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OO:Deque", kwlist, &iterable, &maxlen_arg)) return NULL;
+    if (PyDeque_parse_maxlen(maxlen_arg, &maxlen) < 0) return NULL;
+
+    PyObject* self = PyDeque_alloc(type, maxlen);
+    if (!self || !iterable) return self;
+
+    if (PyDeque_extend_from((PyDequeObject*)self, iterable, 0) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return self;
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyDeque_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (PyVectorcall_NARGS(nargsf) == 0 && !kwnames) return PyDeque_alloc((PyTypeObject*)type, DEQUE_UNBOUNDED);
+    return pyds_vectorcall_new((PyTypeObject*)type, args, nargsf, kwnames, PyDeque_new);
+}
+#endif
+
+static inline PyObject* PyDeque_push(PyDequeObject* self, PyObject* arg, int front) {
+    int32_t value;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    dyn_array_status_t status = DYN_ARRAY_OK;
+    int exported = 0;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (!PyDeque_can_add(self, 1)) {
+        exported = 1;
+    } else {
+        PYDS_TIMED(self, status = front ? deque_push_front(self->deque, value) : deque_push_back(self->deque, value));
+    }
+    Py_END_CRITICAL_SECTION();
+    if (exported) return PyDeque_exported_error();
+    if (status != DYN_ARRAY_OK) return PyDeque_set_error(status);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDeque_append(PyDequeObject* self, PyObject* arg) {
+    return PyDeque_push(self, arg, 0);
+}
+
+static PyObject* PyDeque_appendleft(PyDequeObject* self, PyObject* arg) {
+    return PyDeque_push(self, arg, 1);
+}
+
+static PyObject* PyDeque_pop(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    int32_t removed;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, status = deque_pop_back(self->deque, &removed));
+    Py_END_CRITICAL_SECTION();
+    if (status == DYN_ARRAY_ERROR_OUT_OF_RANGE) Py_RETURN_NONE;
+
+    return PyLong_FromLong(removed);
+}
+
+static PyObject* PyDeque_popleft(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    int32_t removed;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, status = deque_pop_front(self->deque, &removed));
+    Py_END_CRITICAL_SECTION();
+    if (status == DYN_ARRAY_ERROR_OUT_OF_RANGE) Py_RETURN_NONE;
+
+    return PyLong_FromLong(removed);
+}
+
+static PyObject* PyDeque_extend(PyDequeObject* self, PyObject* iterable) {
+    if (PyDeque_extend_from(self, iterable, 0) < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDeque_extendleft(PyDequeObject* self, PyObject* iterable) {
+    if (PyDeque_extend_from(self, iterable, 1) < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDeque_clear(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    deque_clear(self->deque);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+/**
+ * @brief One run of consecutive storage slots handed out by segments().
+ *
+ * Each segment exports its run as a writable 1-D buffer of C ints. While
+ * any export is live the owner's storage is pinned: operations that would
+ * reallocate it raise BufferError, as they do for bytearray. Values pushed
+ * or popped within the capacity do not move the runs, so the views then
+ * show slots that may no longer hold values.
+ */
+typedef struct {
+    PyObject_HEAD;
+    PyDequeObject* owner;
+    Py_ssize_t start;       // First storage slot of the run
+    Py_ssize_t shape[1];    // Run length in values
+    Py_ssize_t strides[1];
+} PyDequeSegmentObject;
+
+typedef struct {
+    PyObject* type;          // Deque
+    PyObject* segment_type;  // DequeSegment, not exposed by the module
+} deque_module_state;
+
+#if PY_VERSION_HEX < 0x03090000
+// 3.8 cannot find a type's module, so the segment type of the last module executed is shared
+static PyObject* PyDeque_segment_type_38;
+#endif
+
+static void PyDequeSegment_dealloc(PyDequeSegmentObject* self) {
+    Py_XDECREF((PyObject*)self->owner);
+    pyds_type_free((PyObject*)self);
+}
+
+#ifndef DYNAMIC_ARRAY_SEGMENTED
+static int PyDequeSegment_getbuffer(PyDequeSegmentObject* self, Py_buffer* view, int flags) {
+    PyDequeObject* owner = self->owner;
+    if (!owner) {
+        view->obj = NULL;
+        PyErr_SetString(PyExc_BufferError, "DequeSegment is not attached to a Deque");
+        return -1;
+    }
+
+    // The capacity never shrinks, so the run stays inside the storage
+    int32_t* data;
+    Py_BEGIN_CRITICAL_SECTION(owner);
+    owner->exports++;
+    data = owner->deque->storage.data;
+    Py_END_CRITICAL_SECTION();
+
+    Py_INCREF((PyObject*)self);
+    view->obj = (PyObject*)self;
+    view->buf = data + self->start;
+    view->len = self->shape[0] * (Py_ssize_t)sizeof(int32_t);
+    view->readonly = 0;
+    view->itemsize = (Py_ssize_t)sizeof(int32_t);
+    view->format = (flags & PyBUF_FORMAT) ? (char*)"i" : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static void PyDequeSegment_releasebuffer(PyDequeSegmentObject* self, Py_buffer* Py_UNUSED(view)) {
+    Py_BEGIN_CRITICAL_SECTION(self->owner);
+    self->owner->exports--;
+    Py_END_CRITICAL_SECTION();
+}
+
+// Returns a memoryview of count slots from start, or NULL with an exception set
+static PyObject* PyDeque_segment_view(PyDequeObject* self, PyTypeObject* type, Py_ssize_t start, Py_ssize_t count) {
+    PyDequeSegmentObject* segment = (PyDequeSegmentObject*)PyType_GenericAlloc(type, 0);
+    if (!segment) return NULL;
+
+    Py_INCREF((PyObject*)self);
+    segment->owner = self;
+    segment->start = start;
+    segment->shape[0] = count;
+    segment->strides[0] = (Py_ssize_t)sizeof(int32_t);
+
+    PyObject* view = PyMemoryView_FromObject((PyObject*)segment);
+    Py_DECREF(segment);
+    return view;
+}
+#endif
+
+static PyObject* PyDeque_segments(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+    PyErr_SetString(PyExc_NotImplementedError, "Deque segments need the contiguous storage build");
+    return NULL;
+#else
+#if PY_VERSION_HEX >= 0x03090000
+    PyObject* module = PyType_GetModule(Py_TYPE((PyObject*)self));
+    if (!module) return NULL;
+    PyTypeObject* type = (PyTypeObject*)((deque_module_state*)PyModule_GetState(module))->segment_type;
+#else
+    PyTypeObject* type = (PyTypeObject*)PyDeque_segment_type_38;
+#endif
+
+    int32_t* first;
+    int32_t* second;
+    size_t first_length, second_length;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    deque_segments(self->deque, &first, &first_length, &second, &second_length);
+    Py_END_CRITICAL_SECTION();
+
+    PyObject* head = PyDeque_segment_view(self, type, first - second, (Py_ssize_t)first_length);
+    if (!head) return NULL;
+    PyObject* tail = PyDeque_segment_view(self, type, 0, (Py_ssize_t)second_length);
+    if (!tail) {
+        Py_DECREF(head);
+        return NULL;
+    }
+    return Py_BuildValue("(NN)", head, tail);
+#endif
+}
+
+typedef struct {
+    PyObject* owner;
+    const deque_t* deque;
+    size_t index;
+} PyDequeCursor;
+
+static Py_ssize_t PyDeque_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    PyDequeCursor* cursor = (PyDequeCursor*)ctx;
+    Py_ssize_t n = 0;
+    while (n < max && cursor->index < deque_size(cursor->deque)) {
+        out[n++] = *deque_slot(cursor->deque, cursor->index++);
+    }
+    return n;
+}
+
+// dump() calls back into Python between chunks, so each chunk is read under the critical section
+static Py_ssize_t PyDeque_fill_locked(void* ctx, int32_t* out, Py_ssize_t max) {
+    Py_ssize_t n;
+    Py_BEGIN_CRITICAL_SECTION(((PyDequeCursor*)ctx)->owner);
+    n = PyDeque_fill(ctx, out, max);
+    Py_END_CRITICAL_SECTION();
+
+    return n;
+}
+
+static int PyDeque_extend_values(void* ctx, const int32_t* values, Py_ssize_t count) {
+    dyn_array_status_t status = deque_extend_back((deque_t*)ctx, values, (size_t)count);
+    if (status != DYN_ARRAY_OK) {
+        PyDeque_set_error(status);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* PyDeque_to_list(PyDequeObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+
+    PyObject* result;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyDequeCursor cursor = {(PyObject*)self, self->deque, 0};
+    result = pyds_int32_result((Py_ssize_t)deque_size(self->deque), PyDeque_fill, &cursor, as_array);
+    Py_END_CRITICAL_SECTION();
+
+    return result;
+}
+
+static PyObject* PyDeque_tobytes(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* bytes;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyDequeCursor cursor = {(PyObject*)self, self->deque, 0};
+    bytes = pyds_tobytes((Py_ssize_t)deque_size(self->deque), PyDeque_fill, &cursor);
+    Py_END_CRITICAL_SECTION();
+
+    return bytes;
+}
+
+// Parses (source, maxlen=None) for frombytes() and load() and creates the empty deque
+static PyObject* PyDeque_cls_parse(PyObject* cls, PyObject* args, PyObject* kwargs, const char* format,
+                                   const char* source_name, PyObject** source) {
+    char* kwlist[] = {(char*)source_name, "maxlen", NULL};
+    PyObject* maxlen_arg = Py_None;
+    size_t maxlen;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, format, kwlist, source, &maxlen_arg)) return NULL;
+    if (PyDeque_parse_maxlen(maxlen_arg, &maxlen) < 0) return NULL;
+    return PyDeque_alloc((PyTypeObject*)cls, maxlen);
+}
+
+static PyObject* PyDeque_cls_frombytes(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    PyObject* data;
+    PyObject* obj = PyDeque_cls_parse(cls, args, kwargs, "O|O:frombytes", "data", &data);
+    if (!obj) return NULL;
+
+    if (pyds_frombytes(data, PyDeque_extend_values, ((PyDequeObject*)obj)->deque) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static PyObject* PyDeque_reduce(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t maxlen;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    maxlen = self->deque->maxlen;
+    Py_END_CRITICAL_SECTION();
+
+    PyObject* payload = PyDeque_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    if (!result || maxlen == DEQUE_UNBOUNDED) return result;
+
+    // A bounded deque is rebuilt with frombytes(payload, maxlen)
+    PyObject* bounded = Py_BuildValue("(O(On))", PyTuple_GetItem(result, 0),
+                                      PyTuple_GetItem(PyTuple_GetItem(result, 1), 0), (Py_ssize_t)maxlen);
+    Py_DECREF(result);
+    return bounded;
+}
+
+static PyObject* PyDeque_dump(PyDequeObject* self, PyObject* fileobj) {
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = (Py_ssize_t)deque_size(self->deque);
+    Py_END_CRITICAL_SECTION();
+
+    PyDequeCursor cursor = {(PyObject*)self, self->deque, 0};
+    if (pyds_dump(fileobj, PYDS_CONTAINER_DEQUE, size, PyDeque_fill_locked, &cursor) < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDeque_cls_load(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    PyObject* fileobj;
+    PyObject* obj = PyDeque_cls_parse(cls, args, kwargs, "O|O:load", "file", &fileobj);
+    if (!obj) return NULL;
+
+    if (pyds_load(fileobj, PYDS_CONTAINER_DEQUE, PyDeque_extend_values, ((PyDequeObject*)obj)->deque) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static Py_ssize_t PyDeque_length(PyDequeObject* self) {
+    size_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = deque_size(self->deque);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyDeque_item(PyDequeObject* self, Py_ssize_t index) {
+    int32_t value;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, status = index < 0 ? DYN_ARRAY_ERROR_OUT_OF_RANGE : deque_get(self->deque, (size_t)index, &value));
+    Py_END_CRITICAL_SECTION();
+
+    if (status != DYN_ARRAY_OK) {
+        PyErr_SetString(PyExc_IndexError, "Deque index out of range");
+        return NULL;
+    }
+
+    return PyLong_FromLong(value);
+}
+
+static int PyDeque_ass_item(PyDequeObject* self, Py_ssize_t index, PyObject* value) {
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "Deque does not support item deletion");
+        return -1;
+    }
+
+    int32_t v;
+    if (pyds_as_int32(value, &v) < 0) return -1;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, status = index < 0 ? DYN_ARRAY_ERROR_OUT_OF_RANGE : deque_set(self->deque, (size_t)index, v));
+    Py_END_CRITICAL_SECTION();
+
+    if (status != DYN_ARRAY_OK) {
+        PyErr_SetString(PyExc_IndexError, "Deque assignment index out of range");
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject* PyDeque_get_maxlen(PyDequeObject* self, void* Py_UNUSED(closure)) {
+    size_t maxlen;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    maxlen = self->deque->maxlen;
+    Py_END_CRITICAL_SECTION();
+
+    if (maxlen == DEQUE_UNBOUNDED) Py_RETURN_NONE;
+    return PyLong_FromSize_t(maxlen);
+}
+
+static PyObject* PyDeque_sizeof(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = deque_memory_usage(self->deque);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyDequeObject) + usage);
+}
+
+static PyObject* PyDeque_stats(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    deque_get_stats(self->deque, &stats);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyDeque_reset_stats(PyDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    deque_reset_stats(self->deque);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyMethodDef PyDeque_methods[] = {
+    {"append", (PyCFunction)PyDeque_append, METH_O, "Add a value at the back."},
+    {"appendleft", (PyCFunction)PyDeque_appendleft, METH_O, "Add a value at the front."},
+    {"pop", (PyCFunction)PyDeque_pop, METH_NOARGS, "Remove the back value. Returns the value removed. If there is no element, return None."},
+    {"popleft", (PyCFunction)PyDeque_popleft, METH_NOARGS, "Remove the front value. Returns the value removed. If there is no element, return None."},
+    {"extend", (PyCFunction)PyDeque_extend, METH_O, "Add the values of an iterable at the back. An array('i') or other int32 buffer is copied in one step."},
+    {"extendleft", (PyCFunction)PyDeque_extendleft, METH_O, "Add the values of an iterable at the front, one by one, so they end up reversed."},
+    {"clear", (PyCFunction)PyDeque_clear, METH_NOARGS, "Remove all values, keeping the allocated capacity."},
+    {"segments", (PyCFunction)PyDeque_segments, METH_NOARGS, "Return the values as two writable memoryviews of the storage, front run first."},
+    {"to_list", (PyCFunction)(void(*)(void))PyDeque_to_list, METH_VARARGS | METH_KEYWORDS, "Convert to Python list, or to array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyDeque_tobytes, METH_NOARGS, "Return the values as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)(void(*)(void))PyDeque_cls_frombytes, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Build a deque from little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyDeque_dump, METH_O, "Write the deque to a binary file object."},
+    {"load", (PyCFunction)(void(*)(void))PyDeque_cls_load, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Read a deque written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyDeque_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyDeque_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyDeque_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyDeque_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
+    {NULL}
+};
+
+static PyGetSetDef PyDeque_getset[] = {
+    {"maxlen", (getter)PyDeque_get_maxlen, NULL, "Most values kept, or None if unbounded.", NULL},
+    {NULL}
+};
+
+static PyType_Slot PyDeque_slots[] = {
+    {Py_tp_doc, (void*)"Double-ended queue of int32 values in a ring buffer\n"
+        "\n"
+        "Deque(iterable=(), maxlen=None). A bounded deque drops values from the opposite end when full.\n"
+        "segments() views the storage in place; it cannot grow while a view is alive.\n"
+        "\n"
+        "- append(value: int) - Add a value at the back.\n"
+        "- appendleft(value: int) - Add a value at the front.\n"
+        "- pop() -> Optional[int] - Remove the back value. Returns the value removed.\n"
+        "- popleft() -> Optional[int] - Remove the front value. Returns the value removed.\n"
+        "- extend(iterable) - Add the values of an iterable at the back.\n"
+        "- extendleft(iterable) - Add the values of an iterable at the front, so they end up reversed.\n"
+        "- clear() - Remove all values, keeping the allocated capacity.\n"
+        "- segments() -> tuple[memoryview, memoryview] - Return the values as two writable views of the storage.\n"
+        "- maxlen -> Optional[int] - Most values kept, or None if unbounded.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Convert to Python list, or to array('i') if as_array is true.\n"
+        "- tobytes() -> bytes - Return the values as little-endian int32 bytes.\n"
+        "- frombytes(data: bytes, maxlen=None) -> Deque - Build a deque from little-endian int32 bytes.\n"
+        "- dump(file) - Write the deque to a binary file object.\n"
+        "- load(file, maxlen=None) -> Deque - Read a deque written by dump() from a binary file object.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"
+        "- len(deque) -> int - Get number of items.\n"
+        "- deque[index] - Get or set an item.\n"},
+    {Py_tp_methods, PyDeque_methods},
+    {Py_tp_getset, PyDeque_getset},
+    {Py_tp_new, PyDeque_new},
+    {Py_tp_dealloc, PyDeque_dealloc},
+    {Py_sq_length, PyDeque_length},
+    {Py_sq_item, PyDeque_item},
+    {Py_sq_ass_item, PyDeque_ass_item},
+    {0, NULL}
+};
+
+static PyType_Spec PyDeque_spec = {
+    .name = "pydatastructs.deque.Deque",
+    .basicsize = sizeof(PyDequeObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyDeque_slots,
+};
+
+static PyType_Slot PyDequeSegment_slots[] = {
+    {Py_tp_doc, (void*)"One run of a Deque's storage, exported by Deque.segments()."},
+    {Py_tp_dealloc, PyDequeSegment_dealloc},
+#if !defined(DYNAMIC_ARRAY_SEGMENTED) && PY_VERSION_HEX >= 0x03090000
+    {Py_bf_getbuffer, PyDequeSegment_getbuffer},
+    {Py_bf_releasebuffer, PyDequeSegment_releasebuffer},
+#endif
+    {0, NULL}
+};
+
+static PyType_Spec PyDequeSegment_spec = {
+    .name = "pydatastructs.deque.DequeSegment",
+    .basicsize = sizeof(PyDequeSegmentObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyDequeSegment_slots,
+};
+
+static int deque_module_exec(PyObject* m) {
+    deque_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyDeque_spec, PYDS_VECTORCALL(PyDeque_vectorcall));
+    if (!state->type) return -1;
+
+#if PY_VERSION_HEX >= 0x03090000
+    state->segment_type = PyType_FromModuleAndSpec(m, &PyDequeSegment_spec, NULL);
+    if (!state->segment_type) return -1;
+#else
+    state->segment_type = PyType_FromSpec(&PyDequeSegment_spec);
+    if (!state->segment_type) return -1;
+#ifndef DYNAMIC_ARRAY_SEGMENTED
+    // PyType_FromSpec() only takes the buffer slots from 3.9 on
+    PyBufferProcs* buffer = &((PyHeapTypeObject*)state->segment_type)->as_buffer;
+    buffer->bf_getbuffer = (getbufferproc)PyDequeSegment_getbuffer;
+    buffer->bf_releasebuffer = (releasebufferproc)PyDequeSegment_releasebuffer;
+#endif
+    Py_INCREF(state->segment_type);
+    Py_XSETREF(PyDeque_segment_type_38, state->segment_type);
+#endif
+
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int deque_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    deque_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->type);
+        Py_VISIT(state->segment_type);
+    }
+    return 0;
+}
+
+static int deque_module_clear(PyObject* m) {
+    deque_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->type);
+        Py_CLEAR(state->segment_type);
+    }
+    return 0;
+}
+
+static void deque_module_free(void* m) {
+    deque_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot deque_module_slots[] = {
+    {Py_mod_exec, (void*)deque_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef deque_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "deque",
+    .m_doc = "This module exposes a ring-buffer double-ended queue of int32 values "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(deque_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = deque_module_slots,
+    .m_traverse = deque_module_traverse,
+    .m_clear = deque_module_clear,
+    .m_free = deque_module_free,
+};
+
+PyMODINIT_FUNC PyInit_deque(void) {
+    return PyModuleDef_Init(&deque_module);
+}
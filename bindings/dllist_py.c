@@ -2,135 +2,726 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <stdlib.h>
 #include "../src/dllist.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "objects.h"
+#include "serialize.h"
+#include "stats.h"
 
 typedef struct {
     PyObject_HEAD;
     DoublyLinkedList* list;
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
 } PyDLLObject;
 
 static void PyDLL_dealloc(PyDLLObject* self) {
     dll_free(self->list);
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    pyds_type_free((PyObject*)self);
 }
 
-static PyObject* PyDLL_new(PyTypeObject* type, PyObject* args, PyObject* kwds) {
+static PyObject* PyDLL_alloc(PyTypeObject* type) {
     PyDLLObject* self;
-    self = (PyDLLObject*)type->tp_alloc(type, 0);
+    self = (PyDLLObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
     self->list = dll_create();
+    if (!self->list) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
 
     return (PyObject*)self;
 }
 
-static PyObject* PyDLL_append(PyDLLObject* self, PyObject* args) {
-    int value;
+static PyObject* PyDLL_new(PyTypeObject* type, PyObject* args, PyObject* kwds) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwds ? PyDict_Size(kwds) : 0) < 0) return NULL;
+    return PyDLL_alloc(type);
+}
 
-    if (!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    dll_append((DoublyLinkedList*)self->list, value);
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyDLL_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (pyds_check_no_args((PyTypeObject*)type, PyVectorcall_NARGS(nargsf), kwnames ? PyTuple_GET_SIZE(kwnames) : 0) < 0) return NULL;
+    return PyDLL_alloc((PyTypeObject*)type);
+}
+#endif
+
+static PyObject* PyDLL_append(PyDLLObject* self, PyObject* arg) {
+    int32_t value;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, dll_append((DoublyLinkedList*)self->list, value));
+    Py_END_CRITICAL_SECTION();
 
     Py_RETURN_NONE;
 }
 
-static PyObject* PyDLL_prepend(PyDLLObject* self, PyObject* args) {
-    int value;
+static PyObject* PyDLL_prepend(PyDLLObject* self, PyObject* arg) {
+    int32_t value;
 
-    if (!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    dll_prepend((DoublyLinkedList*)self->list, value);
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, dll_prepend((DoublyLinkedList*)self->list, value));
+    Py_END_CRITICAL_SECTION();
 
     Py_RETURN_NONE;
 }
 
-static PyObject* PyDLL_remove(PyDLLObject* self, PyObject* args) {
-    int value;
+static PyObject* PyDLL_remove(PyDLLObject* self, PyObject* arg) {
+    int32_t value;
 
-    if (!PyArg_ParseTuple(args, "i", &value)) return NULL;
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
 
     int removed;
-    if (!dll_remove((DoublyLinkedList*)self->list, value, &removed))
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = dll_remove((DoublyLinkedList*)self->list, value, &removed));
+    Py_END_CRITICAL_SECTION();
+
+    if (!found)
         Py_RETURN_NONE;
 
     return PyLong_FromLong(removed);
 }
 
-static PyObject* PyDLL_pop(PyDLLObject* self, PyObject* args) {
-    int index;
+static PyObject* PyDLL_pop(PyDLLObject* self, PyObject* arg) {
+    int32_t index;
 
-    if (!PyArg_ParseTuple(args, "i", &index)) return NULL;
+    if (pyds_as_int32(arg, &index) < 0) return NULL;
 
     int removed;
-    if (!dll_pop((DoublyLinkedList*)self->list, index, &removed))
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = dll_pop((DoublyLinkedList*)self->list, index, &removed));
+    Py_END_CRITICAL_SECTION();
+
+    if (!found)
         Py_RETURN_NONE;
 
     return PyLong_FromLong(removed);
 }
 
-static PyObject* PyDLL_to_list(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
-    int size = dll_length((DoublyLinkedList*)self->list);
-    int* values = dll_to_array((DoublyLinkedList*)self->list);
-    PyObject* pylist = PyList_New(size);
+// A list index as in Python: negative counts from the end, and the result is clamped to [0, size]
+static int PyDLL_clamp_index(Py_ssize_t index, int size) {
+    if (index < 0) index += size;
+    if (index < 0) return 0;
+    return index > size ? size : (int)index;
+}
+
+// Moves every node of other into self before index, or at the end if index is NULL
+static PyObject* PyDLL_move_from(PyDLLObject* self, const Py_ssize_t* index, PyObject* arg) {
+    if (!PyObject_TypeCheck(arg, Py_TYPE((PyObject*)self))) {
+        PyErr_SetString(PyExc_TypeError, "other must be a DoublyLinkedList");
+        return NULL;
+    }
+    if (arg == (PyObject*)self) {
+        PyErr_SetString(PyExc_ValueError, "cannot move a list into itself");
+        return NULL;
+    }
+
+    PyDLLObject* other = (PyDLLObject*)arg;
+    char fits;
+    Py_BEGIN_CRITICAL_SECTION2(self, other);
+    fits = other->list->size <= INT_MAX - self->list->size;
+    if (fits && index) {
+        PYDS_TIMED(self, dll_splice(self->list, PyDLL_clamp_index(*index, self->list->size), other->list));
+    } else if (fits) {
+        PYDS_TIMED(self, dll_extend(self->list, other->list));
+    }
+    Py_END_CRITICAL_SECTION2();
+
+    if (!fits) {
+        PyErr_SetString(PyExc_OverflowError, "the lists together are too long");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDLL_extend_from(PyDLLObject* self, PyObject* other) {
+    return PyDLL_move_from(self, NULL, other);
+}
+
+static PyObject* PyDLL_splice(PyDLLObject* self, PyObject* args) {
+    Py_ssize_t index;
+    PyObject* other;
+
+    if (!PyArg_ParseTuple(args, "nO:splice", &index, &other)) return NULL;
+    return PyDLL_move_from(self, &index, other);
+}
+
+static PyObject* PyDLL_split(PyDLLObject* self, PyObject* arg) {
+    // Out-of-range indexes saturate, then clamp like a slice
+    Py_ssize_t index = PyNumber_AsSsize_t(arg, NULL);
+    if (index == -1 && PyErr_Occurred()) return NULL;
+
+    PyDLLObject* rest = (PyDLLObject*)PyDLL_alloc(Py_TYPE((PyObject*)self));
+    if (!rest) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, dll_split(self->list, PyDLL_clamp_index(index, self->list->size), rest->list));
+    Py_END_CRITICAL_SECTION();
+
+    return (PyObject*)rest;
+}
+
+static PyObject* PyDLL_rotate(PyDLLObject* self, PyObject* args) {
+    Py_ssize_t steps = 1;
 
-    for (int i = 0; i < size; i++) {
-        PyList_SetItem(pylist, i, PyLong_FromLong(values[i]));
+    if (!PyArg_ParseTuple(args, "|n:rotate", &steps)) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    int size = self->list->size;
+    PYDS_TIMED(self, dll_rotate(self->list, size > 0 ? (int)(steps % size) : 0));
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDLL_reverse(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, dll_reverse(self->list));
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+// Copies the values first to last; the caller frees cursor->values with pyds_free()
+static int PyDLL_snapshot(PyDLLObject* self, pyds_array_cursor_t* cursor) {
+    int size;
+    int* values;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = dll_length(self->list);
+    values = dll_to_array(self->list);
+    Py_END_CRITICAL_SECTION();
+
+    if (size > 0 && !values) {
+        PyErr_NoMemory();
+        return -1;
     }
 
-    return pylist;
+    cursor->values = values;
+    cursor->index = 0;
+    cursor->size = size;
+    return 0;
+}
+
+static PyObject* PyDLL_to_list(PyDLLObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+
+    pyds_array_cursor_t cursor;
+    if (PyDLL_snapshot(self, &cursor) < 0) return NULL;
+
+    PyObject* result = pyds_int32_result(cursor.size, pyds_array_fill, &cursor, as_array);
+    pyds_free((void*)cursor.values);
+    return result;
+}
+
+static Py_ssize_t PyDLL_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    Node** current = (Node**)ctx;
+    Py_ssize_t n = 0;
+    while (n < max && *current) {
+        out[n++] = (*current)->value;
+        *current = (*current)->next;
+    }
+    return n;
+}
+
+static int PyDLL_extend(void* ctx, const int32_t* values, Py_ssize_t count) {
+    DoublyLinkedList* list = (DoublyLinkedList*)ctx;
+    int expected = list->size + (int)count;
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        dll_append(list, values[i]);
+    }
+    if (list->size != expected) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* PyDLL_tobytes(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* bytes;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    Node* current = self->list->head;
+    bytes = pyds_tobytes(dll_length(self->list), PyDLL_fill, &current);
+    Py_END_CRITICAL_SECTION();
+
+    return bytes;
+}
+
+static PyObject* PyDLL_cls_frombytes(PyObject* cls, PyObject* data) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_frombytes(data, PyDLL_extend, ((PyDLLObject*)obj)->list) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static PyObject* PyDLL_reduce(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* payload = PyDLL_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    return result;
+}
+
+static PyObject* PyDLL_dump(PyDLLObject* self, PyObject* fileobj) {
+    pyds_array_cursor_t cursor;
+    if (PyDLL_snapshot(self, &cursor) < 0) return NULL;
+
+    int status = pyds_dump(fileobj, PYDS_CONTAINER_DLLIST, cursor.size, pyds_array_fill, &cursor);
+    pyds_free((void*)cursor.values);
+    if (status < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyDLL_cls_load(PyObject* cls, PyObject* fileobj) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_load(fileobj, PYDS_CONTAINER_DLLIST, PyDLL_extend, ((PyDLLObject*)obj)->list) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
 }
 
 static Py_ssize_t PyDLL_length(PyDLLObject* self) {
-    return (Py_ssize_t)dll_length((DoublyLinkedList*)self->list);
+    int size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = dll_length((DoublyLinkedList*)self->list);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyDLL_sizeof(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = dll_memory_usage(self->list);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyDLLObject) + usage);
+}
+
+static PyObject* PyDLL_stats(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dll_get_stats(self->list, &stats);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyDLL_reset_stats(PyDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dll_reset_stats(self->list);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
 }
 
 static PyMethodDef PyDLL_methods[] = {
-    {"append", (PyCFunction)PyDLL_append, METH_VARARGS, "Add a value at the end."},
-    {"prepend", (PyCFunction)PyDLL_prepend, METH_VARARGS, "Add a value at the beginning."},
-    {"pop", (PyCFunction)PyDLL_pop, METH_VARARGS, "Remove a node by index. Returns the value removed."},
-    {"remove", (PyCFunction)PyDLL_remove, METH_VARARGS, "Remove a node by value. Returns the value removed."},
-    {"to_list", (PyCFunction)PyDLL_to_list, METH_NOARGS, "Convert to Python list."},
+    {"append", (PyCFunction)PyDLL_append, METH_O, "Add a value at the end."},
+    {"prepend", (PyCFunction)PyDLL_prepend, METH_O, "Add a value at the beginning."},
+    {"pop", (PyCFunction)PyDLL_pop, METH_O, "Remove a node by index. Returns the value removed."},
+    {"remove", (PyCFunction)PyDLL_remove, METH_O, "Remove a node by value. Returns the value removed."},
+    {"extend_from", (PyCFunction)PyDLL_extend_from, METH_O, "Move every node of other to the end, leaving other empty."},
+    {"splice", (PyCFunction)PyDLL_splice, METH_VARARGS, "Move every node of other before index, leaving other empty."},
+    {"split", (PyCFunction)PyDLL_split, METH_O, "Move the nodes from index on into a new list and return it."},
+    {"rotate", (PyCFunction)PyDLL_rotate, METH_VARARGS, "Move the last steps nodes to the front; negative steps rotate left."},
+    {"reverse", (PyCFunction)PyDLL_reverse, METH_NOARGS, "Reverse the list in place."},
+    {"to_list", (PyCFunction)(void(*)(void))PyDLL_to_list, METH_VARARGS | METH_KEYWORDS, "Convert to Python list, or to array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyDLL_tobytes, METH_NOARGS, "Return the values as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)PyDLL_cls_frombytes, METH_O | METH_CLASS, "Build a list from little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyDLL_dump, METH_O, "Write the list to a binary file object."},
+    {"load", (PyCFunction)PyDLL_cls_load, METH_O | METH_CLASS, "Read a list written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyDLL_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyDLL_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyDLL_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyDLL_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
     {NULL}
 };
 
-static PySequenceMethods PYDLL_sequence_methods = {
-    .sq_length = (lenfunc)PyDLL_length,
-    0, 0, 0, 0, 0, 0, 0, 0, 0
+static PyType_Slot PyDLL_slots[] = {
+    {Py_tp_doc, (void*)"Doubly Linked List\n"
+        "\n"
+        "extend_from(), splice(), split() and rotate() relink nodes without allocating or freeing any, walking at "
+        "most to the index from the nearer end. Indexes work as in a Python list: negative ones count from the end "
+        "and out-of-range ones are clamped.\n"
+        "\n"
+        "- append(value: int) - Add a value at the end.\n"
+        "- prepend(value: int) - Add a value at the beginning.\n"
+        "- remove(value: int) -> Optional[int] - Remove a node by value. Returns the value removed.\n"
+        "- pop(index: int) -> Optional[int] - Remove a node by index. Returns the value removed.\n"
+        "- extend_from(other: DoublyLinkedList) - Move every node of other to the end in O(1), leaving other empty.\n"
+        "- splice(index: int, other: DoublyLinkedList) - Move every node of other before index, leaving other empty.\n"
+        "- split(index: int) -> DoublyLinkedList - Move the nodes from index on into a new list and return it.\n"
+        "- rotate(steps: int = 1) - Move the last steps nodes to the front; negative steps rotate left.\n"
+        "- reverse() - Reverse the list in place.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Convert to Python list, or to array('i') if as_array is true.\n"
+        "- tobytes() -> bytes - Return the values as little-endian int32 bytes.\n"
+        "- frombytes(data: bytes) -> DoublyLinkedList - Build a list from little-endian int32 bytes.\n"
+        "- dump(file) - Write the list to a binary file object.\n"
+        "- load(file) -> DoublyLinkedList - Read a list written by dump() from a binary file object.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"
+        "- len(list) -> int - Get number of items.\n"},
+    {Py_tp_methods, PyDLL_methods},
+    {Py_tp_new, PyDLL_new},
+    {Py_tp_dealloc, PyDLL_dealloc},
+    {Py_sq_length, PyDLL_length},
+    {0, NULL}
 };
 
-static PyTypeObject PyDLLType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    .tp_name = "dllist.DoublyLinkedList",
-    .tp_basicsize = sizeof(PyDLLObject),
-    .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT,
-    .tp_doc = "Doubly Linked List\n"
-    "\n"
-    "- append(value: int) - Add a value at the end.\n"
-    "- prepend(value: int) - Add a value at the beginning.\n"
-    "- remove(value: int) -> Optional[int] - Remove a node by value. Returns the value removed.\n"
-    "- pop(index: int) -> Optional[int] - Remove a node by index. Returns the value removed.\n"
-    "- to_list() -> list[int] - Convert to Python list.\n"
-    "- len(list) -> int - Get number of items.\n",
-    .tp_methods = PyDLL_methods,
-    .tp_new = PyDLL_new,
-    .tp_dealloc = (destructor)PyDLL_dealloc,
-    .tp_as_sequence = &PYDLL_sequence_methods,
+static PyType_Spec PyDLL_spec = {
+    .name = "pydatastructs.dllist.DoublyLinkedList",
+    .basicsize = sizeof(PyDLLObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyDLL_slots,
+};
+
+typedef struct PyObjectDLLNode {
+    PyObject* value;
+    struct PyObjectDLLNode* prev;
+    struct PyObjectDLLNode* next;
+} PyObjectDLLNode;
+
+typedef struct {
+    PyObject_HEAD;
+    PyObjectDLLNode* head;
+    PyObjectDLLNode* tail;
+    Py_ssize_t size;
+    pyds_kind_t kind;
+    int busy;  // Set while remove() compares with Python code
+} PyObjectDLLObject;
+
+#define PY_OBJECT_DLL_NAME "ObjectDoublyLinkedList"
+
+static int PyObjectDLL_link(PyObjectDLLObject* self, PyObject* value, int at_end) {
+    if (self->busy) {
+        pyds_object_busy(PY_OBJECT_DLL_NAME);
+        return -1;
+    }
+
+    PyObjectDLLNode* node = pyds_malloc(sizeof(PyObjectDLLNode));
+    if (!node) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    Py_INCREF(value);
+    node->value = value;
+    if (at_end) {
+        node->prev = self->tail;
+        node->next = NULL;
+        if (self->tail) self->tail->next = node;
+        else self->head = node;
+        self->tail = node;
+    } else {
+        node->prev = NULL;
+        node->next = self->head;
+        if (self->head) self->head->prev = node;
+        else self->tail = node;
+        self->head = node;
+    }
+    self->size++;
+    self->kind = pyds_kind_join(self->kind, value);
+    return 0;
+}
+
+// Unlinks and frees node, returning its reference to the value
+static PyObject* PyObjectDLL_unlink(PyObjectDLLObject* self, PyObjectDLLNode* node) {
+    if (node->prev) node->prev->next = node->next;
+    else self->head = node->next;
+
+    if (node->next) node->next->prev = node->prev;
+    else self->tail = node->prev;
+
+    PyObject* value = node->value;
+    pyds_free(node);
+    if (--self->size == 0) self->kind = PYDS_KIND_EMPTY;
+    return value;
+}
+
+static int PyObjectDLL_add(void* ctx, PyObject* item) {
+    return PyObjectDLL_link((PyObjectDLLObject*)ctx, item, 1);
+}
+
+static int PyObjectDLL_traverse(PyObjectDLLObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    for (PyObjectDLLNode* node = self->head; node; node = node->next) {
+        Py_VISIT(node->value);
+    }
+    return 0;
+}
+
+static int PyObjectDLL_clear(PyObjectDLLObject* self) {
+    PyObjectDLLNode* node = self->head;
+
+    self->head = self->tail = NULL;
+    self->size = 0;
+    self->kind = PYDS_KIND_EMPTY;
+
+    while (node) {
+        PyObjectDLLNode* next = node->next;
+        Py_DECREF(node->value);
+        pyds_free(node);
+        node = next;
+    }
+    return 0;
+}
+
+static void PyObjectDLL_dealloc(PyObjectDLLObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyObjectDLL_clear(self);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyObjectDLL_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    PyObject* iterable;
+    if (pyds_parse_iterable(args, kwargs, "|O:" PY_OBJECT_DLL_NAME, &iterable) < 0) return NULL;
+
+    PyObject* self = PyType_GenericAlloc(type, 0);
+    if (!self || !iterable) return self;
+
+    if (pyds_for_each(iterable, PyObjectDLL_add, self) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return self;
+}
+
+static PyObject* PyObjectDLL_append(PyObjectDLLObject* self, PyObject* value) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyObjectDLL_link(self, value, 1);
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyObjectDLL_prepend(PyObjectDLLObject* self, PyObject* value) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyObjectDLL_link(self, value, 0);
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyObjectDLL_remove(PyObjectDLLObject* self, PyObject* value) {
+    PyObject* removed = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->busy) {
+        pyds_object_busy(PY_OBJECT_DLL_NAME);
+    } else {
+        pyds_kind_t kind = pyds_kind_join(self->kind, value);
+        PyObjectDLLNode* node = self->head;
+        int equal = 0;
+
+        self->busy = 1;
+        while (node && (equal = pyds_object_equal(kind, node->value, value)) == 0) {
+            node = node->next;
+        }
+        self->busy = 0;
+
+        if (equal > 0) {
+            removed = PyObjectDLL_unlink(self, node);
+        } else if (equal == 0) {
+            removed = Py_None;
+            Py_INCREF(removed);
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectDLL_pop(PyObjectDLLObject* self, PyObject* arg) {
+    Py_ssize_t index = PyLong_AsSsize_t(arg);
+    if (index == -1 && PyErr_Occurred()) return NULL;
+
+    PyObject* removed = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->busy) {
+        pyds_object_busy(PY_OBJECT_DLL_NAME);
+    } else if (index < 0 || index >= self->size) {
+        removed = Py_None;
+        Py_INCREF(removed);
+    } else {
+        // Walk from the nearer end
+        PyObjectDLLNode* node;
+        if (index < self->size / 2) {
+            node = self->head;
+            for (Py_ssize_t i = 0; i < index; i++) node = node->next;
+        } else {
+            node = self->tail;
+            for (Py_ssize_t i = self->size - 1; i > index; i--) node = node->prev;
+        }
+        removed = PyObjectDLL_unlink(self, node);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectDLL_to_list(PyObjectDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* list;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    list = PyList_New(self->size);
+    Py_ssize_t i = 0;
+    for (PyObjectDLLNode* node = self->head; list && node; node = node->next) {
+        Py_INCREF(node->value);
+        PYDS_LIST_SET_ITEM(list, i++, node->value);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return list;
+}
+
+static PyObject* PyObjectDLL_reduce(PyObjectDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* items = PyObjectDLL_to_list(self, NULL);
+    if (!items) return NULL;
+
+    return Py_BuildValue("(O(N))", (PyObject*)Py_TYPE((PyObject*)self), items);
+}
+
+static Py_ssize_t PyObjectDLL_length(PyObjectDLLObject* self) {
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = self->size;
+    Py_END_CRITICAL_SECTION();
+
+    return size;
+}
+
+static PyObject* PyObjectDLL_sizeof(PyObjectDLLObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_ssize_t size = PyObjectDLL_length(self);
+    return PyLong_FromSize_t(sizeof(PyObjectDLLObject) + sizeof(PyObjectDLLNode) * (size_t)size);
+}
+
+static PyMethodDef PyObjectDLL_methods[] = {
+    {"append", (PyCFunction)PyObjectDLL_append, METH_O, "Add an item at the end."},
+    {"prepend", (PyCFunction)PyObjectDLL_prepend, METH_O, "Add an item at the beginning."},
+    {"pop", (PyCFunction)PyObjectDLL_pop, METH_O, "Remove a node by index. Returns the item removed."},
+    {"remove", (PyCFunction)PyObjectDLL_remove, METH_O, "Remove the first node equal to the value. Returns the item removed."},
+    {"to_list", (PyCFunction)PyObjectDLL_to_list, METH_NOARGS, "Convert to Python list."},
+    {"__reduce__", (PyCFunction)PyObjectDLL_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyObjectDLL_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyObjectDLL_slots[] = {
+    {Py_tp_doc, (void*)"Doubly Linked List of arbitrary objects\n"
+        "\n"
+        "- ObjectDoublyLinkedList(iterable=()) - Build a list from the items of iterable.\n"
+        "- append(item) - Add an item at the end.\n"
+        "- prepend(item) - Add an item at the beginning.\n"
+        "- remove(value) -> Optional[object] - Remove the first node equal to the value. Returns the item removed.\n"
+        "- pop(index: int) -> Optional[object] - Remove a node by index. Returns the item removed.\n"
+        "- to_list() -> list - Convert to Python list.\n"
+        "- len(list) -> int - Get number of items.\n"},
+    {Py_tp_methods, PyObjectDLL_methods},
+    {Py_tp_new, PyObjectDLL_new},
+    {Py_tp_dealloc, PyObjectDLL_dealloc},
+    {Py_tp_traverse, PyObjectDLL_traverse},
+    {Py_tp_clear, PyObjectDLL_clear},
+    {Py_sq_length, PyObjectDLL_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyObjectDLL_spec = {
+    .name = "pydatastructs.dllist.ObjectDoublyLinkedList",
+    .basicsize = sizeof(PyObjectDLLObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyObjectDLL_slots,
+};
+
+typedef struct {
+    PyObject* type;  // DoublyLinkedList
+    PyObject* object_type;  // ObjectDoublyLinkedList
+} dllist_module_state;
+
+static int dllist_module_exec(PyObject* m) {
+    dllist_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyDLL_spec, PYDS_VECTORCALL(PyDLL_vectorcall));
+    if (!state->type) return -1;
+    state->object_type = pyds_add_type(m, &PyObjectDLL_spec, NULL);
+    if (!state->object_type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int dllist_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    dllist_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->type);
+        Py_VISIT(state->object_type);
+    }
+    return 0;
+}
+
+static int dllist_module_clear(PyObject* m) {
+    dllist_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->type);
+        Py_CLEAR(state->object_type);
+    }
+    return 0;
+}
+
+static void dllist_module_free(void* m) {
+    dllist_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot dllist_module_slots[] = {
+    {Py_mod_exec, (void*)dllist_module_exec},
+    PYDS_MODULE_SLOTS
 };
 
 static PyModuleDef dllist_module = {
     PyModuleDef_HEAD_INIT,
-    "dllist",
-    "This module exposes a high-performance, memory-efficient doubly linked list "
-    "implementation written in C to Python via the C API"
-    -1,
-    NULL, NULL, NULL, NULL, NULL
+    .m_name = "dllist",
+    .m_doc = "This module exposes a high-performance, memory-efficient doubly linked list "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(dllist_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = dllist_module_slots,
+    .m_traverse = dllist_module_traverse,
+    .m_clear = dllist_module_clear,
+    .m_free = dllist_module_free,
 };
 
 PyMODINIT_FUNC PyInit_dllist(void) {
-    PyObject* m;
-    if (PyType_Ready(&PyDLLType) < 0) return NULL;
-
-    m = PyModule_Create(&dllist_module);
-    if (!m) return NULL;
-
-    Py_INCREF(&PyDLLType);
-    PyModule_AddObject(m, "DoublyLinkedList", (PyObject*)&PyDLLType);
-    return m;
-}
\ No newline at end of file
+    return PyModuleDef_Init(&dllist_module);
+}
@@ -0,0 +1,617 @@
+// bindings/graph_py.c
+//
+// CSRGraph reads the caller's int32 CSR buffers in place, checks them once,
+// and runs every kernel without the GIL, writing into distance and
+// predecessor buffers. A batch of sources is split between threads started
+// for the call, each with its own workspace.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <pythread.h>
+#include "../src/graph.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "stats.h"
+
+typedef struct {
+    PyObject_HEAD;
+    graph_csr_t graph;  // Points into the three views
+    Py_buffer indptr;
+    Py_buffer indices;
+    Py_buffer weights;
+} PyCSRGraphObject;
+
+static void PyCSRGraph_dealloc(PyCSRGraphObject* self) {
+    if (self->indptr.obj) PyBuffer_Release(&self->indptr);
+    if (self->indices.obj) PyBuffer_Release(&self->indices);
+    if (self->weights.obj) PyBuffer_Release(&self->weights);
+    pyds_type_free((PyObject*)self);
+}
+
+static int PyCSRGraph_get_input(PyObject* obj, const char* name, Py_buffer* view) {
+    int status = pyds_get_int32_buffer(obj, view);
+    if (status == 0) PyErr_Format(PyExc_TypeError, "%s must be a C-contiguous int32 buffer", name);
+    return status > 0 ? 0 : -1;
+}
+
+static PyObject* PyCSRGraph_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"indptr", "indices", "weights", NULL};
+    PyObject *indptr, *indices, *weights;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:CSRGraph", kwlist, &indptr, &indices, &weights)) return NULL;
+
+    PyCSRGraphObject* self = (PyCSRGraphObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+    if (PyCSRGraph_get_input(indptr, "indptr", &self->indptr) < 0 ||
+        PyCSRGraph_get_input(indices, "indices", &self->indices) < 0 ||
+        PyCSRGraph_get_input(weights, "weights", &self->weights) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+
+    Py_ssize_t offsets = self->indptr.len / (Py_ssize_t)sizeof(int32_t);
+    Py_ssize_t edges = self->indices.len / (Py_ssize_t)sizeof(int32_t);
+    if (offsets < 1 || offsets - 1 > INT32_MAX - 1) {
+        PyErr_SetString(PyExc_ValueError, "indptr must hold between 1 and 2**31 - 1 offsets");
+    } else if (self->weights.len != self->indices.len) {
+        PyErr_Format(PyExc_ValueError, "indices holds %zd edges, weights %zd",
+                     edges, self->weights.len / (Py_ssize_t)sizeof(int32_t));
+    } else {
+        self->graph.vertex_count = (int32_t)(offsets - 1);
+        self->graph.indptr = (const int32_t*)self->indptr.buf;
+        self->graph.indices = (const int32_t*)self->indices.buf;
+        self->graph.weights = (const int32_t*)self->weights.buf;
+        self->graph.edge_count = (size_t)edges;
+
+        size_t where;
+        switch (graph_check(&self->graph, &where)) {
+        case GRAPH_OK:
+            return (PyObject*)self;
+        case GRAPH_ERROR_INDPTR:
+            PyErr_Format(PyExc_ValueError, "indptr[%zu] breaks non-decreasing offsets from 0 to %zd",
+                         where, edges);
+            break;
+        case GRAPH_ERROR_INDEX:
+            PyErr_Format(PyExc_ValueError, "indices[%zu] is not a vertex", where);
+            break;
+        case GRAPH_ERROR_WEIGHT:
+            PyErr_Format(PyExc_ValueError, "weights[%zu] is negative", where);
+            break;
+        }
+    }
+
+    Py_DECREF(self);
+    return NULL;
+}
+
+// ---------- Buffers ----------
+
+// An array of count zeros with typecode 'q' or 'i', made by repeating a one-element array
+static PyObject* PyCSRGraph_new_array(const char* typecode, Py_ssize_t count) {
+    PyObject* module = PyImport_ImportModule("array");
+    if (!module) return NULL;
+
+    PyObject* unit = PyObject_CallMethod(module, "array", "s(i)", typecode, 0);
+    Py_DECREF(module);
+    if (!unit) return NULL;
+
+    PyObject* result = PySequence_Repeat(unit, count);
+    Py_DECREF(unit);
+    return result;
+}
+
+/**
+ * @brief Gets a writable C-contiguous buffer of native int64 values, such
+ * as an array('q') or a numpy int64 array.
+ * @return 1 with view filled, 0 if obj has no such buffer, or -1 with an exception set.
+ */
+static int PyCSRGraph_get_int64_buffer(PyObject* obj, Py_buffer* view) {
+    if (!PyObject_CheckBuffer(obj)) return 0;
+    if (PyObject_GetBuffer(obj, view, PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0) {
+        if (!PyErr_ExceptionMatches(PyExc_BufferError)) return -1;
+        PyErr_Clear();
+        return 0;
+    }
+
+    const char* format = view->format ? view->format : "B";
+    if (*format == '@' || *format == '=' || *format == (PY_LITTLE_ENDIAN ? '<' : '>')) format++;
+    if (view->itemsize == (Py_ssize_t)sizeof(int64_t) && (format[0] == 'q' || format[0] == 'l') && !format[1]) {
+        return 1;
+    }
+    PyBuffer_Release(view);
+    return 0;
+}
+
+/**
+ * @brief Gets the output buffer obj for count values: int64 distances or
+ * int32 predecessors.
+ *
+ * With obj set to None, *data is a PyMem block and view->obj stays NULL.
+ *
+ * @return 0 on success, -1 with an exception set.
+ */
+static int PyCSRGraph_get_output(PyObject* obj, const char* name, int wide, Py_ssize_t count, Py_buffer* view,
+                                 void** data) {
+    size_t itemsize = wide ? sizeof(int64_t) : sizeof(int32_t);
+    view->obj = NULL;
+    if (obj == Py_None) {
+        *data = PyMem_Malloc(itemsize * (size_t)(count > 0 ? count : 1));
+        if (!*data) PyErr_NoMemory();
+        return *data ? 0 : -1;
+    }
+
+    int status = wide ? PyCSRGraph_get_int64_buffer(obj, view)
+                      : pyds_get_int32_buffer_flags(obj, view, PyBUF_WRITABLE);
+    if (status == 0) {
+        view->obj = NULL;
+        PyErr_Format(PyExc_TypeError, "%s must be a writable C-contiguous %s buffer", name, wide ? "int64" : "int32");
+    }
+    if (status <= 0) return -1;
+
+    Py_ssize_t room = view->len / (Py_ssize_t)itemsize;
+    if (room < count) {
+        PyErr_Format(PyExc_ValueError, "%s holds %zd values, the results %zd", name, room, count);
+        PyBuffer_Release(view);
+        view->obj = NULL;
+        return -1;
+    }
+    *data = view->buf;
+    return 0;
+}
+
+static void PyCSRGraph_release_output(Py_buffer* view, void* data) {
+    if (view->obj) PyBuffer_Release(view);
+    else PyMem_Free(data);
+}
+
+static int PyCSRGraph_check_vertex(PyCSRGraphObject* self, const char* name, int32_t vertex) {
+    if (vertex >= 0 && vertex < self->graph.vertex_count) return 0;
+    PyErr_Format(PyExc_ValueError, "%s %d is not a vertex of a graph with %d", name, (int)vertex,
+                 (int)self->graph.vertex_count);
+    return -1;
+}
+
+/**
+ * @brief Copies the sources, one int or an iterable of ints, into a PyMem block.
+ * @return The block, or NULL with an exception set.
+ */
+static int32_t* PyCSRGraph_collect_sources(PyCSRGraphObject* self, PyObject* sources, Py_ssize_t* count) {
+    Py_ssize_t size = 0, capacity = 1;
+    int32_t* values = PyMem_Malloc(sizeof(int32_t));
+    if (!values) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    if (PyIndex_Check(sources)) {
+        if (pyds_as_int32(sources, &values[0]) < 0 || PyCSRGraph_check_vertex(self, "source", values[0]) < 0) {
+            PyMem_Free(values);
+            return NULL;
+        }
+        *count = 1;
+        return values;
+    }
+
+    PyObject* iterator = PyObject_GetIter(sources);
+    if (!iterator) {
+        PyMem_Free(values);
+        return NULL;
+    }
+    PyObject* item;
+    while ((item = PyIter_Next(iterator))) {
+        if (size == capacity) {
+            int32_t* grown = PyMem_Realloc(values, sizeof(int32_t) * (size_t)capacity * 2);
+            if (!grown) {
+                Py_DECREF(item);
+                PyErr_NoMemory();
+                break;
+            }
+            values = grown;
+            capacity *= 2;
+        }
+        int status = pyds_as_int32(item, &values[size]);
+        Py_DECREF(item);
+        if (status < 0 || PyCSRGraph_check_vertex(self, "source", values[size]) < 0) break;
+        size++;
+    }
+    Py_DECREF(iterator);
+
+    if (PyErr_Occurred()) {
+        PyMem_Free(values);
+        return NULL;
+    }
+    *count = size;
+    return values;
+}
+
+// ---------- Batches ----------
+
+typedef struct {
+    const graph_csr_t* graph;
+    graph_workspace_t* workspace;
+    const int32_t* sources;
+    Py_ssize_t count;
+    int64_t* distances;
+    int32_t* predecessors;
+    Py_ssize_t first;          // Row of this worker's first source
+    Py_ssize_t step;           // Rows between this worker's sources
+    PyThread_type_lock done;   // Held until the worker's thread finishes, or NULL
+} PyGraphWorker;
+
+static void PyGraphWorker_run(PyGraphWorker* worker) {
+    size_t n = (size_t)worker->graph->vertex_count;
+    for (Py_ssize_t row = worker->first; row < worker->count; row += worker->step) {
+        graph_shortest_paths(worker->graph, worker->workspace, worker->sources[row], GRAPH_NO_VERTEX, NULL,
+                             worker->distances + (size_t)row * n, worker->predecessors + (size_t)row * n);
+    }
+}
+
+static void PyGraphWorker_thread(void* arg) {
+    PyGraphWorker* worker = (PyGraphWorker*)arg;
+    PyGraphWorker_run(worker);
+    PyThread_release_lock(worker->done);
+}
+
+/**
+ * @brief Runs Dijkstra from every source, the rows dealt round-robin to
+ * threads workers. The searches run without the GIL; a worker whose thread
+ * cannot be started runs on the calling thread.
+ *
+ * Workspaces are allocated beforehand, as the allocator reports to
+ * tracemalloc and needs the GIL.
+ *
+ * @return 0 on success, -1 with MemoryError set.
+ */
+static int PyCSRGraph_run_batch(PyCSRGraphObject* self, const int32_t* sources, Py_ssize_t count, int64_t* distances,
+                                int32_t* predecessors, int threads) {
+    if (count == 0) return 0;
+    if (threads > count) threads = (int)count;
+
+    PyGraphWorker* workers = PyMem_Calloc((size_t)threads, sizeof(PyGraphWorker));
+    if (!workers) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    int status = 0;
+    for (int w = 0; w < threads; w++) {
+        workers[w].graph = &self->graph;
+        workers[w].workspace = graph_workspace_create(self->graph.vertex_count);
+        workers[w].sources = sources;
+        workers[w].count = count;
+        workers[w].distances = distances;
+        workers[w].predecessors = predecessors;
+        workers[w].first = w;
+        workers[w].step = threads;
+        if (!workers[w].workspace) {
+            PyErr_NoMemory();
+            status = -1;
+            break;
+        }
+    }
+
+    if (status == 0) {
+        Py_BEGIN_ALLOW_THREADS
+        for (int w = 1; w < threads; w++) {
+            PyThread_type_lock done = PyThread_allocate_lock();
+            if (!done) continue;
+            PyThread_acquire_lock(done, WAIT_LOCK);
+            workers[w].done = done;
+            if (PyThread_start_new_thread(PyGraphWorker_thread, &workers[w]) == (unsigned long)-1) {
+                workers[w].done = NULL;
+                PyThread_free_lock(done);
+            }
+        }
+        PyGraphWorker_run(&workers[0]);
+        for (int w = 1; w < threads; w++) {
+            if (workers[w].done) {
+                PyThread_acquire_lock(workers[w].done, WAIT_LOCK);
+                PyThread_free_lock(workers[w].done);
+            } else {
+                PyGraphWorker_run(&workers[w]);
+            }
+        }
+        Py_END_ALLOW_THREADS
+    }
+
+    for (int w = 0; w < threads; w++) graph_workspace_free(workers[w].workspace);
+    PyMem_Free(workers);
+    return status;
+}
+
+// ---------- Methods ----------
+
+static PyObject* PyCSRGraph_dijkstra(PyCSRGraphObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"sources", "distances", "predecessors", "threads", NULL};
+    PyObject* sources_arg;
+    PyObject* distances = Py_None;
+    PyObject* predecessors = Py_None;
+    int threads = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$OOi:dijkstra", kwlist, &sources_arg, &distances,
+                                     &predecessors, &threads)) {
+        return NULL;
+    }
+    if (threads < 1) {
+        PyErr_SetString(PyExc_ValueError, "threads must be at least 1");
+        return NULL;
+    }
+
+    Py_ssize_t count;
+    int32_t* sources = PyCSRGraph_collect_sources(self, sources_arg, &count);
+    if (!sources) return NULL;
+
+    Py_ssize_t n = self->graph.vertex_count;
+    if (n > 0 && count > PY_SSIZE_T_MAX / (Py_ssize_t)sizeof(int64_t) / n) {
+        PyMem_Free(sources);
+        return PyErr_NoMemory();
+    }
+    Py_ssize_t total = count * n;
+
+    // Results go into new arrays unless buffers were passed
+    if (distances == Py_None) distances = PyCSRGraph_new_array("q", total);
+    else Py_INCREF(distances);
+    if (predecessors == Py_None) predecessors = distances ? PyCSRGraph_new_array("i", total) : NULL;
+    else Py_INCREF(predecessors);
+
+    PyObject* result = NULL;
+    Py_buffer distance_view, predecessor_view;
+    void *distance_data, *predecessor_data;
+    if (distances && predecessors &&
+        PyCSRGraph_get_output(distances, "distances", 1, total, &distance_view, &distance_data) == 0) {
+        if (PyCSRGraph_get_output(predecessors, "predecessors", 0, total, &predecessor_view, &predecessor_data) == 0) {
+            if (PyCSRGraph_run_batch(self, sources, count, distance_data, predecessor_data, threads) == 0) {
+                result = PyTuple_Pack(2, distances, predecessors);
+            }
+            PyCSRGraph_release_output(&predecessor_view, predecessor_data);
+        }
+        PyCSRGraph_release_output(&distance_view, distance_data);
+    }
+
+    Py_XDECREF(distances);
+    Py_XDECREF(predecessors);
+    PyMem_Free(sources);
+    return result;
+}
+
+// The vertices from source to target, read back along predecessors
+static PyObject* PyCSRGraph_path(const int32_t* predecessors, int32_t source, int32_t target, int32_t n) {
+    Py_ssize_t length = 1;
+    for (int32_t v = target; v != source && length <= n; v = predecessors[v]) length++;
+
+    PyObject* path = PyList_New(length);
+    if (!path) return NULL;
+    int32_t v = target;
+    for (Py_ssize_t i = length - 1; i >= 0; i--) {
+        PyObject* item = PyLong_FromLong(v);
+        if (!item) {
+            Py_DECREF(path);
+            return NULL;
+        }
+        PYDS_LIST_SET_ITEM(path, i, item);
+        if (i > 0) v = predecessors[v];
+    }
+    return path;
+}
+
+static PyObject* PyCSRGraph_astar(PyCSRGraphObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"source", "target", "heuristic", "distances", "predecessors", NULL};
+    int32_t source, target;
+    PyObject* heuristic_arg;
+    PyObject* distances = Py_None;
+    PyObject* predecessors = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "iiO|$OO:astar", kwlist, &source, &target, &heuristic_arg,
+                                     &distances, &predecessors)) {
+        return NULL;
+    }
+    if (PyCSRGraph_check_vertex(self, "source", source) < 0 || PyCSRGraph_check_vertex(self, "target", target) < 0) {
+        return NULL;
+    }
+
+    Py_ssize_t n = self->graph.vertex_count;
+    Py_buffer heuristic;
+    if (heuristic_arg == Py_None) {
+        heuristic.obj = NULL;
+        heuristic.buf = NULL;
+    } else {
+        if (PyCSRGraph_get_input(heuristic_arg, "heuristic", &heuristic) < 0) return NULL;
+        if (heuristic.len / (Py_ssize_t)sizeof(int32_t) != n) {
+            PyErr_Format(PyExc_ValueError, "heuristic holds %zd values, the graph %zd vertices",
+                         heuristic.len / (Py_ssize_t)sizeof(int32_t), n);
+            PyBuffer_Release(&heuristic);
+            return NULL;
+        }
+    }
+
+    PyObject* result = NULL;
+    Py_buffer distance_view, predecessor_view;
+    void *distance_data, *predecessor_data;
+    if (PyCSRGraph_get_output(distances, "distances", 1, n, &distance_view, &distance_data) == 0) {
+        if (PyCSRGraph_get_output(predecessors, "predecessors", 0, n, &predecessor_view, &predecessor_data) == 0) {
+            graph_workspace_t* workspace = graph_workspace_create((int32_t)n);
+            int64_t distance = GRAPH_UNREACHED;
+            if (workspace) {
+                Py_BEGIN_ALLOW_THREADS
+                distance = graph_shortest_paths(&self->graph, workspace, source, target, heuristic.buf,
+                                                distance_data, predecessor_data);
+                Py_END_ALLOW_THREADS
+                graph_workspace_free(workspace);
+            }
+
+            if (!workspace) {
+                PyErr_NoMemory();
+            } else if (distance == GRAPH_UNREACHED) {
+                Py_INCREF(Py_None);
+                result = Py_None;
+            } else {
+                PyObject* path = PyCSRGraph_path(predecessor_data, source, target, (int32_t)n);
+                if (path) {
+                    result = Py_BuildValue("(LN)", (long long)distance, path);
+                }
+            }
+            PyCSRGraph_release_output(&predecessor_view, predecessor_data);
+        }
+        PyCSRGraph_release_output(&distance_view, distance_data);
+    }
+
+    if (heuristic.obj) PyBuffer_Release(&heuristic);
+    return result;
+}
+
+static PyObject* PyCSRGraph_prim(PyCSRGraphObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"root", "predecessors", NULL};
+    int32_t root = 0;
+    PyObject* predecessors = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|i$O:prim", kwlist, &root, &predecessors)) return NULL;
+
+    Py_ssize_t n = self->graph.vertex_count;
+    if (n == 0 && root == 0) {
+        // The empty forest
+        if (predecessors == Py_None) predecessors = PyCSRGraph_new_array("i", 0);
+        else Py_INCREF(predecessors);
+        return predecessors ? Py_BuildValue("(iN)", 0, predecessors) : NULL;
+    }
+    if (PyCSRGraph_check_vertex(self, "root", root) < 0) return NULL;
+
+    if (predecessors == Py_None) predecessors = PyCSRGraph_new_array("i", n);
+    else Py_INCREF(predecessors);
+    if (!predecessors) return NULL;
+
+    PyObject* result = NULL;
+    Py_buffer view;
+    void* data;
+    if (PyCSRGraph_get_output(predecessors, "predecessors", 0, n, &view, &data) == 0) {
+        graph_workspace_t* workspace = graph_workspace_create((int32_t)n);
+        int64_t total = 0;
+        if (workspace) {
+            Py_BEGIN_ALLOW_THREADS
+            total = graph_prim(&self->graph, workspace, root, data);
+            Py_END_ALLOW_THREADS
+            graph_workspace_free(workspace);
+        }
+
+        if (workspace) result = Py_BuildValue("(LO)", (long long)total, predecessors);
+        else PyErr_NoMemory();
+        PyCSRGraph_release_output(&view, data);
+    }
+
+    Py_DECREF(predecessors);
+    return result;
+}
+
+static Py_ssize_t PyCSRGraph_length(PyCSRGraphObject* self) {
+    return (Py_ssize_t)self->graph.vertex_count;
+}
+
+static PyObject* PyCSRGraph_get_vertex_count(PyCSRGraphObject* self, void* Py_UNUSED(closure)) {
+    return PyLong_FromLong(self->graph.vertex_count);
+}
+
+static PyObject* PyCSRGraph_get_edge_count(PyCSRGraphObject* self, void* Py_UNUSED(closure)) {
+    // Edges the offsets cover; the buffers may be longer
+    return PyLong_FromLong(self->graph.indptr[self->graph.vertex_count] - self->graph.indptr[0]);
+}
+
+static PyGetSetDef PyCSRGraph_getset[] = {
+    {"vertex_count", (getter)PyCSRGraph_get_vertex_count, NULL, "Number of vertices, len(indptr) - 1.", NULL},
+    {"edge_count", (getter)PyCSRGraph_get_edge_count, NULL, "Number of edges indptr covers.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyCSRGraph_methods[] = {
+    {"dijkstra", (PyCFunction)(void(*)(void))PyCSRGraph_dijkstra, METH_VARARGS | METH_KEYWORDS,
+     "Return the distances and predecessors of shortest paths from each source."},
+    {"astar", (PyCFunction)(void(*)(void))PyCSRGraph_astar, METH_VARARGS | METH_KEYWORDS,
+     "Return the length and vertices of a shortest path from source to target, or None."},
+    {"prim", (PyCFunction)(void(*)(void))PyCSRGraph_prim, METH_VARARGS | METH_KEYWORDS,
+     "Return the total weight and parents of a minimum spanning forest."},
+    {NULL}
+};
+
+static PyType_Slot PyCSRGraph_slots[] = {
+    {Py_tp_doc, (void*)"CSR Graph\n"
+        "\n"
+        "CSRGraph(indptr, indices, weights) is a directed graph over three int32 buffers in compressed sparse row "
+        "form, such as the arrays of a scipy.sparse.csr_array or numpy arrays: the edges leaving vertex u are "
+        "indices[indptr[u]:indptr[u + 1]], with non-negative weights. The buffers are read in place and checked "
+        "once. Every search runs without the GIL. Distances are int64 and -1 for unreached vertices; "
+        "predecessors are int32 and -1 for sources, roots and unreached vertices.\n"
+        "\n"
+        "- dijkstra(sources, *, distances=None, predecessors=None, threads=1) -> (distances, predecessors) - "
+        "Shortest paths from a source, or from each of an iterable of sources, one row of len(graph) results "
+        "each. The results go into new array('q') and array('i'), or into the buffers passed. threads splits "
+        "the sources between that many threads.\n"
+        "- astar(source, target, heuristic, *, distances=None, predecessors=None) -> Optional[(int, list)] - "
+        "Length and vertices of a shortest path, guided by heuristic, an int32 buffer of lower bounds on each "
+        "vertex's distance to target, or None for plain Dijkstra.\n"
+        "- prim(root=0, *, predecessors=None) -> (int, predecessors) - Total weight and parents of a minimum "
+        "spanning forest of an undirected graph, which must list every edge both ways.\n"
+        "- vertex_count -> int - Number of vertices, also len(graph).\n"
+        "- edge_count -> int - Number of edges indptr covers.\n"},
+    {Py_tp_methods, PyCSRGraph_methods},
+    {Py_tp_getset, PyCSRGraph_getset},
+    {Py_tp_new, PyCSRGraph_new},
+    {Py_tp_dealloc, PyCSRGraph_dealloc},
+    {Py_sq_length, PyCSRGraph_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyCSRGraph_spec = {
+    .name = "pydatastructs.graph.CSRGraph",
+    .basicsize = sizeof(PyCSRGraphObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyCSRGraph_slots,
+};
+
+typedef struct {
+    PyObject* type;  // CSRGraph
+} graph_module_state;
+
+static int graph_module_exec(PyObject* m) {
+    graph_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyCSRGraph_spec, NULL);
+    if (!state->type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int graph_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    graph_module_state* state = PyModule_GetState(m);
+    if (state) Py_VISIT(state->type);
+    return 0;
+}
+
+static int graph_module_clear(PyObject* m) {
+    graph_module_state* state = PyModule_GetState(m);
+    if (state) Py_CLEAR(state->type);
+    return 0;
+}
+
+static void graph_module_free(void* m) {
+    graph_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot graph_module_slots[] = {
+    {Py_mod_exec, (void*)graph_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef graph_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "graph",
+    .m_doc = "This module exposes shortest-path and minimum spanning forest kernels over CSR graphs "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(graph_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = graph_module_slots,
+    .m_traverse = graph_module_traverse,
+    .m_clear = graph_module_clear,
+    .m_free = graph_module_free,
+};
+
+PyMODINIT_FUNC PyInit_graph(void) {
+    return PyModuleDef_Init(&graph_module);
+}
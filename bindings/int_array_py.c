@@ -0,0 +1,591 @@
+// bindings/int_array_py.c
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdlib.h>
+#include "../src/dynamic_array.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "serialize.h"
+#include "stats.h"
+#include "shared.h"
+
+typedef struct {
+    PyObject_HEAD;
+    dynamic_array_t* array;
+    Py_buffer view;  // Export of the shared region; view.obj is NULL for private arrays
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
+} PyIntArrayObject;
+
+static PyObject* PyIntArray_set_error(dyn_array_status_t status, PyObject* path) {
+    switch (status) {
+        case DYN_ARRAY_ERROR_NO_MEMORY:
+            return PyErr_NoMemory();
+        case DYN_ARRAY_ERROR_OUT_OF_RANGE:
+            PyErr_SetString(PyExc_IndexError, "IntArray index out of range");
+            break;
+        case DYN_ARRAY_ERROR_FORMAT:
+            PyErr_Format(PyExc_ValueError, "%S is not an IntArray file", path);
+            break;
+        case DYN_ARRAY_ERROR_CHECKSUM:
+            PyErr_Format(PyExc_ValueError, "%S failed checksum verification", path);
+            break;
+        case DYN_ARRAY_ERROR_UNSUPPORTED:
+            PyErr_SetString(PyExc_NotImplementedError, "File-backed arrays are not supported by this build");
+            break;
+        case DYN_ARRAY_ERROR_IO:
+            if (path) PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+            else PyErr_SetFromErrno(PyExc_OSError);
+            break;
+        default:
+            PyErr_SetString(PyExc_RuntimeError, "IntArray operation failed");
+            break;
+    }
+    return NULL;
+}
+
+static void PyIntArray_dealloc(PyIntArrayObject* self) {
+    if (self->array) dynamic_array_destroy(self->array);
+    if (self->view.obj) PyBuffer_Release(&self->view);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyIntArray_alloc(PyTypeObject* type) {
+    PyIntArrayObject* self;
+    self = (PyIntArrayObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
+    self->array = dynamic_array_create(0);
+    if (!self->array) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+
+    return (PyObject*)self;
+}
+
+static PyObject* PyIntArray_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+    return PyIntArray_alloc(type);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyIntArray_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (pyds_check_no_args((PyTypeObject*)type, PyVectorcall_NARGS(nargsf), kwnames ? PyTuple_GET_SIZE(kwnames) : 0) < 0) return NULL;
+    return PyIntArray_alloc((PyTypeObject*)type);
+}
+#endif
+
+static PyObject* PyIntArray_cls_open(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"path", "verify", NULL};
+    PyObject* path;
+    PyObject* encoded_path;
+    int verify = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", kwlist, &path, &verify)) return NULL;
+    if (!PyUnicode_FSConverter(path, &encoded_path)) return NULL;
+
+    dynamic_array_t* array = pyds_malloc(sizeof(dynamic_array_t));
+    if (!array) {
+        Py_DECREF(encoded_path);
+        return PyErr_NoMemory();
+    }
+
+    dyn_array_status_t status = dynamic_array_open(array, PyBytes_AsString(encoded_path), verify);
+    Py_DECREF(encoded_path);
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(array);
+        return PyIntArray_set_error(status, path);
+    }
+
+    PyIntArrayObject* obj = PyObject_New(PyIntArrayObject, (PyTypeObject*)cls);
+    if (!obj) {
+        dynamic_array_destroy(array);
+        return PyErr_NoMemory();
+    }
+
+    obj->array = array;
+    obj->view.obj = NULL;
+    PYDS_LATENCY_RESET(obj);
+    return (PyObject*)obj;
+}
+
+static PyObject* PyIntArray_cls_attach(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"buffer", "create", NULL};
+    PyObject* buffer;
+    int create = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", kwlist, &buffer, &create)) return NULL;
+
+    Py_buffer view;
+    if (pyds_shared_view(buffer, &view) < 0) return NULL;
+
+    dynamic_array_t* array = pyds_malloc(sizeof(dynamic_array_t));
+    if (!array) {
+        PyBuffer_Release(&view);
+        return PyErr_NoMemory();
+    }
+
+    dyn_array_status_t status = dynamic_array_attach(array, view.buf, (size_t)view.len, create);
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(array);
+        PyBuffer_Release(&view);
+        switch (status) {
+            case DYN_ARRAY_ERROR_UNSUPPORTED:
+                PyErr_SetString(PyExc_NotImplementedError, "Shared arrays are not supported by this build");
+                return NULL;
+            case DYN_ARRAY_ERROR_NO_MEMORY:
+                return pyds_shared_error(SHARED_REGION_ERROR_TOO_SMALL, "IntArray");
+            case DYN_ARRAY_ERROR_FORMAT:
+                return pyds_shared_error(SHARED_REGION_ERROR_FORMAT, "IntArray");
+            default:
+                return pyds_shared_error(SHARED_REGION_ERROR_MUTEX, "IntArray");
+        }
+    }
+
+    PyIntArrayObject* obj = PyObject_New(PyIntArrayObject, (PyTypeObject*)cls);
+    if (!obj) {
+        dynamic_array_destroy(array);
+        PyBuffer_Release(&view);
+        return PyErr_NoMemory();
+    }
+
+    obj->array = array;
+    obj->view = view;
+    PYDS_LATENCY_RESET(obj);
+    return (PyObject*)obj;
+}
+
+static PyObject* PyIntArray_set_grow_error(PyIntArrayObject* self, dyn_array_status_t status) {
+    // Shared regions have a fixed capacity, so running out of room is not an allocation failure
+    if (status == DYN_ARRAY_ERROR_NO_MEMORY && self->view.obj) {
+        PyErr_SetString(PyExc_MemoryError, "shared IntArray is full");
+        return NULL;
+    }
+    return PyIntArray_set_error(status, NULL);
+}
+
+static PyObject* PyIntArray_append(PyIntArrayObject* self, PyObject* arg) {
+    int32_t value;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    PYDS_TIMED(self, status = dynamic_array_push_back(self->array, value));
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+    if (status != DYN_ARRAY_OK) return PyIntArray_set_grow_error(self, status);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyIntArray_pop(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    int32_t removed;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    PYDS_TIMED(self, status = dynamic_array_pop_back(self->array, &removed));
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+    if (status == DYN_ARRAY_ERROR_OUT_OF_RANGE) Py_RETURN_NONE;
+    if (status != DYN_ARRAY_OK) return PyIntArray_set_error(status, NULL);
+
+    return PyLong_FromLong(removed);
+}
+
+static PyObject* PyIntArray_clear(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    status = dynamic_array_clear(self->array);
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+    if (status != DYN_ARRAY_OK) return PyIntArray_set_error(status, NULL);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyIntArray_reserve(PyIntArrayObject* self, PyObject* arg) {
+    Py_ssize_t capacity = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+
+    if (capacity == -1 && PyErr_Occurred()) return NULL;
+    if (capacity < 0) {
+        PyErr_SetString(PyExc_ValueError, "capacity must be non-negative");
+        return NULL;
+    }
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    status = dynamic_array_reserve(self->array, (size_t)capacity);
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+    if (status != DYN_ARRAY_OK) return PyIntArray_set_grow_error(self, status);
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyIntArray_sync(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = dynamic_array_sync(self->array);
+    Py_END_CRITICAL_SECTION();
+    if (status != DYN_ARRAY_OK) return PyIntArray_set_error(status, NULL);
+
+    Py_RETURN_NONE;
+}
+
+typedef struct {
+    PyObject* owner;
+    const dynamic_array_t* array;
+    int32_t* snapshot;  // Copy of a shared array taken under its lock, or NULL
+    size_t index;
+    size_t size;
+} PyIntArrayCursor;
+
+// Called inside the critical section of self
+static int PyIntArray_cursor_init(PyIntArrayObject* self, PyIntArrayCursor* cursor) {
+    cursor->owner = (PyObject*)self;
+    cursor->array = self->array;
+    cursor->snapshot = NULL;
+    cursor->index = 0;
+    cursor->size = dynamic_array_size(self->array);
+    if (!self->view.obj) return 0;
+
+    // Building Python objects can run arbitrary code, so shared arrays are copied out and unlocked first
+    dynamic_array_lock(self->array);
+    cursor->size = dynamic_array_size(self->array);
+    cursor->snapshot = PyMem_Malloc((cursor->size + 1) * sizeof(int32_t));
+    for (size_t i = 0; cursor->snapshot && i < cursor->size; i++) {
+        cursor->snapshot[i] = *dynamic_array_slot(self->array, i);
+    }
+    dynamic_array_unlock(self->array);
+
+    if (!cursor->snapshot) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static Py_ssize_t PyIntArray_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    PyIntArrayCursor* cursor = (PyIntArrayCursor*)ctx;
+    Py_ssize_t n = 0;
+    if (cursor->snapshot) {
+        n = Py_MIN(max, (Py_ssize_t)(cursor->size - cursor->index));
+        memcpy(out, cursor->snapshot + cursor->index, (size_t)n * sizeof(int32_t));
+        cursor->index += (size_t)n;
+        return n;
+    }
+    while (n < max && cursor->index < dynamic_array_size(cursor->array)) {
+        out[n++] = *dynamic_array_slot(cursor->array, cursor->index++);
+    }
+    return n;
+}
+
+// dump() calls back into Python between chunks, so each chunk is read under the critical section
+static Py_ssize_t PyIntArray_fill_locked(void* ctx, int32_t* out, Py_ssize_t max) {
+    Py_ssize_t n;
+    Py_BEGIN_CRITICAL_SECTION(((PyIntArrayCursor*)ctx)->owner);
+    n = PyIntArray_fill(ctx, out, max);
+    Py_END_CRITICAL_SECTION();
+
+    return n;
+}
+
+static PyObject* PyIntArray_to_list(PyIntArrayObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+
+    PyObject* result = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyIntArrayCursor cursor;
+    if (PyIntArray_cursor_init(self, &cursor) == 0) {
+        result = pyds_int32_result((Py_ssize_t)cursor.size, PyIntArray_fill, &cursor, as_array);
+        PyMem_Free(cursor.snapshot);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return result;
+}
+
+static int PyIntArray_extend(void* ctx, const int32_t* values, Py_ssize_t count) {
+    dynamic_array_t* array = (dynamic_array_t*)ctx;
+
+    dyn_array_status_t status = dynamic_array_reserve(array, dynamic_array_size(array) + (size_t)count);
+    for (Py_ssize_t i = 0; status == DYN_ARRAY_OK && i < count; i++) {
+        status = dynamic_array_push_back(array, values[i]);
+    }
+    if (status != DYN_ARRAY_OK) {
+        PyIntArray_set_error(status, NULL);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject* PyIntArray_tobytes(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* bytes = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyIntArrayCursor cursor;
+    if (PyIntArray_cursor_init(self, &cursor) == 0) {
+        bytes = pyds_tobytes((Py_ssize_t)cursor.size, PyIntArray_fill, &cursor);
+        PyMem_Free(cursor.snapshot);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return bytes;
+}
+
+static PyObject* PyIntArray_cls_frombytes(PyObject* cls, PyObject* data) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_frombytes(data, PyIntArray_extend, ((PyIntArrayObject*)obj)->array) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static PyObject* PyIntArray_reduce(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* payload = PyIntArray_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    return result;
+}
+
+static PyObject* PyIntArray_dump(PyIntArrayObject* self, PyObject* fileobj) {
+    PyIntArrayCursor cursor;
+    int init_status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    init_status = PyIntArray_cursor_init(self, &cursor);
+    Py_END_CRITICAL_SECTION();
+    if (init_status < 0) return NULL;
+
+    int status = pyds_dump(fileobj, PYDS_CONTAINER_INT_ARRAY, (Py_ssize_t)cursor.size, PyIntArray_fill_locked, &cursor);
+    PyMem_Free(cursor.snapshot);
+    if (status < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyIntArray_cls_load(PyObject* cls, PyObject* fileobj) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_load(fileobj, PYDS_CONTAINER_INT_ARRAY, PyIntArray_extend, ((PyIntArrayObject*)obj)->array) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static Py_ssize_t PyIntArray_length(PyIntArrayObject* self) {
+    size_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    size = dynamic_array_size(self->array);
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyIntArray_item(PyIntArrayObject* self, Py_ssize_t index) {
+    int32_t value;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    PYDS_TIMED(self, status = index < 0 ? DYN_ARRAY_ERROR_OUT_OF_RANGE : dynamic_array_get(self->array, (size_t)index, &value));
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+
+    if (status != DYN_ARRAY_OK) {
+        PyErr_SetString(PyExc_IndexError, "IntArray index out of range");
+        return NULL;
+    }
+
+    return PyLong_FromLong(value);
+}
+
+static int PyIntArray_ass_item(PyIntArrayObject* self, Py_ssize_t index, PyObject* value) {
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError, "IntArray does not support item deletion");
+        return -1;
+    }
+
+    int32_t v;
+    if (pyds_as_int32(value, &v) < 0) return -1;
+
+    dyn_array_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    PYDS_TIMED(self, status = index < 0 ? DYN_ARRAY_ERROR_OUT_OF_RANGE : dynamic_array_set(self->array, (size_t)index, v));
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+
+    if (status != DYN_ARRAY_OK) {
+        PyErr_SetString(PyExc_IndexError, "IntArray assignment index out of range");
+        return -1;
+    }
+
+    return 0;
+}
+
+static PyObject* PyIntArray_sizeof(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    usage = dynamic_array_memory_usage(self->array);
+    dynamic_array_unlock(self->array);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyIntArrayObject) + usage);
+}
+
+static PyObject* PyIntArray_stats(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    dynamic_array_get_stats(self->array, &stats);
+    dynamic_array_unlock(self->array);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyIntArray_reset_stats(PyIntArrayObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    dynamic_array_lock(self->array);
+    dynamic_array_reset_stats(self->array);
+    dynamic_array_unlock(self->array);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyMethodDef PyIntArray_methods[] = {
+    {"open", (PyCFunction)(void(*)(void))PyIntArray_cls_open, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Open or create an array backed by a memory-mapped file."},
+    {"attach", (PyCFunction)(void(*)(void))PyIntArray_cls_attach, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Use an array stored in a shared memory buffer, creating an empty one if create is true."},
+    {"append", (PyCFunction)PyIntArray_append, METH_O, "Add a value at the end."},
+    {"pop", (PyCFunction)PyIntArray_pop, METH_NOARGS, "Remove the last value. Returns the value removed. If there is no element, return None."},
+    {"clear", (PyCFunction)PyIntArray_clear, METH_NOARGS, "Remove all values, keeping the allocated capacity."},
+    {"reserve", (PyCFunction)PyIntArray_reserve, METH_O, "Grow the capacity to at least the given number of values."},
+    {"sync", (PyCFunction)PyIntArray_sync, METH_NOARGS, "Flush a file-backed array to disk. Does nothing for in-memory arrays."},
+    {"to_list", (PyCFunction)(void(*)(void))PyIntArray_to_list, METH_VARARGS | METH_KEYWORDS, "Convert to Python list, or to array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyIntArray_tobytes, METH_NOARGS, "Return the values as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)PyIntArray_cls_frombytes, METH_O | METH_CLASS, "Build an array from little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyIntArray_dump, METH_O, "Write the array to a binary file object."},
+    {"load", (PyCFunction)PyIntArray_cls_load, METH_O | METH_CLASS, "Read an array written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyIntArray_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyIntArray_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyIntArray_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyIntArray_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
+    {NULL}
+};
+
+static PyType_Slot PyIntArray_slots[] = {
+    {Py_tp_doc, (void*)"Integer Array\n"
+        "\n"
+        "- open(path: str, verify: bool = False) - Open or create an array backed by a memory-mapped file.\n"
+        "- attach(buffer, create: bool = False) - Use an array stored in a shared memory buffer, creating an empty one if create is true.\n"
+        "- append(value: int) - Add a value at the end.\n"
+        "- pop() -> Optional[int] - Remove the last value. Returns the value removed.\n"
+        "- clear() - Remove all values, keeping the allocated capacity.\n"
+        "- reserve(capacity: int) - Grow the capacity to at least the given number of values.\n"
+        "- sync() - Flush a file-backed array to disk. Does nothing for in-memory arrays.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Convert to Python list, or to array('i') if as_array is true.\n"
+        "- tobytes() -> bytes - Return the values as little-endian int32 bytes.\n"
+        "- frombytes(data: bytes) -> IntArray - Build an array from little-endian int32 bytes.\n"
+        "- dump(file) - Write the array to a binary file object.\n"
+        "- load(file) -> IntArray - Read an array written by dump() from a binary file object.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"
+        "- len(array) -> int - Get number of items.\n"
+        "- array[index] - Get or set an item.\n"},
+    {Py_tp_methods, PyIntArray_methods},
+    {Py_tp_new, PyIntArray_new},
+    {Py_tp_dealloc, PyIntArray_dealloc},
+    {Py_sq_length, PyIntArray_length},
+    {Py_sq_item, PyIntArray_item},
+    {Py_sq_ass_item, PyIntArray_ass_item},
+    {0, NULL}
+};
+
+static PyType_Spec PyIntArray_spec = {
+    .name = "pydatastructs.int_array.IntArray",
+    .basicsize = sizeof(PyIntArrayObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyIntArray_slots,
+};
+
+typedef struct {
+    PyObject* type;  // IntArray
+} int_array_module_state;
+
+static int int_array_module_exec(PyObject* m) {
+    int_array_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyIntArray_spec, PYDS_VECTORCALL(PyIntArray_vectorcall));
+    if (!state->type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int int_array_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    int_array_module_state* state = PyModule_GetState(m);
+    if (state) Py_VISIT(state->type);
+    return 0;
+}
+
+static int int_array_module_clear(PyObject* m) {
+    int_array_module_state* state = PyModule_GetState(m);
+    if (state) Py_CLEAR(state->type);
+    return 0;
+}
+
+static void int_array_module_free(void* m) {
+    int_array_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot int_array_module_slots[] = {
+    {Py_mod_exec, (void*)int_array_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef int_array_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "int_array",
+    .m_doc = "This module exposes a high-performance, memory-efficient integer dynamic array "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(int_array_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = int_array_module_slots,
+    .m_traverse = int_array_module_traverse,
+    .m_clear = int_array_module_clear,
+    .m_free = int_array_module_free,
+};
+
+PyMODINIT_FUNC PyInit_int_array(void) {
+    return PyModuleDef_Init(&int_array_module);
+}
@@ -1,50 +1,90 @@
 // bindings/linked_list_py.c
 
-#define PY_SSYZE_T_CLEAN
+#define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "../src/linked_list.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "objects.h"
+#include "serialize.h"
+#include "stats.h"
 
 typedef struct {
     PyObject_HEAD;
     LinkedList* ll;
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
 } PyLinkedListObject;
 
 static void PyLinkedList_dealloc(PyLinkedListObject* self) {
     linked_list_free(self->ll);
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    pyds_type_free((PyObject*)self);
 }
 
-static PyObject* PyLinkedList_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+static PyObject* PyLinkedList_alloc(PyTypeObject* type) {
     PyLinkedListObject* self;
-    self = (PyLinkedListObject*)type->tp_alloc(type, 0);
+    self = (PyLinkedListObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
     self->ll = linked_list_create();
+    if (!self->ll) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
 
     return (PyObject*)self;
 }
 
-static PyObject* PyLinkedList_prepend(PyLinkedListObject* self, PyObject* args) {
-    int value;
+static PyObject* PyLinkedList_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+    return PyLinkedList_alloc(type);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyLinkedList_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (pyds_check_no_args((PyTypeObject*)type, PyVectorcall_NARGS(nargsf), kwnames ? PyTuple_GET_SIZE(kwnames) : 0) < 0) return NULL;
+    return PyLinkedList_alloc((PyTypeObject*)type);
+}
+#endif
+
+static PyObject* PyLinkedList_prepend(PyLinkedListObject* self, PyObject* arg) {
+    int32_t value;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
 
-    if(!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    linked_list_prepend(self->ll, value);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, linked_list_prepend(self->ll, value));
+    Py_END_CRITICAL_SECTION();
 
     Py_RETURN_NONE;
 }
 
-static PyObject* PyLinkedList_pop(PyLinkedListObject* self) {
+static PyObject* PyLinkedList_pop(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
     int removed;
+    bool found;
 
-    if(!linked_list_pop(self->ll, &removed)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = linked_list_pop(self->ll, &removed));
+    Py_END_CRITICAL_SECTION();
+
+    if(!found) {
         Py_RETURN_NONE;
     }
 
     return PyLong_FromLong(removed);
 }
 
-static PyObject* PyLinkedList_peek(PyLinkedListObject* self) {
+static PyObject* PyLinkedList_peek(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
     int peeked;
+    bool found;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = linked_list_peek(self->ll, &peeked));
+    Py_END_CRITICAL_SECTION();
 
-    if(!linked_list_peek(self->ll, &peeked)) {
+    if(!found) {
         Py_RETURN_NONE;
     }
 
@@ -52,57 +92,461 @@ static PyObject* PyLinkedList_peek(PyLinkedListObject* self) {
 }
 
 
+static Py_ssize_t PyLinkedList_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    Node** current = (Node**)ctx;
+    Py_ssize_t n = 0;
+    while (n < max && *current) {
+        out[n++] = (*current)->value;
+        *current = (*current)->next;
+    }
+    return n;
+}
+
+// Values arrive head first, so they are prepended and the list is reversed once complete
+static int PyLinkedList_extend_reversed(void* ctx, const int32_t* values, Py_ssize_t count) {
+    LinkedList* ll = (LinkedList*)ctx;
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (!linked_list_prepend(ll, values[i])) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static PyObject* PyLinkedList_to_list(PyLinkedListObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+
+    PyObject* result;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    Node* current = self->ll->head;
+    result = pyds_int32_result(linked_list_length(self->ll), PyLinkedList_fill, &current, as_array);
+    Py_END_CRITICAL_SECTION();
+
+    return result;
+}
+
+static PyObject* PyLinkedList_tobytes(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* bytes;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    Node* current = self->ll->head;
+    bytes = pyds_tobytes(linked_list_length(self->ll), PyLinkedList_fill, &current);
+    Py_END_CRITICAL_SECTION();
+
+    return bytes;
+}
+
+// Copies the values first to last; the caller frees cursor->values with PyMem_Free
+static int PyLinkedList_snapshot(PyLinkedListObject* self, pyds_array_cursor_t* cursor) {
+    int32_t* values;
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = linked_list_length(self->ll);
+    values = PyMem_Malloc(((size_t)size + 1) * sizeof(int32_t));
+    if (values) {
+        Node* current = self->ll->head;
+        PyLinkedList_fill(&current, values, size);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    if (!values) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    cursor->values = values;
+    cursor->index = 0;
+    cursor->size = size;
+    return 0;
+}
+
+static PyObject* PyLinkedList_cls_frombytes(PyObject* cls, PyObject* data) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    LinkedList* ll = ((PyLinkedListObject*)obj)->ll;
+    if (pyds_frombytes(data, PyLinkedList_extend_reversed, ll) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    linked_list_reverse(ll);
+    return obj;
+}
+
+static PyObject* PyLinkedList_reduce(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* payload = PyLinkedList_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    return result;
+}
+
+static PyObject* PyLinkedList_dump(PyLinkedListObject* self, PyObject* fileobj) {
+    pyds_array_cursor_t cursor;
+    if (PyLinkedList_snapshot(self, &cursor) < 0) return NULL;
+
+    int status = pyds_dump(fileobj, PYDS_CONTAINER_LINKED_LIST, cursor.size, pyds_array_fill, &cursor);
+    PyMem_Free((void*)cursor.values);
+    if (status < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyLinkedList_cls_load(PyObject* cls, PyObject* fileobj) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    LinkedList* ll = ((PyLinkedListObject*)obj)->ll;
+    if (pyds_load(fileobj, PYDS_CONTAINER_LINKED_LIST, PyLinkedList_extend_reversed, ll) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    linked_list_reverse(ll);
+    return obj;
+}
+
 static Py_ssize_t PyLinkedList_length(PyLinkedListObject* self) {
-    return (Py_ssize_t)linked_list_length(self->ll);
+    int size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = linked_list_length(self->ll);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyLinkedList_sizeof(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = linked_list_memory_usage(self->ll);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyLinkedListObject) + usage);
+}
+
+static PyObject* PyLinkedList_stats(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    linked_list_get_stats(self->ll, &stats);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyLinkedList_reset_stats(PyLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    linked_list_reset_stats(self->ll);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
 }
 
 static PyMethodDef PyLinkedList_methods[] = {
-    {"prepend", (PyCFunction)PyLinkedList_prepend, METH_VARARGS, "Add a value at the beginning."},
-    {"pop", (PyCFunction)PyLinkedList_pop, METH_VARARGS, "Remove the first element. Returns the value removed. If there is no element, return None."},
-    {"peek", (PyCFunction)PyLinkedList_peek, METH_VARARGS, "Peek the first element. If there is no element, return None."},
+    {"prepend", (PyCFunction)PyLinkedList_prepend, METH_O, "Add a value at the beginning."},
+    {"pop", (PyCFunction)PyLinkedList_pop, METH_NOARGS, "Remove the first element. Returns the value removed. If there is no element, return None."},
+    {"peek", (PyCFunction)PyLinkedList_peek, METH_NOARGS, "Peek the first element. If there is no element, return None."},
+    {"to_list", (PyCFunction)(void(*)(void))PyLinkedList_to_list, METH_VARARGS | METH_KEYWORDS, "Return the values, first to last, as a list, or as array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyLinkedList_tobytes, METH_NOARGS, "Return the values, first to last, as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)PyLinkedList_cls_frombytes, METH_O | METH_CLASS, "Build a list from little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyLinkedList_dump, METH_O, "Write the list to a binary file object."},
+    {"load", (PyCFunction)PyLinkedList_cls_load, METH_O | METH_CLASS, "Read a list written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyLinkedList_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyLinkedList_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyLinkedList_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyLinkedList_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
+    {NULL}
+};
+
+static PyType_Slot PyLinkedList_slots[] = {
+    {Py_tp_doc, (void*)"Linked List\n"
+        "\n"
+        "- prepend(value: int) - Add a value at the beginning."
+        "- pop() -> Optional[int] - Remove the first element. Returns the value removed. If there is no element, return None."
+        "- peek() -> Optional[int] - Peek the first element. If there is no element, return None."
+        "- to_list(as_array: bool = False) -> list[int] | array - Return the values, first to last, as a list, or as array('i') if as_array is true."
+        "- tobytes() -> bytes - Return the values, first to last, as little-endian int32 bytes."
+        "- frombytes(data: bytes) -> LinkedList - Build a list from little-endian int32 bytes."
+        "- dump(file) - Write the list to a binary file object."
+        "- load(file) -> LinkedList - Read a list written by dump() from a binary file object."
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."
+        "- reset_stats() - Zero the operation counters and latency histogram."},
+    {Py_tp_methods, PyLinkedList_methods},
+    {Py_tp_new, PyLinkedList_new},
+    {Py_tp_dealloc, PyLinkedList_dealloc},
+    {Py_sq_length, PyLinkedList_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyLinkedList_spec = {
+    .name = "pydatastructs.linked_list.LinkedList",
+    .basicsize = sizeof(PyLinkedListObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyLinkedList_slots,
+};
+
+typedef struct PyObjectLinkedListNode {
+    PyObject* value;
+    struct PyObjectLinkedListNode* next;
+} PyObjectLinkedListNode;
+
+typedef struct {
+    PyObject_HEAD;
+    PyObjectLinkedListNode* head;
+    Py_ssize_t size;
+} PyObjectLinkedListObject;
+
+#define PY_OBJECT_LINKED_LIST_NAME "ObjectLinkedList"
+
+// Links a new node holding value after *link, or at the head when link
+// points at self->head
+static int PyObjectLinkedList_link(PyObjectLinkedListObject* self, PyObjectLinkedListNode** link, PyObject* value) {
+    PyObjectLinkedListNode* node = pyds_malloc(sizeof(PyObjectLinkedListNode));
+    if (!node) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    Py_INCREF(value);
+    node->value = value;
+    node->next = *link;
+    *link = node;
+    self->size++;
+    return 0;
+}
+
+typedef struct {
+    PyObjectLinkedListObject* self;
+    PyObjectLinkedListNode** tail;  // Link to append the next item at
+} PyObjectLinkedList_builder;
+
+static int PyObjectLinkedList_add(void* ctx, PyObject* item) {
+    PyObjectLinkedList_builder* builder = (PyObjectLinkedList_builder*)ctx;
+    if (PyObjectLinkedList_link(builder->self, builder->tail, item) < 0) return -1;
+
+    builder->tail = &(*builder->tail)->next;
+    return 0;
+}
+
+static int PyObjectLinkedList_traverse(PyObjectLinkedListObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    for (PyObjectLinkedListNode* node = self->head; node; node = node->next) {
+        Py_VISIT(node->value);
+    }
+    return 0;
+}
+
+static int PyObjectLinkedList_clear(PyObjectLinkedListObject* self) {
+    PyObjectLinkedListNode* node = self->head;
+
+    self->head = NULL;
+    self->size = 0;
+
+    while (node) {
+        PyObjectLinkedListNode* next = node->next;
+        Py_DECREF(node->value);
+        pyds_free(node);
+        node = next;
+    }
+    return 0;
+}
+
+static void PyObjectLinkedList_dealloc(PyObjectLinkedListObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyObjectLinkedList_clear(self);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyObjectLinkedList_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    PyObject* iterable;
+    if (pyds_parse_iterable(args, kwargs, "|O:" PY_OBJECT_LINKED_LIST_NAME, &iterable) < 0) return NULL;
+
+    PyObjectLinkedListObject* self = (PyObjectLinkedListObject*)PyType_GenericAlloc(type, 0);
+    if (!self || !iterable) return (PyObject*)self;
+
+    PyObjectLinkedList_builder builder = {self, &self->head};
+    if (pyds_for_each(iterable, PyObjectLinkedList_add, &builder) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject*)self;
+}
+
+static PyObject* PyObjectLinkedList_prepend(PyObjectLinkedListObject* self, PyObject* value) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyObjectLinkedList_link(self, &self->head, value);
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyObjectLinkedList_pop(PyObjectLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* removed = Py_None;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyObjectLinkedListNode* node = self->head;
+    if (node) {
+        self->head = node->next;
+        self->size--;
+        removed = node->value;
+        pyds_free(node);
+    } else {
+        Py_INCREF(removed);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectLinkedList_peek(PyObjectLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* peek;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    peek = self->head ? self->head->value : Py_None;
+    Py_INCREF(peek);
+    Py_END_CRITICAL_SECTION();
+
+    return peek;
+}
+
+static PyObject* PyObjectLinkedList_to_list(PyObjectLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* list;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    list = PyList_New(self->size);
+    Py_ssize_t i = 0;
+    for (PyObjectLinkedListNode* node = self->head; list && node; node = node->next) {
+        Py_INCREF(node->value);
+        PYDS_LIST_SET_ITEM(list, i++, node->value);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return list;
+}
+
+static PyObject* PyObjectLinkedList_reduce(PyObjectLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* items = PyObjectLinkedList_to_list(self, NULL);
+    if (!items) return NULL;
+
+    return Py_BuildValue("(O(N))", (PyObject*)Py_TYPE((PyObject*)self), items);
+}
+
+static Py_ssize_t PyObjectLinkedList_length(PyObjectLinkedListObject* self) {
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = self->size;
+    Py_END_CRITICAL_SECTION();
+
+    return size;
+}
+
+static PyObject* PyObjectLinkedList_sizeof(PyObjectLinkedListObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_ssize_t size = PyObjectLinkedList_length(self);
+    return PyLong_FromSize_t(sizeof(PyObjectLinkedListObject) + sizeof(PyObjectLinkedListNode) * (size_t)size);
+}
+
+static PyMethodDef PyObjectLinkedList_methods[] = {
+    {"prepend", (PyCFunction)PyObjectLinkedList_prepend, METH_O, "Add an item at the beginning."},
+    {"pop", (PyCFunction)PyObjectLinkedList_pop, METH_NOARGS, "Remove the first item. Returns the item removed. If there is no item, return None."},
+    {"peek", (PyCFunction)PyObjectLinkedList_peek, METH_NOARGS, "Peek the first item. If there is no item, return None."},
+    {"to_list", (PyCFunction)PyObjectLinkedList_to_list, METH_NOARGS, "Return the items, first to last, as a list."},
+    {"__reduce__", (PyCFunction)PyObjectLinkedList_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyObjectLinkedList_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
     {NULL}
 };
 
-static PySequenceMethods PyLinkedList_sequence_methods = {
-    .sq_length = (lenfunc)PyLinkedList_length,
-    0, 0, 0, 0, 0, 0, 0, 0, 0
+static PyType_Slot PyObjectLinkedList_slots[] = {
+    {Py_tp_doc, (void*)"Linked List of arbitrary objects\n"
+        "\n"
+        "- ObjectLinkedList(iterable=()) - Build a list holding the items of iterable, first to last.\n"
+        "- prepend(item) - Add an item at the beginning.\n"
+        "- pop() -> Optional[object] - Remove the first item. Returns the item removed. If there is no item, return None.\n"
+        "- peek() -> Optional[object] - Peek the first item. If there is no item, return None.\n"
+        "- to_list() -> list - Return the items, first to last, as a list.\n"},
+    {Py_tp_methods, PyObjectLinkedList_methods},
+    {Py_tp_new, PyObjectLinkedList_new},
+    {Py_tp_dealloc, PyObjectLinkedList_dealloc},
+    {Py_tp_traverse, PyObjectLinkedList_traverse},
+    {Py_tp_clear, PyObjectLinkedList_clear},
+    {Py_sq_length, PyObjectLinkedList_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyObjectLinkedList_spec = {
+    .name = "pydatastructs.linked_list.ObjectLinkedList",
+    .basicsize = sizeof(PyObjectLinkedListObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyObjectLinkedList_slots,
 };
 
-static PyTypeObject PyLinkedListType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    .tp_name = "linked_list.LinkedList",
-    .tp_basicsize = sizeof(PyLinkedListObject),
-    .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT,
-    .tp_doc = "Linked List\n"
-    "\n"
-    "- prepend(value: int) - Add a value at the beginning."
-    "- pop() -> Optional[int] - Remove the first element. Returns the value removed. If there is no element, return None."
-    "- peek() -> Optional[int] - Peek the first element. If there is no element, return None.",
-    .tp_methods = PyLinkedList_methods,
-    .tp_new = PyLinkedList_new,
-    .tp_dealloc = (destructor)PyLinkedList_dealloc,
-    .tp_as_sequence = &PyLinkedList_sequence_methods,
+typedef struct {
+    PyObject* type;  // LinkedList
+    PyObject* object_type;  // ObjectLinkedList
+} linked_list_module_state;
+
+static int linked_list_module_exec(PyObject* m) {
+    linked_list_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyLinkedList_spec, PYDS_VECTORCALL(PyLinkedList_vectorcall));
+    if (!state->type) return -1;
+    state->object_type = pyds_add_type(m, &PyObjectLinkedList_spec, NULL);
+    if (!state->object_type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int linked_list_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    linked_list_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->type);
+        Py_VISIT(state->object_type);
+    }
+    return 0;
+}
+
+static int linked_list_module_clear(PyObject* m) {
+    linked_list_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->type);
+        Py_CLEAR(state->object_type);
+    }
+    return 0;
+}
+
+static void linked_list_module_free(void* m) {
+    linked_list_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot linked_list_module_slots[] = {
+    {Py_mod_exec, (void*)linked_list_module_exec},
+    PYDS_MODULE_SLOTS
 };
 
 static PyModuleDef linked_list_module = {
     PyModuleDef_HEAD_INIT,
-    "linked_list",
-    "This module exposes a high-performance, memory-efficient linked list "
+    .m_name = "linked_list",
+    .m_doc = "This module exposes a high-performance, memory-efficient linked list "
     "implementation written in C to Python via the C API",
-    -1,
-    NULL, NULL, NULL, NULL, NULL
+    .m_size = sizeof(linked_list_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = linked_list_module_slots,
+    .m_traverse = linked_list_module_traverse,
+    .m_clear = linked_list_module_clear,
+    .m_free = linked_list_module_free,
 };
 
 PyMODINIT_FUNC PyInit_linked_list(void) {
-    PyObject *m;
-
-    if (PyType_Ready(&PyLinkedListType) < 0) return NULL;
-
-    m = PyModule_Create(&linked_list_module);
-    if (!m) return NULL;
-
-    Py_INCREF(&PyLinkedListType);
-    PyModule_AddObject(m, "LinkedList", (PyObject*)&PyLinkedListType);
-    return m;
-}
\ No newline at end of file
+    return PyModuleDef_Init(&linked_list_module);
+}
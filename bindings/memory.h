@@ -0,0 +1,144 @@
+// bindings/memory.h
+
+#ifndef PYDS_MEMORY_H
+#define PYDS_MEMORY_H
+
+/**
+ * @file memory.h
+ * @brief Native memory accounting shared by the extension modules.
+ *
+ * Every module links its own copy of the core, and with it its own
+ * allocator table (src/alloc.h). The functions here expose that table:
+ *
+ * - set_allocator(allocator=None) picks the C library (None), CPython's raw
+ *   allocator ("pymem") or a PyCapsule named "pydatastructs.allocator"
+ *   pointing at a pyds_allocator_t, such as a jemalloc or mimalloc arena.
+ *   It fails while the module still holds native memory.
+ * - allocated_blocks() returns the number of live native blocks.
+ *
+ * Each module also reports its native blocks to tracemalloc under
+ * TRACEMALLOC_DOMAIN, so tracemalloc.DomainFilter can select them. The
+ * traces come from the main interpreter only, and are not available in the
+ * abi3 build, which has no PyTraceMalloc_Track().
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "../src/alloc.h"
+
+#define PYDS_TRACEMALLOC_DOMAIN 0x70796473u  // "pyds"
+#define PYDS_ALLOCATOR_CAPSULE "pydatastructs.allocator"
+
+#if !defined(Py_LIMITED_API) || Py_LIMITED_API + 0 >= 0x030D0000
+#define PYDS_HAVE_RAW_MALLOC 1
+#endif
+
+#if PY_VERSION_HEX < 0x03090000
+#define PyInterpreterState_Get() (PyThreadState_Get()->interp)
+#endif
+
+#ifndef Py_LIMITED_API
+// PyTraceMalloc_Track() may take the main interpreter's GIL, so
+// subinterpreters, which may run under their own, skip it
+static void pyds_tracemalloc_track(void* ptr, size_t size) {
+    if (PyInterpreterState_Get() != PyInterpreterState_Main()) return;
+    PyTraceMalloc_Track(PYDS_TRACEMALLOC_DOMAIN, (uintptr_t)ptr, size);
+}
+
+static void pyds_tracemalloc_untrack(void* ptr) {
+    if (PyInterpreterState_Get() != PyInterpreterState_Main()) return;
+    PyTraceMalloc_Untrack(PYDS_TRACEMALLOC_DOMAIN, (uintptr_t)ptr);
+}
+#endif
+
+#ifdef PYDS_HAVE_RAW_MALLOC
+static void* pyds_raw_malloc(void* ctx, size_t size) {
+    (void)ctx;
+    return PyMem_RawMalloc(size);
+}
+
+static void* pyds_raw_calloc(void* ctx, size_t count, size_t size) {
+    (void)ctx;
+    return PyMem_RawCalloc(count, size);
+}
+
+static void* pyds_raw_realloc(void* ctx, void* ptr, size_t size) {
+    (void)ctx;
+    return PyMem_RawRealloc(ptr, size);
+}
+
+static void pyds_raw_free(void* ctx, void* ptr) {
+    (void)ctx;
+    PyMem_RawFree(ptr);
+}
+#endif
+
+static PyObject* pyds_set_allocator_py(PyObject* module, PyObject* const* args, Py_ssize_t nargs) {
+    (void)module;
+    if (nargs > 1) {
+        PyErr_Format(PyExc_TypeError, "set_allocator() takes at most 1 argument (%zd given)", nargs);
+        return NULL;
+    }
+
+    PyObject* choice = nargs ? args[0] : Py_None;
+    const pyds_allocator_t* allocator = NULL;
+#ifdef PYDS_HAVE_RAW_MALLOC
+    static const pyds_allocator_t raw = {NULL, pyds_raw_malloc, pyds_raw_calloc, pyds_raw_realloc, pyds_raw_free};
+#endif
+
+    if (choice == Py_None) {
+        allocator = NULL;
+    } else if (PyUnicode_Check(choice) && PyUnicode_CompareWithASCIIString(choice, "pymem") == 0) {
+#ifdef PYDS_HAVE_RAW_MALLOC
+        allocator = &raw;
+#else
+        PyErr_SetString(PyExc_NotImplementedError, "the pymem allocator needs the 3.13 stable ABI");
+        return NULL;
+#endif
+    } else if (PyCapsule_IsValid(choice, PYDS_ALLOCATOR_CAPSULE)) {
+        allocator = PyCapsule_GetPointer(choice, PYDS_ALLOCATOR_CAPSULE);
+        if (!allocator->malloc || !allocator->calloc || !allocator->realloc || !allocator->free) {
+            PyErr_SetString(PyExc_ValueError, "allocator capsule has a NULL function");
+            return NULL;
+        }
+    } else {
+        PyErr_SetString(PyExc_TypeError,
+                        "allocator must be None, 'pymem' or a '" PYDS_ALLOCATOR_CAPSULE "' capsule");
+        return NULL;
+    }
+
+    if (!pyds_set_allocator(allocator)) {
+        PyErr_Format(PyExc_RuntimeError, "cannot change the allocator while %ld native blocks are live",
+                     pyds_alloc_live());
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject* pyds_allocated_blocks_py(PyObject* module, PyObject* Py_UNUSED(ignored)) {
+    (void)module;
+    return PyLong_FromLong(pyds_alloc_live());
+}
+
+static PyMethodDef pyds_memory_methods[] = {
+    {"set_allocator", (PyCFunction)(void(*)(void))pyds_set_allocator_py, METH_FASTCALL,
+     "Use the C library (None), CPython's raw allocator ('pymem') or a 'pydatastructs.allocator' capsule "
+     "for this module's native memory. Fails while any is allocated."},
+    {"allocated_blocks", (PyCFunction)pyds_allocated_blocks_py, METH_NOARGS,
+     "Return the number of native memory blocks this module holds."},
+    {NULL}
+};
+
+/**
+ * @brief Installs the tracemalloc tracker and adds TRACEMALLOC_DOMAIN to module.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_memory_init(PyObject* module) {
+#ifndef Py_LIMITED_API
+    static const pyds_alloc_tracker_t tracker = {pyds_tracemalloc_track, pyds_tracemalloc_untrack};
+    pyds_set_alloc_tracker(&tracker);
+#endif
+    return PyModule_AddIntConstant(module, "TRACEMALLOC_DOMAIN", (long)PYDS_TRACEMALLOC_DOMAIN);
+}
+
+#endif // PYDS_MEMORY_H
@@ -0,0 +1,387 @@
+// bindings/merge_py.c
+//
+// The runs are read through their buffers without copying, and the views
+// are held until the merge ends, so a bytearray or array('i') run cannot be
+// resized meanwhile. With release_gil=True the merge itself runs without
+// the GIL; other threads must then not write to the runs or the output.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "../src/loser_tree.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "stats.h"
+
+typedef struct {
+    Py_buffer* views;
+    Py_ssize_t count;
+} PyMergeRuns;
+
+static void PyMergeRuns_release(PyMergeRuns* runs) {
+    for (Py_ssize_t i = 0; i < runs->count; i++) PyBuffer_Release(&runs->views[i]);
+    PyMem_Free(runs->views);
+    runs->views = NULL;
+    runs->count = 0;
+}
+
+/**
+ * @brief Gets the buffer of every run in iterable and builds a tree over them.
+ * @return The tree, or NULL with an exception set and nothing held.
+ */
+static loser_tree_t* PyMergeRuns_open(PyObject* iterable, PyMergeRuns* runs) {
+    runs->views = NULL;
+    runs->count = 0;
+
+    PyObject* iterator = PyObject_GetIter(iterable);
+    if (!iterator) return NULL;
+
+    Py_ssize_t capacity = 0;
+    PyObject* item;
+    while ((item = PyIter_Next(iterator))) {
+        if (runs->count == INT_MAX) {
+            Py_DECREF(item);
+            PyErr_SetString(PyExc_OverflowError, "too many runs to merge");
+            break;
+        }
+        if (runs->count == capacity) {
+            Py_ssize_t grown = capacity ? Py_MIN(2 * capacity, (Py_ssize_t)INT_MAX) : 16;
+            Py_buffer* views = PyMem_Realloc(runs->views, sizeof(Py_buffer) * (size_t)grown);
+            if (!views) {
+                Py_DECREF(item);
+                PyErr_NoMemory();
+                break;
+            }
+            runs->views = views;
+            capacity = grown;
+        }
+
+        int status = pyds_get_int32_buffer(item, &runs->views[runs->count]);
+        if (status == 0) {
+            PyErr_SetString(PyExc_TypeError, "runs must be C-contiguous int32 buffers such as array('i')");
+        }
+        Py_DECREF(item);
+        if (status <= 0) break;
+        runs->count++;
+    }
+    Py_DECREF(iterator);
+    if (PyErr_Occurred()) {
+        PyMergeRuns_release(runs);
+        return NULL;
+    }
+
+    const int32_t** starts = PyMem_Malloc(sizeof(int32_t*) * (size_t)(runs->count + 1));
+    size_t* lengths = PyMem_Malloc(sizeof(size_t) * (size_t)(runs->count + 1));
+    loser_tree_t* tree = NULL;
+    if (starts && lengths) {
+        for (Py_ssize_t i = 0; i < runs->count; i++) {
+            starts[i] = (const int32_t*)runs->views[i].buf;
+            lengths[i] = (size_t)(runs->views[i].len / (Py_ssize_t)sizeof(int32_t));
+        }
+        tree = loser_tree_create(starts, lengths, (int)runs->count);
+    }
+    PyMem_Free(starts);
+    PyMem_Free(lengths);
+
+    if (!tree) {
+        PyMergeRuns_release(runs);
+        PyErr_NoMemory();
+    }
+    return tree;
+}
+
+typedef struct {
+    loser_tree_t* tree;
+    int release_gil;
+} PyMergeFill;
+
+static Py_ssize_t PyMerge_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    PyMergeFill* fill = (PyMergeFill*)ctx;
+    size_t n;
+
+    if (fill->release_gil) {
+        Py_BEGIN_ALLOW_THREADS
+        n = loser_tree_merge(fill->tree, out, (size_t)max);
+        Py_END_ALLOW_THREADS
+    } else {
+        n = loser_tree_merge(fill->tree, out, (size_t)max);
+    }
+    return (Py_ssize_t)n;
+}
+
+/**
+ * @brief Index of the first run whose memory overlaps view, or -1.
+ */
+static Py_ssize_t PyMergeRuns_overlap(const PyMergeRuns* runs, const Py_buffer* view) {
+    uintptr_t start = (uintptr_t)view->buf, end = start + (uintptr_t)view->len;
+    for (Py_ssize_t i = 0; i < runs->count; i++) {
+        uintptr_t run_start = (uintptr_t)runs->views[i].buf;
+        uintptr_t run_end = run_start + (uintptr_t)runs->views[i].len;
+        if (start < run_end && run_start < end) return i;
+    }
+    return -1;
+}
+
+/**
+ * @brief Merges up to max values into out, an int32 buffer, or into a new
+ * array('i') when out is NULL. With exact set, out must have room for max.
+ * out may not share memory with any of the runs, since the merge would
+ * overwrite values it has not read yet.
+ * @return The array, or the number of values written to out.
+ */
+static PyObject* PyMerge_write(loser_tree_t* tree, const PyMergeRuns* runs, PyObject* out, Py_ssize_t max,
+                               int exact, int release_gil) {
+    PyMergeFill fill = {tree, release_gil};
+    if (!out) return pyds_array_from_fill(max, PyMerge_fill, &fill);
+
+    Py_buffer view;
+    int status = pyds_get_int32_buffer_flags(out, &view, PyBUF_WRITABLE);
+    if (status == 0) {
+        PyErr_SetString(PyExc_TypeError, "out must be a writable C-contiguous int32 buffer");
+    }
+    if (status <= 0) return NULL;
+
+    Py_ssize_t overlap = PyMergeRuns_overlap(runs, &view);
+    if (overlap >= 0) {
+        PyBuffer_Release(&view);
+        PyErr_Format(PyExc_ValueError, "out overlaps run %zd", overlap);
+        return NULL;
+    }
+
+    Py_ssize_t room = view.len / (Py_ssize_t)sizeof(int32_t);
+    if (exact && room < max) {
+        PyBuffer_Release(&view);
+        PyErr_Format(PyExc_ValueError, "out holds %zd values, the runs %zd", room, max);
+        return NULL;
+    }
+
+    Py_ssize_t written = PyMerge_fill(&fill, (int32_t*)view.buf, Py_MIN(room, max));
+    PyBuffer_Release(&view);
+    return PyLong_FromSsize_t(written);
+}
+
+static PyObject* merge_sorted(PyObject* module, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"runs", "out", "release_gil", NULL};
+    PyObject* iterable;
+    PyObject* out = Py_None;
+    int release_gil = 0;
+
+    (void)module;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O$p:merge_sorted", kwlist, &iterable, &out, &release_gil)) {
+        return NULL;
+    }
+
+    PyMergeRuns runs;
+    loser_tree_t* tree = PyMergeRuns_open(iterable, &runs);
+    if (!tree) return NULL;
+
+    PyObject* result = NULL;
+    if (tree->remaining > (size_t)PY_SSIZE_T_MAX / sizeof(int32_t)) {
+        PyErr_SetString(PyExc_OverflowError, "the runs hold too many values");
+    } else {
+        result = PyMerge_write(tree, &runs, out == Py_None ? NULL : out, (Py_ssize_t)tree->remaining, 1, release_gil);
+    }
+
+    loser_tree_free(tree);
+    PyMergeRuns_release(&runs);
+    return result;
+}
+
+typedef struct {
+    PyObject_HEAD;
+    loser_tree_t* tree;
+    PyMergeRuns runs;
+    int busy;  // A call is merging, possibly without the GIL
+} PyMergerObject;
+
+static void PyMerger_dealloc(PyMergerObject* self) {
+    loser_tree_free(self->tree);
+    PyMergeRuns_release(&self->runs);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyMerger_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"runs", NULL};
+    PyObject* iterable;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:Merger", kwlist, &iterable)) return NULL;
+
+    PyMergerObject* self = (PyMergerObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
+    self->tree = PyMergeRuns_open(iterable, &self->runs);
+    if (!self->tree) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject*)self;
+}
+
+// Claims the merger for one call, which may release the GIL while it merges
+static int PyMerger_claim(PyMergerObject* self) {
+    int busy;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    busy = self->busy;
+    self->busy = 1;
+    Py_END_CRITICAL_SECTION();
+
+    if (busy) {
+        PyErr_SetString(PyExc_RuntimeError, "Merger is already merging in another thread");
+        return -1;
+    }
+    return 0;
+}
+
+static void PyMerger_unclaim(PyMergerObject* self) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    self->busy = 0;
+    Py_END_CRITICAL_SECTION();
+}
+
+static PyObject* PyMerger_read(PyMergerObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"n", "release_gil", NULL};
+    Py_ssize_t n = -1;
+    int release_gil = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|n$p:read", kwlist, &n, &release_gil)) return NULL;
+    if (PyMerger_claim(self) < 0) return NULL;
+
+    size_t remaining = self->tree->remaining;
+    if (n < 0 || (size_t)n > remaining) n = remaining < (size_t)PY_SSIZE_T_MAX ? (Py_ssize_t)remaining : PY_SSIZE_T_MAX;
+    PyObject* result = PyMerge_write(self->tree, &self->runs, NULL, n, 0, release_gil);
+
+    PyMerger_unclaim(self);
+    return result;
+}
+
+static PyObject* PyMerger_readinto(PyMergerObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"buffer", "release_gil", NULL};
+    PyObject* out;
+    int release_gil = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$p:readinto", kwlist, &out, &release_gil)) return NULL;
+    if (PyMerger_claim(self) < 0) return NULL;
+
+    PyObject* result = PyMerge_write(self->tree, &self->runs, out, PY_SSIZE_T_MAX, 0, release_gil);
+
+    PyMerger_unclaim(self);
+    return result;
+}
+
+static PyObject* PyMerger_iternext(PyMergerObject* self) {
+    int32_t value;
+    size_t n = 0;
+
+    if (PyMerger_claim(self) < 0) return NULL;
+    n = loser_tree_merge(self->tree, &value, 1);
+    PyMerger_unclaim(self);
+
+    if (n == 0) return NULL;
+    return PyLong_FromLong(value);
+}
+
+static Py_ssize_t PyMerger_length(PyMergerObject* self) {
+    size_t remaining;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    remaining = self->tree->remaining;
+    Py_END_CRITICAL_SECTION();
+
+    return remaining < (size_t)PY_SSIZE_T_MAX ? (Py_ssize_t)remaining : PY_SSIZE_T_MAX;
+}
+
+static PyObject* PyMerger_sizeof(PyMergerObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSize_t(sizeof(PyMergerObject) + sizeof(Py_buffer) * (size_t)self->runs.count +
+                             loser_tree_memory_usage(self->tree));
+}
+
+static PyMethodDef PyMerger_methods[] = {
+    {"read", (PyCFunction)(void(*)(void))PyMerger_read, METH_VARARGS | METH_KEYWORDS, "Return the next n values, or all that are left, as array('i')."},
+    {"readinto", (PyCFunction)(void(*)(void))PyMerger_readinto, METH_VARARGS | METH_KEYWORDS, "Merge into a writable int32 buffer until it is full and return the number of values written."},
+    {"__sizeof__", (PyCFunction)PyMerger_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyMerger_slots[] = {
+    {Py_tp_doc, (void*)"Merger\n"
+        "\n"
+        "Merger(runs) merges sorted int32 buffers, such as array('i'), in chunks. Equal values leave in run order. "
+        "The runs are read in place and must stay unchanged until the merger is done.\n"
+        "\n"
+        "- read(n: int = -1, *, release_gil: bool = False) -> array - Return the next n values, or all that are left.\n"
+        "- readinto(buffer, *, release_gil: bool = False) -> int - Merge into a writable int32 buffer until it is full.\n"
+        "- len(merger) -> int - Get number of values left.\n"
+        "- iter(merger) - Iterate over the values left.\n"},
+    {Py_tp_methods, PyMerger_methods},
+    {Py_tp_new, PyMerger_new},
+    {Py_tp_dealloc, PyMerger_dealloc},
+    {Py_tp_iter, PyObject_SelfIter},
+    {Py_tp_iternext, PyMerger_iternext},
+    {Py_sq_length, PyMerger_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyMerger_spec = {
+    .name = "pydatastructs.merge.Merger",
+    .basicsize = sizeof(PyMergerObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyMerger_slots,
+};
+
+typedef struct {
+    PyObject* type;  // Merger
+} merge_module_state;
+
+static int merge_module_exec(PyObject* m) {
+    merge_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyMerger_spec, NULL);
+    if (!state->type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    if (PyModule_AddFunctions(m, pyds_memory_methods) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int merge_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    merge_module_state* state = PyModule_GetState(m);
+    if (state) Py_VISIT(state->type);
+    return 0;
+}
+
+static int merge_module_clear(PyObject* m) {
+    merge_module_state* state = PyModule_GetState(m);
+    if (state) Py_CLEAR(state->type);
+    return 0;
+}
+
+static void merge_module_free(void* m) {
+    merge_module_clear((PyObject*)m);
+}
+
+static PyMethodDef merge_module_methods[] = {
+    {"merge_sorted", (PyCFunction)(void(*)(void))merge_sorted, METH_VARARGS | METH_KEYWORDS,
+     "merge_sorted(runs, out=None, *, release_gil=False) - Merge sorted int32 buffers into a new array('i'), "
+     "or into out and return the number of values written."},
+    {NULL}
+};
+
+static PyModuleDef_Slot merge_module_slots[] = {
+    {Py_mod_exec, (void*)merge_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef merge_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "merge",
+    .m_doc = "This module exposes a loser-tree k-way merge of sorted int32 buffers "
+    "written in C to Python via the C API",
+    .m_size = sizeof(merge_module_state),
+    .m_methods = merge_module_methods,
+    .m_slots = merge_module_slots,
+    .m_traverse = merge_module_traverse,
+    .m_clear = merge_module_clear,
+    .m_free = merge_module_free,
+};
+
+PyMODINIT_FUNC PyInit_merge(void) {
+    return PyModuleDef_Init(&merge_module);
+}
@@ -2,38 +2,208 @@
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "../src/event_queue.h"
+#include "../src/external_heap.h"
 #include "../src/min_heap.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "objects.h"
+#include "serialize.h"
+#include "stats.h"
+#include "shared.h"
 
 typedef struct {
     PyObject_HEAD;
     MinHeap* min_heap;
+    Py_buffer view;  // Export of the shared region; view.obj is NULL for private heaps
+    PyObject* key;  // Key function of a keyed heap, whose payloads are the items
+    int32_t flip;  // ~0 for reverse=True heaps, which store ~key; 0 otherwise
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
 } PyMinHeapObject;
 
-static PyTypeObject PyMinHeapType;
+#define PY_MIN_HEAP_IS_KEYED(self) ((self)->min_heap->payloads != NULL)
+
+static int PyMinHeap_traverse(PyMinHeapObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    Py_VISIT(self->key);
+    if (self->min_heap && PY_MIN_HEAP_IS_KEYED(self)) {
+        for (int i = 0; i < self->min_heap->size; i++) {
+            Py_VISIT((PyObject*)self->min_heap->payloads[i]);
+        }
+    }
+    return 0;
+}
+
+// Dropping the last element keeps the heap valid, so code run by a release
+// always sees a consistent heap
+static int PyMinHeap_clear(PyMinHeapObject* self) {
+    MinHeap* heap = self->min_heap;
+    if (heap && heap->payloads) {
+        while (heap->size > 0) {
+            PyObject* item = (PyObject*)heap->payloads[--heap->size];
+            Py_DECREF(item);
+        }
+    }
+    Py_CLEAR(self->key);
+    return 0;
+}
 
 static void PyMinHeap_dealloc(PyMinHeapObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyMinHeap_clear(self);
     min_heap_free(self->min_heap);
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    if (self->view.obj) PyBuffer_Release(&self->view);
+    pyds_type_free((PyObject*)self);
+}
+
+/**
+ * @brief Wraps heap, which may be NULL after a failed allocation, in a new
+ * MinHeap object that owns it.
+ *
+ * Only keyed heaps hold references, so the others are not tracked by the
+ * garbage collector.
+ */
+static PyMinHeapObject* PyMinHeap_wrap(PyTypeObject* type, MinHeap* heap, PyObject* key, int reverse) {
+    if (!heap) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    PyMinHeapObject* self = (PyMinHeapObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        min_heap_free(heap);
+        return NULL;
+    }
+
+    self->min_heap = heap;
+    self->flip = reverse ? ~0 : 0;
+    if (key) {
+        Py_INCREF(key);
+        self->key = key;
+    } else {
+        PyObject_GC_UnTrack(self);
+    }
+    return self;
+}
+
+static PyObject* PyMinHeap_alloc(PyTypeObject* type, PyObject* key, int reverse) {
+    return (PyObject*)PyMinHeap_wrap(type, key ? min_heap_create_keyed() : min_heap_create(), key, reverse);
+}
+
+// key=None means no key function
+static int PyMinHeap_check_key(PyObject** key) {
+    if (*key == Py_None) {
+        *key = NULL;
+    } else if (!PyCallable_Check(*key)) {
+        PyErr_SetString(PyExc_TypeError, "key must be callable or None");
+        return -1;
+    }
+    return 0;
 }
 
 static PyObject* PyMinHeap_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
-    PyMinHeapObject* self;
-    self = (PyMinHeapObject*)type->tp_alloc(type, 0);
-    self->min_heap = min_heap_create();
+    static char* kwlist[] = {"key", "reverse", NULL};
+    PyObject* key = Py_None;
+    int reverse = 0;
 
-    return (PyObject*)self;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$Op:MinHeap", kwlist, &key, &reverse)) return NULL;
+    if (PyMinHeap_check_key(&key) < 0) return NULL;
+    return PyMinHeap_alloc(type, key, reverse);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyMinHeap_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (nargs == 0 && !kwnames) return PyMinHeap_alloc((PyTypeObject*)type, NULL, 0);
+
+    // Options are rare enough to go through the keyword parser
+    return pyds_vectorcall_new((PyTypeObject*)type, args, nargsf, kwnames, PyMinHeap_new);
+}
+#endif
+
+/**
+ * @brief Computes the key stored for item: key(item), inverted when flip is ~0.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static int PyMinHeap_call_key(PyObject* key, int32_t flip, PyObject* item, int32_t* out) {
+    PyObject* result = PyObject_CallFunctionObjArgs(key, item, NULL);
+    if (!result) return -1;
+
+    int status = pyds_as_int32(result, out);
+    Py_DECREF(result);
+    *out ^= flip;
+    return status;
+}
+
+static int PyMinHeap_key_of(PyMinHeapObject* self, PyObject* item, int32_t* out) {
+    if (!self->key) {
+        PyErr_SetString(PyExc_ReferenceError, "MinHeap key function was cleared");
+        return -1;
+    }
+    return PyMinHeap_call_key(self->key, self->flip, item, out);
+}
+
+static PyObject* PyMinHeap_heapify_keyed(PyTypeObject* type, PyObject* input_list, PyObject* key, int reverse) {
+    Py_ssize_t len = PyList_Size(input_list);
+    PyObject** items = PyMem_Malloc(sizeof(PyObject*) * ((size_t)len + 1));
+    int* keys = PyMem_Malloc(sizeof(int) * ((size_t)len + 1));
+    if (!items || !keys) {
+        PyMem_Free(items);
+        PyMem_Free(keys);
+        return PyErr_NoMemory();
+    }
+
+    // The key function may change the list, so the items are copied out first
+    for (Py_ssize_t i = 0; i < len; i++) {
+        items[i] = PyList_GetItem(input_list, i);
+        Py_INCREF(items[i]);
+    }
+
+    int32_t flip = reverse ? ~0 : 0;
+    Py_ssize_t done = 0;
+    while (done < len && PyMinHeap_call_key(key, flip, items[done], &keys[done]) == 0) done++;
+
+    PyMinHeapObject* obj = NULL;
+    if (done == len) {
+        obj = PyMinHeap_wrap(type, min_heap_heapify_keyed(keys, (void**)items, (int)len), key, reverse);
+    }
+    if (!obj) {
+        for (Py_ssize_t i = 0; i < len; i++) {
+            Py_DECREF(items[i]);
+        }
+    }
+    PyMem_Free(items);
+    PyMem_Free(keys);
+    return (PyObject*)obj;
 }
 
-static PyObject* PyMinHeap_cls_heapify(PyObject* cls, PyObject* args) {
+static PyObject* PyMinHeap_cls_heapify(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"array", "key", "reverse", NULL};
+    PyObject* input_list;
+    PyObject* key = Py_None;
+    int reverse = 0;
+
     if (!PyType_Check(cls)) {
         PyErr_SetString(PyExc_TypeError, "First argument must be a class");
         return NULL;
     }
 
-    PyObject* input_list;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|Op:heapify", kwlist, &input_list, &key, &reverse)) return NULL;
+    if (PyMinHeap_check_key(&key) < 0) return NULL;
 
-    if(!PyArg_ParseTuple(args, "O!", &PyList_Type, &input_list)) return NULL;
+    if (!PyList_Check(input_list)) {
+        PyErr_SetString(PyExc_TypeError, "heapify() argument must be a list");
+        return NULL;
+    }
 
+    if (key) return PyMinHeap_heapify_keyed((PyTypeObject*)cls, input_list, key, reverse);
+
+    int32_t flip = reverse ? ~0 : 0;
     int len = PyList_Size(input_list);
     int* arr = malloc(sizeof(int) * len);
     if(!arr) return PyErr_NoMemory();
@@ -47,27 +217,179 @@ static PyObject* PyMinHeap_cls_heapify(PyObject* cls, PyObject* args) {
             free(arr);
             return NULL;
         }
-        arr[i] = (int) val;
+        arr[i] = (int) val ^ flip;
     }
 
     MinHeap* heap = min_heap_heapify(arr, len);
     free(arr);
 
-    PyMinHeapObject* obj = PyObject_New(PyMinHeapObject, (PyTypeObject*)cls);
-    if(!obj) {
-        min_heap_free(heap);
-        return PyErr_NoMemory();
+    return (PyObject*)PyMinHeap_wrap((PyTypeObject*)cls, heap, NULL, reverse);
+}
+
+static PyObject* PyMinHeap_set_file_error(mapped_file_status_t status, PyObject* path) {
+    switch (status) {
+        case MAPPED_FILE_ERROR_FORMAT:
+            PyErr_Format(PyExc_ValueError, "%S is not a MinHeap file", path);
+            break;
+        case MAPPED_FILE_ERROR_CHECKSUM:
+            PyErr_Format(PyExc_ValueError, "%S failed checksum verification", path);
+            break;
+        case MAPPED_FILE_ERROR_UNSUPPORTED:
+            PyErr_SetString(PyExc_NotImplementedError, "File-backed heaps are not supported on this platform");
+            break;
+        default:
+            PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+            break;
     }
+    return NULL;
+}
+
+static PyObject* PyMinHeap_cls_open(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"path", "verify", NULL};
+    PyObject* path;
+    PyObject* encoded_path;
+    int verify = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", kwlist, &path, &verify)) return NULL;
+    if (!PyUnicode_FSConverter(path, &encoded_path)) return NULL;
+
+    mapped_file_status_t status;
+    MinHeap* heap = min_heap_open(PyBytes_AsString(encoded_path), (char)verify, &status);
+    Py_DECREF(encoded_path);
+    if (!heap) return PyMinHeap_set_file_error(status, path);
+
+    return (PyObject*)PyMinHeap_wrap((PyTypeObject*)cls, heap, NULL, 0);
+}
+
+static PyObject* PyMinHeap_cls_attach(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"buffer", "create", NULL};
+    PyObject* buffer;
+    int create = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", kwlist, &buffer, &create)) return NULL;
+
+    Py_buffer view;
+    if (pyds_shared_view(buffer, &view) < 0) return NULL;
 
-    obj->min_heap = heap;
+    shared_region_status_t status;
+    MinHeap* heap = min_heap_attach(view.buf, (size_t)view.len, (char)create, &status);
+    if (!heap) {
+        PyBuffer_Release(&view);
+        if (status == SHARED_REGION_OK) return PyErr_NoMemory();
+        return pyds_shared_error(status, "MinHeap");
+    }
+
+    PyMinHeapObject* obj = PyMinHeap_wrap((PyTypeObject*)cls, heap, NULL, 0);
+    if (!obj) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    obj->view = view;
     return (PyObject*)obj;
 }
 
-static PyObject* PyMinHeap_insert(PyMinHeapObject* self, PyObject* args) {
-    int value;
+static PyObject* PyMinHeap_sync(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    char synced;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    synced = min_heap_sync(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    if (!synced) return PyErr_SetFromErrno(PyExc_OSError);
+
+    Py_RETURN_NONE;
+}
+
+// The key function runs before the critical section, since it may call
+// back into the heap
+static PyObject* PyMinHeap_insert_keyed(PyMinHeapObject* self, PyObject* item) {
+    int32_t key;
+
+    if (PyMinHeap_key_of(self, item, &key) < 0) return NULL;
 
-    if(!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    min_heap_insert(self->min_heap, value);
+    char inserted;
+    Py_INCREF(item);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, inserted = min_heap_insert_keyed(self->min_heap, key, item));
+    Py_END_CRITICAL_SECTION();
+
+    if (!inserted) {
+        Py_DECREF(item);
+        return PyErr_NoMemory();
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyMinHeap_remove_keyed(PyMinHeapObject* self) {
+    int key;
+    void* item;
+
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = min_heap_remove_keyed(self->min_heap, &key, &item));
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) {
+        Py_RETURN_NONE;
+    }
+
+    return (PyObject*)item;
+}
+
+static PyObject* PyMinHeap_pushpop_keyed(PyMinHeapObject* self, PyObject* item) {
+    int32_t key;
+    int removed_key;
+    void* removed;
+
+    if (PyMinHeap_key_of(self, item, &key) < 0) return NULL;
+
+    Py_INCREF(item);
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, min_heap_pushpop_keyed(self->min_heap, key, item, &removed_key, &removed));
+    Py_END_CRITICAL_SECTION();
+
+    return (PyObject*)removed;
+}
+
+static PyObject* PyMinHeap_peek_keyed(PyMinHeapObject* self) {
+    int key;
+    void* item = NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, min_heap_peek_keyed(self->min_heap, &key, &item));
+    Py_XINCREF((PyObject*)item);
+    Py_END_CRITICAL_SECTION();
+
+    if (!item) {
+        Py_RETURN_NONE;
+    }
+
+    return (PyObject*)item;
+}
+
+static PyObject* PyMinHeap_insert(PyMinHeapObject* self, PyObject* arg) {
+    int32_t value;
+
+    if (PY_MIN_HEAP_IS_KEYED(self)) return PyMinHeap_insert_keyed(self, arg);
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+    value ^= self->flip;
+
+    char inserted;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    PYDS_TIMED(self, inserted = min_heap_insert(self->min_heap, value));
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    if (!inserted) {
+        if (self->view.obj) {
+            PyErr_SetString(PyExc_MemoryError, "shared MinHeap is full");
+            return NULL;
+        }
+        // A file-backed heap grows by resizing its file
+        return self->min_heap->file ? PyErr_SetFromErrno(PyExc_OSError) : PyErr_NoMemory();
+    }
 
     Py_RETURN_NONE;
 }
@@ -75,91 +397,1377 @@ static PyObject* PyMinHeap_insert(PyMinHeapObject* self, PyObject* args) {
 static PyObject* PyMinHeap_remove(PyMinHeapObject* self, PyObject* args) {
     int removed;
 
-    if (!min_heap_remove(self->min_heap, &removed)) {
+    if (PY_MIN_HEAP_IS_KEYED(self)) return PyMinHeap_remove_keyed(self);
+
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    PYDS_TIMED(self, found = min_heap_remove(self->min_heap, &removed));
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) {
         Py_RETURN_NONE;
     }
 
-    return PyLong_FromLong(removed);
+    return PyLong_FromLong(removed ^ self->flip);
 }
 
-static PyObject* PyMinHeap_pushpop(PyMinHeapObject* self, PyObject* args) {
-    int value;
+static PyObject* PyMinHeap_pushpop(PyMinHeapObject* self, PyObject* arg) {
+    int32_t value;
     int removed;
 
-    if(!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    if (!min_heap_pushpop(self->min_heap, value, &removed)) {
+    if (PY_MIN_HEAP_IS_KEYED(self)) return PyMinHeap_pushpop_keyed(self, arg);
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+    value ^= self->flip;
+
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    PYDS_TIMED(self, found = min_heap_pushpop(self->min_heap, value, &removed));
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) {
         Py_RETURN_NONE;
     }
 
-    return PyLong_FromLong(removed);
+    return PyLong_FromLong(removed ^ self->flip);
 }
 
 static PyObject* PyMinHeap_peek(PyMinHeapObject* self, PyObject* args) {
     int peek;
 
-    if (!min_heap_peek(self->min_heap, &peek)) {
+    if (PY_MIN_HEAP_IS_KEYED(self)) return PyMinHeap_peek_keyed(self);
+
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    PYDS_TIMED(self, found = min_heap_peek(self->min_heap, &peek));
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) {
         Py_RETURN_NONE;
     }
 
-    return PyLong_FromLong(peek);
+    return PyLong_FromLong(peek ^ self->flip);
+}
+
+typedef struct {
+    PyObject* owner;
+    const MinHeap* heap;
+    int* snapshot;  // Copy of a shared heap taken under its lock, or NULL
+    int index;
+    int size;
+    int32_t flip;  // Undoes the inversion of reverse heaps
+} PyMinHeapCursor;
+
+// Called inside the critical section of self
+static int PyMinHeap_cursor_init(PyMinHeapObject* self, PyMinHeapCursor* cursor) {
+    cursor->owner = (PyObject*)self;
+    cursor->heap = self->min_heap;
+    cursor->snapshot = NULL;
+    cursor->index = 0;
+    cursor->size = min_heap_length(self->min_heap);
+    cursor->flip = self->flip;
+    if (!self->view.obj) return 0;
+
+    // Serializing runs Python code, so shared heaps are copied out and unlocked first
+    min_heap_lock(self->min_heap);
+    cursor->size = min_heap_length(self->min_heap);
+    cursor->snapshot = PyMem_Malloc(((size_t)cursor->size + 1) * sizeof(int));
+    if (cursor->snapshot) memcpy(cursor->snapshot, self->min_heap->data, (size_t)cursor->size * sizeof(int));
+    min_heap_unlock(self->min_heap);
+
+    if (!cursor->snapshot) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static Py_ssize_t PyMinHeap_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    PyMinHeapCursor* cursor = (PyMinHeapCursor*)ctx;
+    const int* data = cursor->snapshot ? cursor->snapshot : cursor->heap->data;
+    int size = cursor->snapshot ? cursor->size : cursor->heap->size;
+    Py_ssize_t n = 0;
+    while (n < max && cursor->index < size) {
+        out[n++] = data[cursor->index++] ^ cursor->flip;
+    }
+    return n;
+}
+
+// dump() calls back into Python between chunks, so each chunk is read under the critical section
+static Py_ssize_t PyMinHeap_fill_locked(void* ctx, int32_t* out, Py_ssize_t max) {
+    Py_ssize_t n;
+    Py_BEGIN_CRITICAL_SECTION(((PyMinHeapCursor*)ctx)->owner);
+    n = PyMinHeap_fill(ctx, out, max);
+    Py_END_CRITICAL_SECTION();
+
+    return n;
+}
+
+// A payload in heap order re-inserts without any sift moves
+static int PyMinHeap_extend(void* ctx, const int32_t* values, Py_ssize_t count) {
+    MinHeap* heap = (MinHeap*)ctx;
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (!min_heap_insert(heap, values[i])) {
+            PyErr_NoMemory();
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Returns the items of a keyed heap in heap order
+static PyObject* PyMinHeap_items(PyMinHeapObject* self, int as_array) {
+    if (as_array) {
+        PyErr_SetString(PyExc_TypeError, "a MinHeap with a key holds objects, not an int32 array");
+        return NULL;
+    }
+
+    PyObject* list;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    int size = min_heap_length(self->min_heap);
+    list = PyList_New(size);
+    for (int i = 0; list && i < size; i++) {
+        PyObject* item = (PyObject*)self->min_heap->payloads[i];
+        Py_INCREF(item);
+        PYDS_LIST_SET_ITEM(list, i, item);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return list;
+}
+
+// Rejects int32 serialization of keyed and reversed heaps, which pickle instead
+static int PyMinHeap_check_plain(PyMinHeapObject* self, const char* method) {
+    if (!PY_MIN_HEAP_IS_KEYED(self) && !self->flip) return 0;
+
+    PyErr_Format(PyExc_TypeError, "%s() needs a MinHeap without key or reverse", method);
+    return -1;
+}
+
+// Returns the heap array of an int heap, with reversed values restored
+static PyObject* PyMinHeap_values(PyMinHeapObject* self, int as_array) {
+    PyObject* result = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyMinHeapCursor cursor;
+    if (PyMinHeap_cursor_init(self, &cursor) == 0) {
+        result = pyds_int32_result(cursor.size, PyMinHeap_fill, &cursor, as_array);
+        PyMem_Free(cursor.snapshot);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return result;
+}
+
+static PyObject* PyMinHeap_to_list(PyMinHeapObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+    if (PY_MIN_HEAP_IS_KEYED(self)) return PyMinHeap_items(self, as_array);
+    return PyMinHeap_values(self, as_array);
+}
+
+static PyObject* PyMinHeap_tobytes(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    if (PyMinHeap_check_plain(self, "tobytes") < 0) return NULL;
+
+    PyObject* bytes = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyMinHeapCursor cursor;
+    if (PyMinHeap_cursor_init(self, &cursor) == 0) {
+        bytes = pyds_tobytes(cursor.size, PyMinHeap_fill, &cursor);
+        PyMem_Free(cursor.snapshot);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return bytes;
+}
+
+static PyObject* PyMinHeap_cls_frombytes(PyObject* cls, PyObject* data) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_frombytes(data, PyMinHeap_extend, ((PyMinHeapObject*)obj)->min_heap) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+// Keyed and reversed heaps pickle as type(self).heapify(items, key, reverse)
+static PyObject* PyMinHeap_reduce_options(PyMinHeapObject* self) {
+    PyObject* heapify = PyObject_GetAttrString((PyObject*)Py_TYPE((PyObject*)self), "heapify");
+    if (!heapify) return NULL;
+
+    PyObject* items = PY_MIN_HEAP_IS_KEYED(self) ? PyMinHeap_items(self, 0) : PyMinHeap_values(self, 0);
+    if (!items) {
+        Py_DECREF(heapify);
+        return NULL;
+    }
+
+    return Py_BuildValue("(N(NOO))", heapify, items, self->key ? self->key : Py_None, self->flip ? Py_True : Py_False);
+}
+
+static PyObject* PyMinHeap_reduce(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    if (PY_MIN_HEAP_IS_KEYED(self) || self->flip) return PyMinHeap_reduce_options(self);
+
+    PyObject* payload = PyMinHeap_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    return result;
+}
+
+static PyObject* PyMinHeap_dump(PyMinHeapObject* self, PyObject* fileobj) {
+    if (PyMinHeap_check_plain(self, "dump") < 0) return NULL;
+
+    PyMinHeapCursor cursor;
+    int init_status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    init_status = PyMinHeap_cursor_init(self, &cursor);
+    Py_END_CRITICAL_SECTION();
+    if (init_status < 0) return NULL;
+
+    int status = pyds_dump(fileobj, PYDS_CONTAINER_MIN_HEAP, cursor.size, PyMinHeap_fill_locked, &cursor);
+    PyMem_Free(cursor.snapshot);
+    if (status < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyMinHeap_cls_load(PyObject* cls, PyObject* fileobj) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_load(fileobj, PYDS_CONTAINER_MIN_HEAP, PyMinHeap_extend, ((PyMinHeapObject*)obj)->min_heap) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
 }
 
 static Py_ssize_t PyMinHeap_length(PyMinHeapObject* self) {
-    return (Py_ssize_t)min_heap_length(self->min_heap);
+    int size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    size = min_heap_length(self->min_heap);
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyMinHeap_sizeof(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    usage = min_heap_memory_usage(self->min_heap);
+    min_heap_unlock(self->min_heap);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyMinHeapObject) + usage);
+}
+
+static PyObject* PyMinHeap_stats(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    min_heap_get_stats(self->min_heap, &stats);
+    min_heap_unlock(self->min_heap);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyMinHeap_reset_stats(PyMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_lock(self->min_heap);
+    min_heap_reset_stats(self->min_heap);
+    min_heap_unlock(self->min_heap);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyMinHeap_get_key(PyMinHeapObject* self, void* Py_UNUSED(closure)) {
+    PyObject* key = self->key ? self->key : Py_None;
+    Py_INCREF(key);
+    return key;
+}
+
+static PyObject* PyMinHeap_get_reverse(PyMinHeapObject* self, void* Py_UNUSED(closure)) {
+    return PyBool_FromLong(self->flip != 0);
 }
 
+static PyGetSetDef PyMinHeap_getset[] = {
+    {"key", (getter)PyMinHeap_get_key, NULL, "The key function, or None.", NULL},
+    {"reverse", (getter)PyMinHeap_get_reverse, NULL, "True if remove() returns the largest key first.", NULL},
+    {NULL}
+};
+
 static PyMethodDef PyMinHeap_methods[] = {
-    {"heapify", (PyCFunction)PyMinHeap_cls_heapify, METH_VARARGS | METH_CLASS, "Receives an integer array and returns a minimum heap."},
-    {"insert", (PyCFunction)PyMinHeap_insert, METH_VARARGS, "Add a value to the minimum heap."},
+    {"heapify", (PyCFunction)(void(*)(void))PyMinHeap_cls_heapify, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Receives an array and returns a minimum heap, optionally with a key function or reversed."},
+    {"insert", (PyCFunction)PyMinHeap_insert, METH_O, "Add a value to the minimum heap."},
     {"remove", (PyCFunction)PyMinHeap_remove, METH_NOARGS, "Remove the minimum value from the minimum heap."},
     {"peek", (PyCFunction)PyMinHeap_peek, METH_NOARGS, "Peek the minimum value from the minimum heap."},
-    {"pushpop", (PyCFunction)PyMinHeap_pushpop, METH_VARARGS, "Insert a value into the minimum heap and remove the current minimum in a single operation."},
+    {"pushpop", (PyCFunction)PyMinHeap_pushpop, METH_O, "Insert a value into the minimum heap and remove the current minimum in a single operation."},
+    {"open", (PyCFunction)(void(*)(void))PyMinHeap_cls_open, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Open or create a minimum heap backed by a memory-mapped file."},
+    {"attach", (PyCFunction)(void(*)(void))PyMinHeap_cls_attach, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Use a minimum heap stored in a shared memory buffer, creating an empty one if create is true."},
+    {"sync", (PyCFunction)PyMinHeap_sync, METH_NOARGS, "Flush a file-backed heap to disk. Does nothing for in-memory heaps."},
+    {"to_list", (PyCFunction)(void(*)(void))PyMinHeap_to_list, METH_VARARGS | METH_KEYWORDS, "Return the heap array as a list, or as array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyMinHeap_tobytes, METH_NOARGS, "Return the heap array as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)PyMinHeap_cls_frombytes, METH_O | METH_CLASS, "Build a minimum heap from little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyMinHeap_dump, METH_O, "Write the heap to a binary file object."},
+    {"load", (PyCFunction)PyMinHeap_cls_load, METH_O | METH_CLASS, "Read a heap written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyMinHeap_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyMinHeap_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyMinHeap_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyMinHeap_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
     {NULL}
 };
 
-static PySequenceMethods PyMinHeap_sequence_methods = {
-    .sq_length = (lenfunc)PyMinHeap_length,
-    0, 0, 0, 0, 0, 0, 0, 0, 0
+static PyType_Slot PyMinHeap_slots[] = {
+    {Py_tp_doc, (void*)"Minimum Heap\n"
+        "\n"
+        "MinHeap(*, key=None, reverse=False) orders items by key(item), an int32 computed once per insert, "
+        "and returns the largest key first if reverse is true. Items with equal keys come out in no particular order.\n"
+        "\n"
+        "- heapify(array: list, key=None, reverse=False) - Receives an array and returns a minimum heap.\n"
+        "- insert(value: int) - Add a value to the minimum heap.\n"
+        "- remove() -> Optional[int] - Remove the minimum value from the minimum heap.\n"
+        "- peek() -> Optional[int] - Peek the minimum value from the minimum heap.\n"
+        "- pushpop(value: int) -> int - Insert a value into the minimum heap and remove the current minimum in a single operation.\n"
+        "- open(path: str, verify: bool = False) - Open or create a minimum heap backed by a memory-mapped file.\n"
+        "- attach(buffer, create: bool = False) - Use a minimum heap stored in a shared memory buffer, creating an empty one if create is true.\n"
+        "- sync() - Flush a file-backed heap to disk. Does nothing for in-memory heaps.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Return the heap array as a list, or as array('i') if as_array is true.\n"
+        "- tobytes() -> bytes - Return the heap array as little-endian int32 bytes.\n"
+        "- frombytes(data: bytes) -> MinHeap - Build a minimum heap from little-endian int32 bytes.\n"
+        "- dump(file) - Write the heap to a binary file object.\n"
+        "- load(file) -> MinHeap - Read a heap written by dump() from a binary file object.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"},
+    {Py_tp_methods, PyMinHeap_methods},
+    {Py_tp_getset, PyMinHeap_getset},
+    {Py_tp_new, PyMinHeap_new},
+    {Py_tp_dealloc, PyMinHeap_dealloc},
+    {Py_tp_traverse, PyMinHeap_traverse},
+    {Py_tp_clear, PyMinHeap_clear},
+    {Py_sq_length, PyMinHeap_length},
+    {0, NULL}
 };
 
-static PyTypeObject PyMinHeapType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    .tp_name = "min_heap.MinHeap",
-    .tp_basicsize = sizeof(PyMinHeapObject),
-    .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT,
-    .tp_doc = "Minimum Heap\n"
-    "\n"
-    "- heapify(array: list[int]) - Receives an array and returns a minimum heap.\n"
-    "- insert(value: int) - Add a value to the minimum heap.\n"
-    "- remove() -> Optional[int] - Remove the minimum value from the minimum heap.\n"
-    "- peek() -> Optional[int] - Peek the minimum value from the minimum heap.\n"
-    "- pushpop(value: int) -> int - Insert a value into the minimum heap and remove the current minimum in a single operation.\n",
-    .tp_methods = PyMinHeap_methods,
-    .tp_new = PyMinHeap_new,
-    .tp_dealloc = (destructor)PyMinHeap_dealloc,
-    .tp_as_sequence = &PyMinHeap_sequence_methods,
+static PyType_Spec PyMinHeap_spec = {
+    .name = "pydatastructs.min_heap.MinHeap",
+    .basicsize = sizeof(PyMinHeapObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyMinHeap_slots,
 };
 
-static PyModuleDef min_heap_module = {
-    PyModuleDef_HEAD_INIT,
-    "min_heap",
-    "This module exposes a high-performance, memory-efficient minimum heap "
-    "implementation written in C to Python via the C API",
-    -1,
-    NULL, NULL, NULL, NULL, NULL
+typedef struct {
+    PyObject_HEAD;
+    pyds_object_array_t heap;
+} PyObjectMinHeapObject;
+
+#define PY_OBJECT_MIN_HEAP_NAME "ObjectMinHeap"
+
+// Both sifts swap instead of moving a hole, so every item stays referenced
+// exactly once while a comparison runs Python code.
+static int PyObjectMinHeap_sift_up(pyds_object_array_t* heap, Py_ssize_t start, Py_ssize_t index) {
+    PyObject** items = heap->items;
+    while (index > start) {
+        Py_ssize_t parent = (index - 1) / 2;
+        int less = pyds_object_less(heap->kind, items[index], items[parent]);
+        if (less < 0) return -1;
+        if (!less) break;
+
+        PyObject* item = items[index];
+        items[index] = items[parent];
+        items[parent] = item;
+        index = parent;
+    }
+    return 0;
+}
+
+// Bottom-up like heapq: carries the item down the path of smaller children
+// to a leaf, one comparison per level, then sifts it back up. The item
+// usually belongs near the bottom, so this takes about half the comparisons
+// of stopping on the way down.
+static int PyObjectMinHeap_sift_down(pyds_object_array_t* heap, Py_ssize_t index) {
+    PyObject** items = heap->items;
+    Py_ssize_t size = heap->size;
+    Py_ssize_t start = index;
+    Py_ssize_t child = 2 * index + 1;
+
+    while (child < size) {
+        if (child + 1 < size) {
+            int less = pyds_object_less(heap->kind, items[child + 1], items[child]);
+            if (less < 0) return -1;
+            child += less;
+        }
+
+        PyObject* item = items[index];
+        items[index] = items[child];
+        items[child] = item;
+        index = child;
+        child = 2 * index + 1;
+    }
+    return PyObjectMinHeap_sift_up(heap, start, index);
+}
+
+static int PyObjectMinHeap_add(void* ctx, PyObject* item) {
+    return pyds_object_array_push((pyds_object_array_t*)ctx, item);
+}
+
+static int PyObjectMinHeap_traverse(PyObjectMinHeapObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    return pyds_object_array_traverse(&self->heap, visit, arg);
+}
+
+static int PyObjectMinHeap_clear(PyObjectMinHeapObject* self) {
+    pyds_object_array_clear(&self->heap);
+    return 0;
+}
+
+static void PyObjectMinHeap_dealloc(PyObjectMinHeapObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyObjectMinHeap_clear(self);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyObjectMinHeap_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    PyObject* iterable;
+    if (pyds_parse_iterable(args, kwargs, "|O:" PY_OBJECT_MIN_HEAP_NAME, &iterable) < 0) return NULL;
+
+    PyObjectMinHeapObject* self = (PyObjectMinHeapObject*)PyType_GenericAlloc(type, 0);
+    if (!self || !iterable) return (PyObject*)self;
+
+    int status = pyds_for_each(iterable, PyObjectMinHeap_add, &self->heap);
+    self->heap.busy = 1;
+    for (Py_ssize_t i = self->heap.size / 2 - 1; status == 0 && i >= 0; i--) {
+        status = PyObjectMinHeap_sift_down(&self->heap, i);
+    }
+    self->heap.busy = 0;
+
+    if (status < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject*)self;
+}
+
+static PyObject* PyObjectMinHeap_cls_heapify(PyObject* cls, PyObject* iterable) {
+    return PyObject_CallFunctionObjArgs(cls, iterable, NULL);
+}
+
+static PyObject* PyObjectMinHeap_insert(PyObjectMinHeapObject* self, PyObject* value) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->heap.busy) {
+        pyds_object_busy(PY_OBJECT_MIN_HEAP_NAME);
+        status = -1;
+    } else {
+        status = pyds_object_array_push(&self->heap, value);
+        if (status == 0) {
+            self->heap.busy = 1;
+            status = PyObjectMinHeap_sift_up(&self->heap, 0, self->heap.size - 1);
+            self->heap.busy = 0;
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyObjectMinHeap_remove(PyObjectMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* removed = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->heap.busy) {
+        pyds_object_busy(PY_OBJECT_MIN_HEAP_NAME);
+    } else if (self->heap.size == 0) {
+        removed = Py_None;
+        Py_INCREF(removed);
+    } else {
+        PyObject* last = pyds_object_array_pop(&self->heap);
+        if (self->heap.size == 0) {
+            removed = last;
+        } else {
+            removed = self->heap.items[0];
+            self->heap.items[0] = last;
+            self->heap.busy = 1;
+            if (PyObjectMinHeap_sift_down(&self->heap, 0) < 0) Py_CLEAR(removed);
+            self->heap.busy = 0;
+        }
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectMinHeap_peek(PyObjectMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* peek;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    peek = self->heap.size ? self->heap.items[0] : Py_None;
+    Py_INCREF(peek);
+    Py_END_CRITICAL_SECTION();
+
+    return peek;
+}
+
+static PyObject* PyObjectMinHeap_pushpop(PyObjectMinHeapObject* self, PyObject* value) {
+    PyObject* removed = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->heap.busy) {
+        pyds_object_busy(PY_OBJECT_MIN_HEAP_NAME);
+    } else if (self->heap.size == 0) {
+        removed = value;
+        Py_INCREF(removed);
+    } else {
+        pyds_kind_t kind = pyds_kind_join(self->heap.kind, value);
+        self->heap.busy = 1;
+        int less = pyds_object_less(kind, self->heap.items[0], value);
+        if (less == 0) {
+            removed = value;
+            Py_INCREF(removed);
+        } else if (less > 0) {
+            removed = self->heap.items[0];
+            Py_INCREF(value);
+            self->heap.items[0] = value;
+            self->heap.kind = kind;
+            if (PyObjectMinHeap_sift_down(&self->heap, 0) < 0) Py_CLEAR(removed);
+        }
+        self->heap.busy = 0;
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectMinHeap_to_list(PyObjectMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* list;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    list = pyds_object_array_to_list(&self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return list;
+}
+
+static PyObject* PyObjectMinHeap_reduce(PyObjectMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* items = PyObjectMinHeap_to_list(self, NULL);
+    if (!items) return NULL;
+
+    return Py_BuildValue("(O(N))", (PyObject*)Py_TYPE((PyObject*)self), items);
+}
+
+static Py_ssize_t PyObjectMinHeap_length(PyObjectMinHeapObject* self) {
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = self->heap.size;
+    Py_END_CRITICAL_SECTION();
+
+    return size;
+}
+
+static PyObject* PyObjectMinHeap_sizeof(PyObjectMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = pyds_object_array_memory_usage(&self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyObjectMinHeapObject) + usage);
+}
+
+static PyMethodDef PyObjectMinHeap_methods[] = {
+    {"heapify", (PyCFunction)PyObjectMinHeap_cls_heapify, METH_O | METH_CLASS, "Receives an iterable and returns a minimum heap of its items."},
+    {"insert", (PyCFunction)PyObjectMinHeap_insert, METH_O, "Add an item to the minimum heap."},
+    {"remove", (PyCFunction)PyObjectMinHeap_remove, METH_NOARGS, "Remove the smallest item from the minimum heap."},
+    {"peek", (PyCFunction)PyObjectMinHeap_peek, METH_NOARGS, "Peek the smallest item from the minimum heap."},
+    {"pushpop", (PyCFunction)PyObjectMinHeap_pushpop, METH_O, "Insert an item into the minimum heap and remove the current smallest in a single operation."},
+    {"to_list", (PyCFunction)PyObjectMinHeap_to_list, METH_NOARGS, "Return the heap array as a list."},
+    {"__reduce__", (PyCFunction)PyObjectMinHeap_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyObjectMinHeap_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
 };
 
-PyMODINIT_FUNC PyInit_min_heap(void) {
-    PyObject *m;
+static PyType_Slot PyObjectMinHeap_slots[] = {
+    {Py_tp_doc, (void*)"Minimum Heap of arbitrary objects, ordered with <\n"
+        "\n"
+        "- ObjectMinHeap(iterable=()) - Build a minimum heap from the items of iterable.\n"
+        "- heapify(iterable) -> ObjectMinHeap - Receives an iterable and returns a minimum heap of its items.\n"
+        "- insert(item) - Add an item to the minimum heap.\n"
+        "- remove() -> Optional[object] - Remove the smallest item from the minimum heap.\n"
+        "- peek() -> Optional[object] - Peek the smallest item from the minimum heap.\n"
+        "- pushpop(item) -> object - Insert an item into the minimum heap and remove the current smallest in a single operation.\n"
+        "- to_list() -> list - Return the heap array as a list.\n"},
+    {Py_tp_methods, PyObjectMinHeap_methods},
+    {Py_tp_new, PyObjectMinHeap_new},
+    {Py_tp_dealloc, PyObjectMinHeap_dealloc},
+    {Py_tp_traverse, PyObjectMinHeap_traverse},
+    {Py_tp_clear, PyObjectMinHeap_clear},
+    {Py_sq_length, PyObjectMinHeap_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyObjectMinHeap_spec = {
+    .name = "pydatastructs.min_heap.ObjectMinHeap",
+    .basicsize = sizeof(PyObjectMinHeapObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyObjectMinHeap_slots,
+};
+
+typedef struct {
+    PyObject_HEAD;
+    MinHeap* heap;  // Min-max ordered; see min_max_heap_heapify()
+    Py_ssize_t maxlen;  // Most values kept, or -1 if unbounded
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
+} PyMinMaxHeapObject;
+
+static void PyMinMaxHeap_dealloc(PyMinMaxHeapObject* self) {
+    min_heap_free(self->heap);
+    pyds_type_free((PyObject*)self);
+}
+
+// maxlen=None means unbounded
+static int PyMinMaxHeap_parse_maxlen(PyObject* arg, Py_ssize_t* maxlen) {
+    if (!arg || arg == Py_None) {
+        *maxlen = -1;
+        return 0;
+    }
+
+    Py_ssize_t value = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if (value == -1 && PyErr_Occurred()) return -1;
+    if (value < 0) {
+        PyErr_SetString(PyExc_ValueError, "maxlen must be non-negative");
+        return -1;
+    }
+
+    *maxlen = value;
+    return 0;
+}
+
+// Wraps heap, which may be NULL after a failed allocation, like PyMinHeap_wrap()
+static PyObject* PyMinMaxHeap_wrap(PyTypeObject* type, MinHeap* heap, Py_ssize_t maxlen) {
+    if (!heap) return PyErr_NoMemory();
+
+    PyMinMaxHeapObject* self = (PyMinMaxHeapObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        min_heap_free(heap);
+        return NULL;
+    }
+
+    self->heap = heap;
+    self->maxlen = maxlen;
+    return (PyObject*)self;
+}
+
+static PyObject* PyMinMaxHeap_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"maxlen", NULL};
+    PyObject* maxlen_arg = Py_None;
+    Py_ssize_t maxlen;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$O:MinMaxHeap", kwlist, &maxlen_arg)) return NULL;
+    if (PyMinMaxHeap_parse_maxlen(maxlen_arg, &maxlen) < 0) return NULL;
+    return PyMinMaxHeap_wrap(type, min_heap_create(), maxlen);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyMinMaxHeap_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (PyVectorcall_NARGS(nargsf) == 0 && !kwnames) return PyMinMaxHeap_wrap((PyTypeObject*)type, min_heap_create(), -1);
+    return pyds_vectorcall_new((PyTypeObject*)type, args, nargsf, kwnames, PyMinMaxHeap_new);
+}
+#endif
+
+static PyObject* PyMinMaxHeap_cls_heapify(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"iterable", "maxlen", NULL};
+    PyObject* iterable;
+    PyObject* maxlen_arg = Py_None;
+    Py_ssize_t maxlen;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:heapify", kwlist, &iterable, &maxlen_arg)) return NULL;
+    if (PyMinMaxHeap_parse_maxlen(maxlen_arg, &maxlen) < 0) return NULL;
+
+    PyObject* iterator = PyObject_GetIter(iterable);
+    if (!iterator) return NULL;
+
+    int len = 0, capacity = 64;
+    int* arr = malloc(sizeof(int) * capacity);
+    PyObject* item = NULL;
+    while (arr && (item = PyIter_Next(iterator))) {
+        int32_t value;
+        int status = pyds_as_int32(item, &value);
+        Py_DECREF(item);
+        if (status < 0) break;
+
+        if (len == capacity) {
+            int* grown = capacity <= INT_MAX / 2 ? realloc(arr, sizeof(int) * 2 * (size_t)capacity) : NULL;
+            if (!grown) {
+                PyErr_NoMemory();
+                break;
+            }
+            arr = grown;
+            capacity *= 2;
+        }
+        arr[len++] = value;
+    }
+    Py_DECREF(iterator);
+    if (!arr) return PyErr_NoMemory();
+    if (PyErr_Occurred()) {
+        free(arr);
+        return NULL;
+    }
+
+    MinHeap* heap = min_max_heap_heapify(arr, len);
+    free(arr);
+
+    // A bounded heap keeps the maxlen smallest values
+    int removed;
+    while (heap && maxlen >= 0 && heap->size > maxlen) min_max_heap_pop_max(heap, &removed);
+    return PyMinMaxHeap_wrap((PyTypeObject*)cls, heap, maxlen);
+}
+
+static PyObject* PyMinMaxHeap_insert(PyMinMaxHeapObject* self, PyObject* arg) {
+    int32_t value;
+    int evicted;
+    char added = 0, full;
 
-    if (PyType_Ready(&PyMinHeapType) < 0) return NULL;
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
 
-    m = PyModule_Create(&min_heap_module);
-    if (!m) return NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    full = self->maxlen >= 0 && min_heap_length(self->heap) >= self->maxlen;
+    if (full) PYDS_TIMED(self, min_max_heap_pushpop_max(self->heap, value, &evicted));
+    else PYDS_TIMED(self, added = min_max_heap_insert(self->heap, value));
+    Py_END_CRITICAL_SECTION();
+
+    if (full) return PyLong_FromLong(evicted);
+    if (!added) return PyErr_NoMemory();
+    Py_RETURN_NONE;
+}
+
+// Runs one of the min_max_heap_peek_*/pop_* functions; None if the heap is empty
+static PyObject* PyMinMaxHeap_take(PyMinMaxHeapObject* self, char (*take)(MinHeap*, int*)) {
+    int value;
+    char found;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, found = take(self->heap, &value));
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) Py_RETURN_NONE;
+    return PyLong_FromLong(value);
+}
+
+static PyObject* PyMinMaxHeap_peek_min(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyMinMaxHeap_take(self, min_max_heap_peek_min);
+}
+
+static PyObject* PyMinMaxHeap_peek_max(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyMinMaxHeap_take(self, min_max_heap_peek_max);
+}
+
+static PyObject* PyMinMaxHeap_pop_min(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyMinMaxHeap_take(self, min_max_heap_pop_min);
+}
+
+static PyObject* PyMinMaxHeap_pop_max(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyMinMaxHeap_take(self, min_max_heap_pop_max);
+}
+
+// Returns the heap array, which heapify() takes back without moving anything
+static PyObject* PyMinMaxHeap_values(PyMinMaxHeapObject* self, int as_array) {
+    PyObject* result;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PyMinHeapCursor cursor = {(PyObject*)self, self->heap, NULL, 0, min_heap_length(self->heap), 0};
+    result = pyds_int32_result(cursor.size, PyMinHeap_fill, &cursor, as_array);
+    Py_END_CRITICAL_SECTION();
+
+    return result;
+}
+
+static PyObject* PyMinMaxHeap_to_list(PyMinMaxHeapObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+    return PyMinMaxHeap_values(self, as_array);
+}
+
+static PyObject* PyMinMaxHeap_reduce(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* heapify = PyObject_GetAttrString((PyObject*)Py_TYPE((PyObject*)self), "heapify");
+    if (!heapify) return NULL;
+
+    PyObject* values = PyMinMaxHeap_values(self, 0);
+    if (!values) {
+        Py_DECREF(heapify);
+        return NULL;
+    }
+
+    if (self->maxlen < 0) return Py_BuildValue("(N(N))", heapify, values);
+    return Py_BuildValue("(N(Nn))", heapify, values, self->maxlen);
+}
+
+static Py_ssize_t PyMinMaxHeap_length(PyMinMaxHeapObject* self) {
+    int size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = min_heap_length(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyMinMaxHeap_sizeof(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = min_heap_memory_usage(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyMinMaxHeapObject) + usage);
+}
+
+static PyObject* PyMinMaxHeap_stats(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_get_stats(self->heap, &stats);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyMinMaxHeap_reset_stats(PyMinMaxHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    min_heap_reset_stats(self->heap);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyMinMaxHeap_get_maxlen(PyMinMaxHeapObject* self, void* Py_UNUSED(closure)) {
+    if (self->maxlen < 0) Py_RETURN_NONE;
+    return PyLong_FromSsize_t(self->maxlen);
+}
+
+static PyGetSetDef PyMinMaxHeap_getset[] = {
+    {"maxlen", (getter)PyMinMaxHeap_get_maxlen, NULL, "Most values kept, or None if unbounded.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyMinMaxHeap_methods[] = {
+    {"heapify", (PyCFunction)(void(*)(void))PyMinMaxHeap_cls_heapify, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Receives an iterable and returns a min-max heap, keeping the maxlen smallest values if bounded."},
+    {"insert", (PyCFunction)PyMinMaxHeap_insert, METH_O, "Add a value. A full bounded heap evicts and returns the largest of its values and the new one."},
+    {"peek_min", (PyCFunction)PyMinMaxHeap_peek_min, METH_NOARGS, "Peek the minimum value. If there is no element, return None."},
+    {"peek_max", (PyCFunction)PyMinMaxHeap_peek_max, METH_NOARGS, "Peek the maximum value. If there is no element, return None."},
+    {"pop_min", (PyCFunction)PyMinMaxHeap_pop_min, METH_NOARGS, "Remove the minimum value. If there is no element, return None."},
+    {"pop_max", (PyCFunction)PyMinMaxHeap_pop_max, METH_NOARGS, "Remove the maximum value. If there is no element, return None."},
+    {"to_list", (PyCFunction)(void(*)(void))PyMinMaxHeap_to_list, METH_VARARGS | METH_KEYWORDS, "Return the heap array as a list, or as array('i') if as_array is true."},
+    {"__reduce__", (PyCFunction)PyMinMaxHeap_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyMinMaxHeap_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyMinMaxHeap_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyMinMaxHeap_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
+    {NULL}
+};
+
+static PyType_Slot PyMinMaxHeap_slots[] = {
+    {Py_tp_doc, (void*)"Min-Max Heap\n"
+        "\n"
+        "MinMaxHeap(*, maxlen=None) is a double-ended priority queue of int32 values in one array. "
+        "A bounded heap keeps the maxlen smallest values it has seen.\n"
+        "\n"
+        "- heapify(iterable, maxlen=None) -> MinMaxHeap - Receives an iterable and returns a min-max heap.\n"
+        "- insert(value: int) -> Optional[int] - Add a value. A full bounded heap evicts and returns the largest of its values and the new one.\n"
+        "- peek_min() -> Optional[int] - Peek the minimum value.\n"
+        "- peek_max() -> Optional[int] - Peek the maximum value.\n"
+        "- pop_min() -> Optional[int] - Remove the minimum value.\n"
+        "- pop_max() -> Optional[int] - Remove the maximum value.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Return the heap array as a list, or as array('i') if as_array is true.\n"
+        "- maxlen -> Optional[int] - Most values kept, or None if unbounded.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"},
+    {Py_tp_methods, PyMinMaxHeap_methods},
+    {Py_tp_getset, PyMinMaxHeap_getset},
+    {Py_tp_new, PyMinMaxHeap_new},
+    {Py_tp_dealloc, PyMinMaxHeap_dealloc},
+    {Py_sq_length, PyMinMaxHeap_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyMinMaxHeap_spec = {
+    .name = "pydatastructs.min_heap.MinMaxHeap",
+    .basicsize = sizeof(PyMinMaxHeapObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyMinMaxHeap_slots,
+};
+
+#define PY_EXTERNAL_MIN_HEAP_DEFAULT_MEMORY ((size_t)64 << 20)
+
+typedef struct {
+    PyObject_HEAD;
+    external_heap_t* heap;
+    size_t memory_limit;
+} PyExternalMinHeapObject;
+
+static void PyExternalMinHeap_dealloc(PyExternalMinHeapObject* self) {
+    external_heap_free(self->heap);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyExternalMinHeap_create(PyTypeObject* type, size_t memory_limit, const char* directory) {
+    external_heap_t* heap = external_heap_create(memory_limit, directory);
+    if (!heap) return PyErr_NoMemory();
+
+    PyExternalMinHeapObject* self = (PyExternalMinHeapObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        external_heap_free(heap);
+        return NULL;
+    }
+
+    self->heap = heap;
+    self->memory_limit = memory_limit;
+    return (PyObject*)self;
+}
+
+static PyObject* PyExternalMinHeap_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"memory_limit", "directory", NULL};
+    Py_ssize_t memory_limit = (Py_ssize_t)PY_EXTERNAL_MIN_HEAP_DEFAULT_MEMORY;
+    PyObject* directory_arg = Py_None;
+    PyObject* directory = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$nO:ExternalMinHeap", kwlist, &memory_limit, &directory_arg)) {
+        return NULL;
+    }
+    if (memory_limit < EXTERNAL_HEAP_MIN_MEMORY) {
+        PyErr_Format(PyExc_ValueError, "memory_limit must be at least %d bytes", EXTERNAL_HEAP_MIN_MEMORY);
+        return NULL;
+    }
+    if (directory_arg != Py_None && !PyUnicode_FSConverter(directory_arg, &directory)) return NULL;
 
-    Py_INCREF(&PyMinHeapType);
-    PyModule_AddObject(m, "MinHeap", (PyObject*)&PyMinHeapType);
-    return m;
+    PyObject* self = PyExternalMinHeap_create(type, (size_t)memory_limit, directory ? PyBytes_AsString(directory) : NULL);
+    Py_XDECREF(directory);
+    return self;
 }
 
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyExternalMinHeap_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (PyVectorcall_NARGS(nargsf) == 0 && !kwnames) {
+        return PyExternalMinHeap_create((PyTypeObject*)type, PY_EXTERNAL_MIN_HEAP_DEFAULT_MEMORY, NULL);
+    }
+    return pyds_vectorcall_new((PyTypeObject*)type, args, nargsf, kwnames, PyExternalMinHeap_new);
+}
+#endif
+
+// error is the errno saved inside the critical section
+static PyObject* PyExternalMinHeap_error(external_heap_status_t status, int error) {
+    if (status == EXTERNAL_HEAP_ERROR_MEMORY) return PyErr_NoMemory();
+    errno = error;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+static PyObject* PyExternalMinHeap_insert(PyExternalMinHeapObject* self, PyObject* arg) {
+    int32_t value;
+    external_heap_status_t status;
+    int error;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = external_heap_insert(self->heap, value);
+    error = errno;
+    Py_END_CRITICAL_SECTION();
+
+    if (status != EXTERNAL_HEAP_OK) return PyExternalMinHeap_error(status, error);
+    Py_RETURN_NONE;
+}
+
+// Runs external_heap_peek() or external_heap_remove(); None if the heap is empty
+static PyObject* PyExternalMinHeap_take(PyExternalMinHeapObject* self, char remove) {
+    int32_t value;
+    external_heap_status_t status;
+    int error;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = remove ? external_heap_remove(self->heap, &value) : external_heap_peek(self->heap, &value);
+    error = errno;
+    Py_END_CRITICAL_SECTION();
+
+    if (status == EXTERNAL_HEAP_EMPTY) Py_RETURN_NONE;
+    if (status != EXTERNAL_HEAP_OK) return PyExternalMinHeap_error(status, error);
+    return PyLong_FromLong(value);
+}
+
+static PyObject* PyExternalMinHeap_remove(PyExternalMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyExternalMinHeap_take(self, 1);
+}
+
+static PyObject* PyExternalMinHeap_peek(PyExternalMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyExternalMinHeap_take(self, 0);
+}
+
+static Py_ssize_t PyExternalMinHeap_length(PyExternalMinHeapObject* self) {
+    size_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = external_heap_length(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyExternalMinHeap_sizeof(PyExternalMinHeapObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = external_heap_memory_usage(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyExternalMinHeapObject) + usage);
+}
+
+static PyObject* PyExternalMinHeap_get_memory_limit(PyExternalMinHeapObject* self, void* Py_UNUSED(closure)) {
+    return PyLong_FromSize_t(self->memory_limit);
+}
+
+static PyObject* PyExternalMinHeap_get_runs(PyExternalMinHeapObject* self, void* Py_UNUSED(closure)) {
+    int runs;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    runs = self->heap->run_count;
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromLong(runs);
+}
+
+static PyObject* PyExternalMinHeap_get_spilled(PyExternalMinHeapObject* self, void* Py_UNUSED(closure)) {
+    size_t spilled;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    spilled = external_heap_spilled(self->heap);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(spilled);
+}
+
+static PyGetSetDef PyExternalMinHeap_getset[] = {
+    {"memory_limit", (getter)PyExternalMinHeap_get_memory_limit, NULL, "Budget in bytes for the in-memory buffer and the run blocks.", NULL},
+    {"runs", (getter)PyExternalMinHeap_get_runs, NULL, "Number of sorted runs in temporary files.", NULL},
+    {"spilled", (getter)PyExternalMinHeap_get_spilled, NULL, "Number of values in the runs rather than in memory.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyExternalMinHeap_methods[] = {
+    {"insert", (PyCFunction)PyExternalMinHeap_insert, METH_O, "Add a value, first writing the buffer to a run if it is full."},
+    {"remove", (PyCFunction)PyExternalMinHeap_remove, METH_NOARGS, "Remove the minimum value. If there is no element, return None."},
+    {"peek", (PyCFunction)PyExternalMinHeap_peek, METH_NOARGS, "Peek the minimum value. If there is no element, return None."},
+    {"__sizeof__", (PyCFunction)PyExternalMinHeap_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyExternalMinHeap_slots[] = {
+    {Py_tp_doc, (void*)"External Minimum Heap\n"
+        "\n"
+        "ExternalMinHeap(*, memory_limit=64 MiB, directory=None) is a minimum heap of int32 values that may not fit "
+        "in memory. A MinHeap buffer takes half of memory_limit; when it is full, its values are sorted and written "
+        "to a temporary file in directory (default: $TMPDIR) as a run, and runs are merged back as values are "
+        "removed. The files are deleted as soon as they are created, so nothing is left behind. "
+        "File errors raise OSError and leave the heap unchanged.\n"
+        "\n"
+        "- insert(value: int) - Add a value, first writing the buffer to a run if it is full.\n"
+        "- remove() -> Optional[int] - Remove the minimum value.\n"
+        "- peek() -> Optional[int] - Peek the minimum value.\n"
+        "- memory_limit -> int - Budget in bytes for the in-memory buffer and the run blocks.\n"
+        "- runs -> int - Number of sorted runs in temporary files.\n"
+        "- spilled -> int - Number of values in the runs rather than in memory.\n"},
+    {Py_tp_methods, PyExternalMinHeap_methods},
+    {Py_tp_getset, PyExternalMinHeap_getset},
+    {Py_tp_new, PyExternalMinHeap_new},
+    {Py_tp_dealloc, PyExternalMinHeap_dealloc},
+    {Py_sq_length, PyExternalMinHeap_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyExternalMinHeap_spec = {
+    .name = "pydatastructs.min_heap.ExternalMinHeap",
+    .basicsize = sizeof(PyExternalMinHeapObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyExternalMinHeap_slots,
+};
+
+// Ids taken off the queue per call into the core while pop_batch() builds its list
+#define PY_EVENT_QUEUE_CHUNK 64
+
+typedef struct {
+    PyObject_HEAD;
+    event_queue_t* queue;
+} PyEventQueueObject;
+
+static void PyEventQueue_dealloc(PyEventQueueObject* self) {
+    event_queue_free(self->queue);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyEventQueue_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+
+    event_queue_t* queue = event_queue_create();
+    if (!queue) return PyErr_NoMemory();
+
+    PyEventQueueObject* self = (PyEventQueueObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        event_queue_free(queue);
+        return NULL;
+    }
+
+    self->queue = queue;
+    return (PyObject*)self;
+}
+
+static PyObject* PyEventQueue_push(PyEventQueueObject* self, PyObject* args) {
+    long long time, id;
+    char added;
+
+    if (!PyArg_ParseTuple(args, "LL:push", &time, &id)) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    added = event_queue_push(self->queue, (int64_t)time, (int64_t)id);
+    Py_END_CRITICAL_SECTION();
+
+    if (!added) return PyErr_NoMemory();
+    Py_RETURN_NONE;
+}
+
+// Runs event_queue_peek() or event_queue_pop(); None if the queue is empty
+static PyObject* PyEventQueue_take(PyEventQueueObject* self, char remove) {
+    event_queue_entry_t entry;
+    char found;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    found = remove ? event_queue_pop(self->queue, &entry) : event_queue_peek(self->queue, &entry);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) Py_RETURN_NONE;
+    return Py_BuildValue("(LL)", (long long)entry.time, (long long)entry.id);
+}
+
+static PyObject* PyEventQueue_pop(PyEventQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyEventQueue_take(self, 1);
+}
+
+static PyObject* PyEventQueue_peek(PyEventQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyEventQueue_take(self, 0);
+}
+
+static PyObject* PyEventQueue_pop_batch(PyEventQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    int64_t time = 0, ids[PY_EVENT_QUEUE_CHUNK];
+    event_queue_entry_t next;
+    Py_ssize_t count = 0;
+    int failed = 0;
+
+    PyObject* list = PyList_New(0);
+    if (!list) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    while (!failed && event_queue_peek(self->queue, &next) && (count == 0 || next.time == time)) {
+        size_t taken = event_queue_pop_batch(self->queue, &time, ids, PY_EVENT_QUEUE_CHUNK);
+        for (size_t i = 0; i < taken; i++) {
+            PyObject* id = PyLong_FromLongLong(ids[i]);
+            if (!id || PyList_Append(list, id) < 0) {
+                Py_XDECREF(id);
+                failed = 1;
+                break;
+            }
+            Py_DECREF(id);
+        }
+        count += (Py_ssize_t)taken;
+    }
+    Py_END_CRITICAL_SECTION();
+
+    if (failed) {
+        Py_DECREF(list);
+        return NULL;
+    }
+    if (count == 0) {
+        Py_DECREF(list);
+        Py_RETURN_NONE;
+    }
+    return Py_BuildValue("(LN)", (long long)time, list);
+}
+
+static PyObject* PyEventQueue_clear(PyEventQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    event_queue_clear(self->queue);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+static Py_ssize_t PyEventQueue_length(PyEventQueueObject* self) {
+    size_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = event_queue_size(self->queue);
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)size;
+}
+
+static PyObject* PyEventQueue_sizeof(PyEventQueueObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = event_queue_memory_usage(self->queue);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyEventQueueObject) + usage);
+}
+
+static PyObject* PyEventQueue_get_next_time(PyEventQueueObject* self, void* Py_UNUSED(closure)) {
+    event_queue_entry_t entry;
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    found = event_queue_peek(self->queue, &entry);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) Py_RETURN_NONE;
+    return PyLong_FromLongLong(entry.time);
+}
+
+static PyGetSetDef PyEventQueue_getset[] = {
+    {"next_time", (getter)PyEventQueue_get_next_time, NULL, "Time of the next event, or None if the queue is empty.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PyEventQueue_methods[] = {
+    {"push", (PyCFunction)PyEventQueue_push, METH_VARARGS, "Schedule event_id at time, after every pending event at the same time."},
+    {"pop", (PyCFunction)PyEventQueue_pop, METH_NOARGS, "Remove the next event as (time, event_id). If there is no event, return None."},
+    {"peek", (PyCFunction)PyEventQueue_peek, METH_NOARGS, "Peek the next event as (time, event_id). If there is no event, return None."},
+    {"pop_batch", (PyCFunction)PyEventQueue_pop_batch, METH_NOARGS, "Remove every event at the earliest time as (time, [event_id, ...]) in push order. If there is no event, return None."},
+    {"clear", (PyCFunction)PyEventQueue_clear, METH_NOARGS, "Remove every event."},
+    {"__sizeof__", (PyCFunction)PyEventQueue_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyEventQueue_slots[] = {
+    {Py_tp_doc, (void*)"Event Queue\n"
+        "\n"
+        "EventQueue() is the event calendar of a discrete-event simulation: (time, event_id) pairs of int64 values "
+        "ordered by time, and events at the same time in the order they were pushed. Events pushed no earlier than "
+        "the latest pending one, the common case in simulations, go into a sorted ring in O(1); the others into a "
+        "4-ary heap.\n"
+        "\n"
+        "- push(time: int, event_id: int) - Schedule event_id at time, after every pending event at the same time.\n"
+        "- pop() -> Optional[tuple[int, int]] - Remove the next event as (time, event_id).\n"
+        "- peek() -> Optional[tuple[int, int]] - Peek the next event as (time, event_id).\n"
+        "- pop_batch() -> Optional[tuple[int, list[int]]] - Remove every event at the earliest time, in push order.\n"
+        "- clear() - Remove every event.\n"
+        "- next_time -> Optional[int] - Time of the next event.\n"},
+    {Py_tp_methods, PyEventQueue_methods},
+    {Py_tp_getset, PyEventQueue_getset},
+    {Py_tp_new, PyEventQueue_new},
+    {Py_tp_dealloc, PyEventQueue_dealloc},
+    {Py_sq_length, PyEventQueue_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyEventQueue_spec = {
+    .name = "pydatastructs.min_heap.EventQueue",
+    .basicsize = sizeof(PyEventQueueObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyEventQueue_slots,
+};
+
+typedef struct {
+    PyObject* type;  // MinHeap
+    PyObject* object_type;  // ObjectMinHeap
+    PyObject* min_max_type;  // MinMaxHeap
+    PyObject* external_type;  // ExternalMinHeap
+    PyObject* event_queue_type;  // EventQueue
+} min_heap_module_state;
+
+static int min_heap_module_exec(PyObject* m) {
+    min_heap_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyMinHeap_spec, PYDS_VECTORCALL(PyMinHeap_vectorcall));
+    if (!state->type) return -1;
+    state->object_type = pyds_add_type(m, &PyObjectMinHeap_spec, NULL);
+    if (!state->object_type) return -1;
+    state->min_max_type = pyds_add_type(m, &PyMinMaxHeap_spec, PYDS_VECTORCALL(PyMinMaxHeap_vectorcall));
+    if (!state->min_max_type) return -1;
+    state->external_type = pyds_add_type(m, &PyExternalMinHeap_spec, PYDS_VECTORCALL(PyExternalMinHeap_vectorcall));
+    if (!state->external_type) return -1;
+    state->event_queue_type = pyds_add_type(m, &PyEventQueue_spec, NULL);
+    if (!state->event_queue_type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int min_heap_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    min_heap_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->type);
+        Py_VISIT(state->object_type);
+        Py_VISIT(state->min_max_type);
+        Py_VISIT(state->external_type);
+        Py_VISIT(state->event_queue_type);
+    }
+    return 0;
+}
+
+static int min_heap_module_clear(PyObject* m) {
+    min_heap_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->type);
+        Py_CLEAR(state->object_type);
+        Py_CLEAR(state->min_max_type);
+        Py_CLEAR(state->external_type);
+        Py_CLEAR(state->event_queue_type);
+    }
+    return 0;
+}
+
+static void min_heap_module_free(void* m) {
+    min_heap_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot min_heap_module_slots[] = {
+    {Py_mod_exec, (void*)min_heap_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef min_heap_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "min_heap",
+    .m_doc = "This module exposes a high-performance, memory-efficient minimum heap "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(min_heap_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = min_heap_module_slots,
+    .m_traverse = min_heap_module_traverse,
+    .m_clear = min_heap_module_clear,
+    .m_free = min_heap_module_free,
+};
+
+PyMODINIT_FUNC PyInit_min_heap(void) {
+    return PyModuleDef_Init(&min_heap_module);
+}
@@ -3,20 +3,32 @@
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 #include "../src/monotonic_increasing_stack.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "objects.h"
+#include "serialize.h"
+#include "stats.h"
+#include "shared.h"
 
 typedef struct {
     PyObject_HEAD;
     monotonic_increasing_stack_t* stack;
+    Py_buffer view;  // Export of the shared region; view.obj is NULL for private stacks
+#ifdef PYDS_STATS
+    pyds_latency_t latency;
+#endif
 } PyMonotonicIncreasingStackObject;
 
 static void PyMonotonicIncreasingStack_dealloc(PyMonotonicIncreasingStackObject* self) {
     monotonic_increasing_stack_destroy(&(self->stack));
-    Py_TYPE(self)->tp_free((PyObject*)self);
+    if (self->view.obj) PyBuffer_Release(&self->view);
+    pyds_type_free((PyObject*)self);
 }
 
-static PyObject* PyMonotonicIncreasingStack_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+static PyObject* PyMonotonicIncreasingStack_alloc(PyTypeObject* type) {
     PyMonotonicIncreasingStackObject* self;
-    self = (PyMonotonicIncreasingStackObject*)type->tp_alloc(type, 0);
+    self = (PyMonotonicIncreasingStackObject*)PyType_GenericAlloc(type, 0);
     if (!self) return NULL;
 
     if (monotonic_increasing_stack_create(&(self->stack)) != MIS_SUCCESS) {
@@ -28,21 +40,86 @@ static PyObject* PyMonotonicIncreasingStack_new(PyTypeObject* type, PyObject* ar
     return (PyObject*)self;
 }
 
-static PyObject* PyMonotonicIncreasingStack_push(PyMonotonicIncreasingStackObject* self, PyObject* args) {
+static PyObject* PyMonotonicIncreasingStack_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+    return PyMonotonicIncreasingStack_alloc(type);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyMonotonicIncreasingStack_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (pyds_check_no_args((PyTypeObject*)type, PyVectorcall_NARGS(nargsf), kwnames ? PyTuple_GET_SIZE(kwnames) : 0) < 0) return NULL;
+    return PyMonotonicIncreasingStack_alloc((PyTypeObject*)type);
+}
+#endif
+
+static PyObject* PyMonotonicIncreasingStack_cls_attach(PyObject* cls, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"buffer", "create", NULL};
+    PyObject* buffer;
+    int create = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p", kwlist, &buffer, &create)) return NULL;
+
+    Py_buffer view;
+    if (pyds_shared_view(buffer, &view) < 0) return NULL;
+
+    monotonic_increasing_stack_t* stack = NULL;
+    mis_status_t status = monotonic_increasing_stack_attach(&stack, view.buf, (size_t)view.len, create);
+    if (status != MIS_SUCCESS) {
+        PyBuffer_Release(&view);
+        switch (status) {
+            case MIS_ERROR_UNSUPPORTED:
+                PyErr_SetString(PyExc_NotImplementedError, "Shared stacks are not supported by this build");
+                return NULL;
+            case MIS_ERROR_FORMAT:
+                return pyds_shared_error(SHARED_REGION_ERROR_FORMAT, "MonotonicIncreasingStack");
+            default:
+                return pyds_shared_error(SHARED_REGION_ERROR_TOO_SMALL, "MonotonicIncreasingStack");
+        }
+    }
+
+    PyMonotonicIncreasingStackObject* obj = PyObject_New(PyMonotonicIncreasingStackObject, (PyTypeObject*)cls);
+    if (!obj) {
+        monotonic_increasing_stack_destroy(&stack);
+        PyBuffer_Release(&view);
+        return PyErr_NoMemory();
+    }
+
+    obj->stack = stack;
+    obj->view = view;
+    PYDS_LATENCY_RESET(obj);
+    return (PyObject*)obj;
+}
+
+static PyObject* PyMonotonicIncreasingStack_push(PyMonotonicIncreasingStackObject* self, PyObject* arg) {
     int32_t value;
 
-    if (!PyArg_ParseTuple(args, "i", &value)) return NULL;
-    if (monotonic_increasing_stack_push(self->stack, value) != MIS_SUCCESS) {
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    mis_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, status = monotonic_increasing_stack_push(self->stack, value));
+    Py_END_CRITICAL_SECTION();
+
+    if (status == MIS_ERROR_MEMORY && self->view.obj) {
+        PyErr_SetString(PyExc_MemoryError, "shared MonotonicIncreasingStack is full");
+        return NULL;
+    }
+    if (status != MIS_SUCCESS) {
         PyErr_SetString(PyExc_RuntimeError, "Failed to push MonotonicIncreasingStack");
+        return NULL;
     }
 
     Py_RETURN_NONE;
 }
 
-static PyObject* PyMonotonicIncreasingStack_pop(PyMonotonicIncreasingStackObject* self) {
+static PyObject* PyMonotonicIncreasingStack_pop(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
     int32_t removed;
 
-    mis_status_t pop_status = monotonic_increasing_stack_pop(self->stack, &removed);
+    mis_status_t pop_status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, pop_status = monotonic_increasing_stack_pop(self->stack, &removed));
+    Py_END_CRITICAL_SECTION();
+
     if (pop_status == MIS_ERROR_EMPTY) {
         Py_RETURN_NONE;
 
@@ -54,10 +131,14 @@ static PyObject* PyMonotonicIncreasingStack_pop(PyMonotonicIncreasingStackObject
     return PyLong_FromLong(removed);
 }
 
-static PyObject* PyMonotonicIncreasingStack_top(PyMonotonicIncreasingStackObject* self) {
+static PyObject* PyMonotonicIncreasingStack_top(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
     int32_t top;
 
-    mis_status_t pop_status = monotonic_increasing_stack_top(self->stack, &top);
+    mis_status_t pop_status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    PYDS_TIMED(self, pop_status = monotonic_increasing_stack_top(self->stack, &top));
+    Py_END_CRITICAL_SECTION();
+
     if (pop_status == MIS_ERROR_EMPTY) {
         Py_RETURN_NONE;
 
@@ -69,62 +150,453 @@ static PyObject* PyMonotonicIncreasingStack_top(PyMonotonicIncreasingStackObject
     return PyLong_FromLong(top);
 }
 
-static Py_ssize_t PyMonotonicIncreasingStack_length(PyMonotonicIncreasingStackObject* self) {
+static int PyMonotonicIncreasingStack_extend(void* ctx, const int32_t* values, Py_ssize_t count) {
+    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)ctx;
+
+    for (Py_ssize_t i = 0; i < count; i++) {
+        if (monotonic_increasing_stack_push(stack, values[i]) != MIS_SUCCESS) {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to push MonotonicIncreasingStack");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Called inside the critical section of self
+static int PyMonotonicIncreasingStack_snapshot_locked(PyMonotonicIncreasingStackObject* self, pyds_array_cursor_t* cursor) {
+    // Hold a shared stack's lock so the size and the copy agree
+    monotonic_increasing_stack_lock(self->stack);
+
     uint32_t size = 0;
     if (monotonic_increasing_stack_size(self->stack, &size) != MIS_SUCCESS) {
+        monotonic_increasing_stack_unlock(self->stack);
+        PyErr_SetString(PyExc_RuntimeError, "Failed to get size for MonotonicIncreasingStack");
+        return -1;
+    }
+
+    int32_t* values = PyMem_Malloc((size ? size : 1) * sizeof(int32_t));
+    if (!values) {
+        monotonic_increasing_stack_unlock(self->stack);
+        PyErr_NoMemory();
+        return -1;
+    }
+    mis_status_t status = monotonic_increasing_stack_to_array(self->stack, values);
+    monotonic_increasing_stack_unlock(self->stack);
+    if (status != MIS_SUCCESS) {
+        PyMem_Free(values);
+        PyErr_SetString(PyExc_RuntimeError, "Failed to copy MonotonicIncreasingStack");
+        return -1;
+    }
+
+    cursor->values = values;
+    cursor->index = 0;
+    cursor->size = (Py_ssize_t)size;
+    return 0;
+}
+
+// Copies the stack bottom to top; the caller frees cursor->values with PyMem_Free
+static int PyMonotonicIncreasingStack_snapshot(PyMonotonicIncreasingStackObject* self, pyds_array_cursor_t* cursor) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyMonotonicIncreasingStack_snapshot_locked(self, cursor);
+    Py_END_CRITICAL_SECTION();
+
+    return status;
+}
+
+static PyObject* PyMonotonicIncreasingStack_to_list(PyMonotonicIncreasingStackObject* self, PyObject* args, PyObject* kwargs) {
+    int as_array;
+    if (pyds_parse_as_array(args, kwargs, &as_array) < 0) return NULL;
+
+    pyds_array_cursor_t cursor;
+    if (PyMonotonicIncreasingStack_snapshot(self, &cursor) < 0) return NULL;
+
+    PyObject* result = pyds_int32_result(cursor.size, pyds_array_fill, &cursor, as_array);
+    PyMem_Free((void*)cursor.values);
+    return result;
+}
+
+static PyObject* PyMonotonicIncreasingStack_tobytes(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    pyds_array_cursor_t cursor;
+    if (PyMonotonicIncreasingStack_snapshot(self, &cursor) < 0) return NULL;
+
+    PyObject* bytes = pyds_tobytes(cursor.size, pyds_array_fill, &cursor);
+    PyMem_Free((void*)cursor.values);
+    return bytes;
+}
+
+static PyObject* PyMonotonicIncreasingStack_cls_frombytes(PyObject* cls, PyObject* data) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_frombytes(data, PyMonotonicIncreasingStack_extend, ((PyMonotonicIncreasingStackObject*)obj)->stack) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static PyObject* PyMonotonicIncreasingStack_reduce(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* payload = PyMonotonicIncreasingStack_tobytes(self, NULL);
+    if (!payload) return NULL;
+
+    PyObject* result = pyds_reduce((PyObject*)self, payload);
+    Py_DECREF(payload);
+    return result;
+}
+
+static PyObject* PyMonotonicIncreasingStack_dump(PyMonotonicIncreasingStackObject* self, PyObject* fileobj) {
+    pyds_array_cursor_t cursor;
+    if (PyMonotonicIncreasingStack_snapshot(self, &cursor) < 0) return NULL;
+
+    int status = pyds_dump(fileobj, PYDS_CONTAINER_MONOTONIC_INCREASING_STACK, cursor.size,
+                           pyds_array_fill, &cursor);
+    PyMem_Free((void*)cursor.values);
+    if (status < 0) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyMonotonicIncreasingStack_cls_load(PyObject* cls, PyObject* fileobj) {
+    PyObject* obj = PyObject_CallObject(cls, NULL);
+    if (!obj) return NULL;
+
+    if (pyds_load(fileobj, PYDS_CONTAINER_MONOTONIC_INCREASING_STACK, PyMonotonicIncreasingStack_extend,
+                  ((PyMonotonicIncreasingStackObject*)obj)->stack) < 0) {
+        Py_DECREF(obj);
+        return NULL;
+    }
+    return obj;
+}
+
+static Py_ssize_t PyMonotonicIncreasingStack_length(PyMonotonicIncreasingStackObject* self) {
+    uint32_t size = 0;
+    mis_status_t status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = monotonic_increasing_stack_size(self->stack, &size);
+    Py_END_CRITICAL_SECTION();
+
+    if (status != MIS_SUCCESS) {
         PyErr_SetString(PyExc_RuntimeError, "Failed to get size for MonotonicIncreasingStack");
         return -1;
     }
     return (Py_ssize_t)size;
 }
 
+static PyObject* PyMonotonicIncreasingStack_sizeof(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    monotonic_increasing_stack_lock(self->stack);
+    usage = monotonic_increasing_stack_memory_usage(self->stack);
+    monotonic_increasing_stack_unlock(self->stack);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyMonotonicIncreasingStackObject) + usage);
+}
+
+static PyObject* PyMonotonicIncreasingStack_stats(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+    pyds_latency_t latency;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    monotonic_increasing_stack_lock(self->stack);
+    monotonic_increasing_stack_get_stats(self->stack, &stats);
+    monotonic_increasing_stack_unlock(self->stack);
+    latency = self->latency;
+    Py_END_CRITICAL_SECTION();
+
+    return pyds_stats_dict(&stats, &latency);
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
+static PyObject* PyMonotonicIncreasingStack_reset_stats(PyMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+#ifdef PYDS_STATS
+    Py_BEGIN_CRITICAL_SECTION(self);
+    monotonic_increasing_stack_lock(self->stack);
+    monotonic_increasing_stack_reset_stats(self->stack);
+    monotonic_increasing_stack_unlock(self->stack);
+    PYDS_LATENCY_RESET(self);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+#else
+    return pyds_stats_unavailable();
+#endif
+}
+
 static PyMethodDef PyMonotonicIncreasingStack_methods[] = {
-    {"push", (PyCFunction)PyMonotonicIncreasingStack_push, METH_VARARGS, "Add a value to the monotonic increasing stack."},
+    {"attach", (PyCFunction)(void(*)(void))PyMonotonicIncreasingStack_cls_attach, METH_VARARGS | METH_KEYWORDS | METH_CLASS, "Use a stack stored in a shared memory buffer, creating an empty one if create is true."},
+    {"push", (PyCFunction)PyMonotonicIncreasingStack_push, METH_O, "Add a value to the monotonic increasing stack."},
     {"pop", (PyCFunction)PyMonotonicIncreasingStack_pop, METH_NOARGS, "Remove a value from the monotonic increasing stack."},
-    {"top", (PyCFunction)PyMonotonicIncreasingStack_top, METH_VARARGS, "Get top a value from the monotonic increasing stack."},
+    {"top", (PyCFunction)PyMonotonicIncreasingStack_top, METH_NOARGS, "Get top a value from the monotonic increasing stack."},
+    {"to_list", (PyCFunction)(void(*)(void))PyMonotonicIncreasingStack_to_list, METH_VARARGS | METH_KEYWORDS, "Return the values, bottom to top, as a list, or as array('i') if as_array is true."},
+    {"tobytes", (PyCFunction)PyMonotonicIncreasingStack_tobytes, METH_NOARGS, "Return the values, bottom to top, as little-endian int32 bytes."},
+    {"frombytes", (PyCFunction)PyMonotonicIncreasingStack_cls_frombytes, METH_O | METH_CLASS, "Build a stack by pushing little-endian int32 bytes."},
+    {"dump", (PyCFunction)PyMonotonicIncreasingStack_dump, METH_O, "Write the stack to a binary file object."},
+    {"load", (PyCFunction)PyMonotonicIncreasingStack_cls_load, METH_O | METH_CLASS, "Read a stack written by dump() from a binary file object."},
+    {"__reduce__", (PyCFunction)PyMonotonicIncreasingStack_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyMonotonicIncreasingStack_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {"stats", (PyCFunction)PyMonotonicIncreasingStack_stats, METH_NOARGS, "Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build."},
+    {"reset_stats", (PyCFunction)PyMonotonicIncreasingStack_reset_stats, METH_NOARGS, "Zero the operation counters and latency histogram."},
     {NULL}
 };
 
-static PySequenceMethods PyMonotonicIncreasingStack_sequence_methods = {
-    .sq_length = (lenfunc)PyMonotonicIncreasingStack_length,
-    0, 0, 0, 0, 0, 0, 0, 0, 0
+static PyType_Slot PyMonotonicIncreasingStack_slots[] = {
+    {Py_tp_doc, (void*)"Monotonic Increasing Stack\n"
+        "\n"
+        "- attach(buffer, create: bool = False) - Use a stack stored in a shared memory buffer, creating an empty one if create is true.\n"
+        "- push(value: int) - Add a value to the monotonic increasing stack.\n"
+        "- pop() -> Optional[int] - Remove a value from the monotonic increasing stack.\n"
+        "- top() -> Optional[int] - Get top a value from the monotonic increasing stack.\n"
+        "- to_list(as_array: bool = False) -> list[int] | array - Return the values, bottom to top, as a list, or as array('i') if as_array is true.\n"
+        "- tobytes() -> bytes - Return the values, bottom to top, as little-endian int32 bytes.\n"
+        "- frombytes(data: bytes) -> MonotonicIncreasingStack - Build a stack by pushing little-endian int32 bytes.\n"
+        "- dump(file) - Write the stack to a binary file object.\n"
+        "- load(file) -> MonotonicIncreasingStack - Read a stack written by dump() from a binary file object.\n"
+        "- stats() -> dict - Return the operation counters and latency histogram of a PYDATASTRUCTS_STATS=1 build.\n"
+        "- reset_stats() - Zero the operation counters and latency histogram.\n"},
+    {Py_tp_methods, PyMonotonicIncreasingStack_methods},
+    {Py_tp_new, PyMonotonicIncreasingStack_new},
+    {Py_tp_dealloc, PyMonotonicIncreasingStack_dealloc},
+    {Py_sq_length, PyMonotonicIncreasingStack_length},
+    {0, NULL}
 };
 
-static PyTypeObject PyMonotonicIncreasingStackType = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    .tp_name = "monotonic_increasing_stack.MonotonicIncreasingStack",
-    .tp_basicsize = sizeof(PyMonotonicIncreasingStackObject),
-    .tp_itemsize = 0,
-    .tp_flags = Py_TPFLAGS_DEFAULT,
-    .tp_doc = "Monotonic Increasing Stack\n"
-    "\n"
-    "- push(value: int) - Add a value to the monotonic increasing stack.\n"
-    "- pop() -> Optional[int] - Remove a value from the monotonic increasing stack.\n"
-    "- top() -> Optional[int] - Get top a value from the monotonic increasing stack.\n",
-    .tp_methods = PyMonotonicIncreasingStack_methods,
-    .tp_new = PyMonotonicIncreasingStack_new,
-    .tp_dealloc = (destructor)PyMonotonicIncreasingStack_dealloc,
-    .tp_as_sequence = &PyMonotonicIncreasingStack_sequence_methods,
+static PyType_Spec PyMonotonicIncreasingStack_spec = {
+    .name = "pydatastructs.monotonic_increasing_stack.MonotonicIncreasingStack",
+    .basicsize = sizeof(PyMonotonicIncreasingStackObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyMonotonicIncreasingStack_slots,
+};
+
+typedef struct {
+    PyObject_HEAD;
+    pyds_object_array_t stack;
+} PyObjectMonotonicIncreasingStackObject;
+
+#define PY_OBJECT_MIS_NAME "ObjectMonotonicIncreasingStack"
+
+// Pops the items greater than value, then pushes it. Popped items are
+// released between comparisons, and code they run may change the stack, so
+// the top and the comparison kind are read again on every step.
+static int PyObjectMonotonicIncreasingStack_push_item(PyObjectMonotonicIncreasingStackObject* self, PyObject* value) {
+    pyds_kind_t value_kind = pyds_kind_of(value);
+    pyds_object_array_t* stack = &self->stack;
+
+    if (stack->busy) {
+        pyds_object_busy(PY_OBJECT_MIS_NAME);
+        return -1;
+    }
+    while (stack->size > 0) {
+        stack->busy = 1;
+        int less = pyds_object_less(pyds_kind_merge(stack->kind, value_kind), value, stack->items[stack->size - 1]);
+        stack->busy = 0;
+        if (less < 0) return -1;
+        if (!less) break;
+
+        PyObject* popped = pyds_object_array_pop(stack);
+        Py_DECREF(popped);
+    }
+    return pyds_object_array_push(stack, value);
+}
+
+static int PyObjectMonotonicIncreasingStack_add(void* ctx, PyObject* item) {
+    return PyObjectMonotonicIncreasingStack_push_item((PyObjectMonotonicIncreasingStackObject*)ctx, item);
+}
+
+static int PyObjectMonotonicIncreasingStack_traverse(PyObjectMonotonicIncreasingStackObject* self, visitproc visit, void* arg) {
+    PYDS_VISIT_TYPE(self);
+    return pyds_object_array_traverse(&self->stack, visit, arg);
+}
+
+static int PyObjectMonotonicIncreasingStack_clear(PyObjectMonotonicIncreasingStackObject* self) {
+    pyds_object_array_clear(&self->stack);
+    return 0;
+}
+
+static void PyObjectMonotonicIncreasingStack_dealloc(PyObjectMonotonicIncreasingStackObject* self) {
+    PyObject_GC_UnTrack(self);
+    PyObjectMonotonicIncreasingStack_clear(self);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    PyObject* iterable;
+    if (pyds_parse_iterable(args, kwargs, "|O:" PY_OBJECT_MIS_NAME, &iterable) < 0) return NULL;
+
+    PyObject* self = PyType_GenericAlloc(type, 0);
+    if (!self || !iterable) return self;
+
+    if (pyds_for_each(iterable, PyObjectMonotonicIncreasingStack_add, self) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return self;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_push(PyObjectMonotonicIncreasingStackObject* self, PyObject* value) {
+    int status;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    status = PyObjectMonotonicIncreasingStack_push_item(self, value);
+    Py_END_CRITICAL_SECTION();
+
+    if (status < 0) return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_pop(PyObjectMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* removed = NULL;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    if (self->stack.busy) {
+        pyds_object_busy(PY_OBJECT_MIS_NAME);
+    } else if (self->stack.size == 0) {
+        removed = Py_None;
+        Py_INCREF(removed);
+    } else {
+        removed = pyds_object_array_pop(&self->stack);
+    }
+    Py_END_CRITICAL_SECTION();
+
+    return removed;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_top(PyObjectMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* top;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    top = self->stack.size ? self->stack.items[self->stack.size - 1] : Py_None;
+    Py_INCREF(top);
+    Py_END_CRITICAL_SECTION();
+
+    return top;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_to_list(PyObjectMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* list;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    list = pyds_object_array_to_list(&self->stack);
+    Py_END_CRITICAL_SECTION();
+
+    return list;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_reduce(PyObjectMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    PyObject* items = PyObjectMonotonicIncreasingStack_to_list(self, NULL);
+    if (!items) return NULL;
+
+    return Py_BuildValue("(O(N))", (PyObject*)Py_TYPE((PyObject*)self), items);
+}
+
+static Py_ssize_t PyObjectMonotonicIncreasingStack_length(PyObjectMonotonicIncreasingStackObject* self) {
+    Py_ssize_t size;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    size = self->stack.size;
+    Py_END_CRITICAL_SECTION();
+
+    return size;
+}
+
+static PyObject* PyObjectMonotonicIncreasingStack_sizeof(PyObjectMonotonicIncreasingStackObject* self, PyObject* Py_UNUSED(ignored)) {
+    size_t usage;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    usage = pyds_object_array_memory_usage(&self->stack);
+    Py_END_CRITICAL_SECTION();
+
+    return PyLong_FromSize_t(sizeof(PyObjectMonotonicIncreasingStackObject) + usage);
+}
+
+static PyMethodDef PyObjectMonotonicIncreasingStack_methods[] = {
+    {"push", (PyCFunction)PyObjectMonotonicIncreasingStack_push, METH_O, "Pop every item greater than the new one, then push it."},
+    {"pop", (PyCFunction)PyObjectMonotonicIncreasingStack_pop, METH_NOARGS, "Remove the top item. Returns the item removed. If there is no item, return None."},
+    {"top", (PyCFunction)PyObjectMonotonicIncreasingStack_top, METH_NOARGS, "Peek the top item. If there is no item, return None."},
+    {"to_list", (PyCFunction)PyObjectMonotonicIncreasingStack_to_list, METH_NOARGS, "Return the items, bottom to top, as a list."},
+    {"__reduce__", (PyCFunction)PyObjectMonotonicIncreasingStack_reduce, METH_NOARGS, "Support for pickle."},
+    {"__sizeof__", (PyCFunction)PyObjectMonotonicIncreasingStack_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyObjectMonotonicIncreasingStack_slots[] = {
+    {Py_tp_doc, (void*)"Monotonic Increasing Stack of arbitrary objects, ordered with <\n"
+        "\n"
+        "- ObjectMonotonicIncreasingStack(iterable=()) - Build a stack by pushing the items of iterable.\n"
+        "- push(item) - Pop every item greater than the new one, then push it.\n"
+        "- pop() -> Optional[object] - Remove the top item. Returns the item removed.\n"
+        "- top() -> Optional[object] - Peek the top item.\n"
+        "- to_list() -> list - Return the items, bottom to top, as a list.\n"},
+    {Py_tp_methods, PyObjectMonotonicIncreasingStack_methods},
+    {Py_tp_new, PyObjectMonotonicIncreasingStack_new},
+    {Py_tp_dealloc, PyObjectMonotonicIncreasingStack_dealloc},
+    {Py_tp_traverse, PyObjectMonotonicIncreasingStack_traverse},
+    {Py_tp_clear, PyObjectMonotonicIncreasingStack_clear},
+    {Py_sq_length, PyObjectMonotonicIncreasingStack_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyObjectMonotonicIncreasingStack_spec = {
+    .name = "pydatastructs.monotonic_increasing_stack.ObjectMonotonicIncreasingStack",
+    .basicsize = sizeof(PyObjectMonotonicIncreasingStackObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_GC,
+    .slots = PyObjectMonotonicIncreasingStack_slots,
+};
+
+typedef struct {
+    PyObject* type;  // MonotonicIncreasingStack
+    PyObject* object_type;  // ObjectMonotonicIncreasingStack
+} monotonic_increasing_stack_module_state;
+
+static int monotonic_increasing_stack_module_exec(PyObject* m) {
+    monotonic_increasing_stack_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyMonotonicIncreasingStack_spec, PYDS_VECTORCALL(PyMonotonicIncreasingStack_vectorcall));
+    if (!state->type) return -1;
+    state->object_type = pyds_add_type(m, &PyObjectMonotonicIncreasingStack_spec, NULL);
+    if (!state->object_type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int monotonic_increasing_stack_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    monotonic_increasing_stack_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_VISIT(state->type);
+        Py_VISIT(state->object_type);
+    }
+    return 0;
+}
+
+static int monotonic_increasing_stack_module_clear(PyObject* m) {
+    monotonic_increasing_stack_module_state* state = PyModule_GetState(m);
+    if (state) {
+        Py_CLEAR(state->type);
+        Py_CLEAR(state->object_type);
+    }
+    return 0;
+}
+
+static void monotonic_increasing_stack_module_free(void* m) {
+    monotonic_increasing_stack_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot monotonic_increasing_stack_module_slots[] = {
+    {Py_mod_exec, (void*)monotonic_increasing_stack_module_exec},
+    PYDS_MODULE_SLOTS
 };
 
 static PyModuleDef monotonic_increasing_stack_module = {
     PyModuleDef_HEAD_INIT,
-    "monotonic_increasing_stack",
-    "This module exposes a high-performance, memory-efficient monotonic increasing stack "
+    .m_name = "monotonic_increasing_stack",
+    .m_doc = "This module exposes a high-performance, memory-efficient monotonic increasing stack "
     "implementation written in C to Python via the C API",
-    -1,
-    NULL, NULL, NULL, NULL, NULL
+    .m_size = sizeof(monotonic_increasing_stack_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = monotonic_increasing_stack_module_slots,
+    .m_traverse = monotonic_increasing_stack_module_traverse,
+    .m_clear = monotonic_increasing_stack_module_clear,
+    .m_free = monotonic_increasing_stack_module_free,
 };
 
 PyMODINIT_FUNC PyInit_monotonic_increasing_stack(void) {
-    PyObject* m;
-
-    if (PyType_Ready(&PyMonotonicIncreasingStackType) < 0) return NULL;
-
-    m = PyModule_Create(&monotonic_increasing_stack_module);
-    if (!m) return NULL;
-
-    Py_INCREF(&PyMonotonicIncreasingStackType);
-    PyModule_AddObject(m, "MonotonicIncreasingStack", (PyObject*)&PyMonotonicIncreasingStackType);
-    return m;
-}
\ No newline at end of file
+    return PyModuleDef_Init(&monotonic_increasing_stack_module);
+}
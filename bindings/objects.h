@@ -0,0 +1,303 @@
+// bindings/objects.h
+
+#ifndef PYDS_OBJECTS_H
+#define PYDS_OBJECTS_H
+
+/**
+ * @file objects.h
+ * @brief Element ordering and storage for the object-typed containers.
+ *
+ * ObjectDoublyLinkedList, ObjectLinkedList, ObjectMinHeap and
+ * ObjectMonotonicIncreasingStack hold strong references to any Python
+ * objects, take part in garbage collection, and order their items with <
+ * and == like heapq and list.remove.
+ *
+ * Like list.sort, each container watches the types that go in. While every
+ * item is an exact int that fits in a long long, an exact float or an exact
+ * str, comparisons run natively and never call PyObject_RichCompare. The
+ * first item of any other type, or of a second type, switches the container
+ * to rich comparisons until it is emptied.
+ *
+ * Rich comparisons run Python code, which may call back into the container.
+ * The containers set busy around them and refuse to change while it is set,
+ * and they only ever swap items, so the garbage collector always sees each
+ * reference exactly once.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+#include "../src/alloc.h"
+#include "compat.h"
+
+#define PYDS_OBJECT_INITIAL_CAPACITY 4
+
+/**
+ * @brief Types a container has held since it was last empty.
+ */
+typedef enum {
+    PYDS_KIND_EMPTY = 0,
+    PYDS_KIND_INT,     ///< Exact ints that fit in a long long
+    PYDS_KIND_FLOAT,   ///< Exact floats
+    PYDS_KIND_STR,     ///< Exact strs
+    PYDS_KIND_OBJECT,  ///< Anything else, or a mix: rich comparisons
+} pyds_kind_t;
+
+static inline pyds_kind_t pyds_kind_of(PyObject* obj) {
+    if (PyLong_CheckExact(obj)) {
+#if PY_VERSION_HEX >= 0x030C0000 && !defined(Py_LIMITED_API)
+        if (PyUnstable_Long_IsCompact((PyLongObject*)obj)) return PYDS_KIND_INT;
+#endif
+        int overflow;
+        PyLong_AsLongLongAndOverflow(obj, &overflow);
+        return overflow ? PYDS_KIND_OBJECT : PYDS_KIND_INT;
+    }
+    if (PyFloat_CheckExact(obj)) return PYDS_KIND_FLOAT;
+    if (PyUnicode_CheckExact(obj)) {
+#if PY_VERSION_HEX < 0x030C0000 && !defined(Py_LIMITED_API)
+        if (PyUnicode_READY(obj) < 0) {
+            PyErr_Clear();
+            return PYDS_KIND_OBJECT;
+        }
+#endif
+        return PYDS_KIND_STR;
+    }
+    return PYDS_KIND_OBJECT;
+}
+
+/**
+ * @brief Returns the kind of a container holding items of both kinds.
+ */
+static inline pyds_kind_t pyds_kind_merge(pyds_kind_t kind, pyds_kind_t other) {
+    if (kind == PYDS_KIND_EMPTY) return other;
+    if (other == PYDS_KIND_EMPTY) return kind;
+    return kind == other ? kind : PYDS_KIND_OBJECT;
+}
+
+/**
+ * @brief Returns the kind of a container holding items of kind plus obj.
+ */
+static inline pyds_kind_t pyds_kind_join(pyds_kind_t kind, PyObject* obj) {
+    if (kind == PYDS_KIND_OBJECT) return PYDS_KIND_OBJECT;
+    return pyds_kind_merge(kind, pyds_kind_of(obj));
+}
+
+static inline long long pyds_int_value(PyObject* obj) {
+#if PY_VERSION_HEX >= 0x030C0000 && !defined(Py_LIMITED_API)
+    if (PyUnstable_Long_IsCompact((PyLongObject*)obj)) return PyUnstable_Long_CompactValue((PyLongObject*)obj);
+#endif
+    return PyLong_AsLongLong(obj);
+}
+
+static inline double pyds_float_value(PyObject* obj) {
+#ifdef Py_LIMITED_API
+    return PyFloat_AsDouble(obj);
+#else
+    return PyFloat_AS_DOUBLE(obj);
+#endif
+}
+
+// Orders two exact strs by code point; Latin-1 strings are compared with
+// memcmp like list.sort does
+static inline int pyds_str_compare(PyObject* a, PyObject* b) {
+#ifndef Py_LIMITED_API
+    if (PyUnicode_KIND(a) == PyUnicode_1BYTE_KIND && PyUnicode_KIND(b) == PyUnicode_1BYTE_KIND) {
+        Py_ssize_t len_a = PyUnicode_GET_LENGTH(a);
+        Py_ssize_t len_b = PyUnicode_GET_LENGTH(b);
+        int result = memcmp(PyUnicode_DATA(a), PyUnicode_DATA(b), (size_t)Py_MIN(len_a, len_b));
+        return result ? result : (len_a > len_b) - (len_a < len_b);
+    }
+#endif
+    return PyUnicode_Compare(a, b);
+}
+
+/**
+ * @brief a < b for two items of a container of the given kind.
+ * @return 1 or 0, or -1 with an exception set.
+ */
+static inline int pyds_object_less(pyds_kind_t kind, PyObject* a, PyObject* b) {
+    switch (kind) {
+    case PYDS_KIND_INT:
+        return pyds_int_value(a) < pyds_int_value(b);
+    case PYDS_KIND_FLOAT:
+        return pyds_float_value(a) < pyds_float_value(b);
+    case PYDS_KIND_STR:
+        return pyds_str_compare(a, b) < 0;
+    default:
+        return PyObject_RichCompareBool(a, b, Py_LT);
+    }
+}
+
+/**
+ * @brief a == b, with the identity shortcut of PyObject_RichCompareBool.
+ * @return 1 or 0, or -1 with an exception set.
+ */
+static inline int pyds_object_equal(pyds_kind_t kind, PyObject* a, PyObject* b) {
+    if (a == b) return 1;
+
+    switch (kind) {
+    case PYDS_KIND_INT:
+        return pyds_int_value(a) == pyds_int_value(b);
+    case PYDS_KIND_FLOAT:
+        return pyds_float_value(a) == pyds_float_value(b);
+    case PYDS_KIND_STR:
+        return pyds_str_compare(a, b) == 0;
+    default:
+        return PyObject_RichCompareBool(a, b, Py_EQ);
+    }
+}
+
+/**
+ * @brief Sets the error raised when a comparison calls back into a container
+ * that is busy comparing.
+ * @return NULL.
+ */
+static inline PyObject* pyds_object_busy(const char* name) {
+    PyErr_Format(PyExc_RuntimeError, "%s modified during a comparison", name);
+    return NULL;
+}
+
+/**
+ * @brief Growable array of strong references, shared by ObjectMinHeap and
+ * ObjectMonotonicIncreasingStack.
+ */
+typedef struct {
+    PyObject** items;
+    Py_ssize_t size;
+    Py_ssize_t capacity;
+    pyds_kind_t kind;
+    int busy;  // Set while rich comparisons may run Python code
+} pyds_object_array_t;
+
+/**
+ * @brief Appends a new reference to obj.
+ * @return 0 on success, -1 with MemoryError set on failure.
+ */
+static inline int pyds_object_array_push(pyds_object_array_t* array, PyObject* obj) {
+    if (array->size == array->capacity) {
+        Py_ssize_t capacity = array->capacity ? array->capacity * 2 : PYDS_OBJECT_INITIAL_CAPACITY;
+        if ((size_t)capacity > PY_SSIZE_T_MAX / sizeof(PyObject*)) {
+            PyErr_NoMemory();
+            return -1;
+        }
+
+        PyObject** items = pyds_realloc(array->items, sizeof(PyObject*) * (size_t)capacity);
+        if (!items) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        array->items = items;
+        array->capacity = capacity;
+    }
+
+    Py_INCREF(obj);
+    array->items[array->size++] = obj;
+    array->kind = pyds_kind_join(array->kind, obj);
+    return 0;
+}
+
+/**
+ * @brief Removes the last item and returns the array's reference to it.
+ */
+static inline PyObject* pyds_object_array_pop(pyds_object_array_t* array) {
+    PyObject* obj = array->items[--array->size];
+    if (array->size == 0) array->kind = PYDS_KIND_EMPTY;
+    return obj;
+}
+
+/**
+ * @brief Empties the array and frees its storage. The items are released
+ * after the array is detached, so code they run on release sees it empty.
+ */
+static inline void pyds_object_array_clear(pyds_object_array_t* array) {
+    PyObject** items = array->items;
+    Py_ssize_t size = array->size;
+
+    array->items = NULL;
+    array->size = 0;
+    array->capacity = 0;
+    array->kind = PYDS_KIND_EMPTY;
+
+    for (Py_ssize_t i = 0; i < size; i++) {
+        Py_DECREF(items[i]);
+    }
+    pyds_free(items);
+}
+
+static inline int pyds_object_array_traverse(const pyds_object_array_t* array, visitproc visit, void* arg) {
+    for (Py_ssize_t i = 0; i < array->size; i++) {
+        Py_VISIT(array->items[i]);
+    }
+    return 0;
+}
+
+/**
+ * @brief Returns the items, first to last, as a new list.
+ */
+static inline PyObject* pyds_object_array_to_list(const pyds_object_array_t* array) {
+    PyObject* list = PyList_New(array->size);
+    if (!list) return NULL;
+
+    for (Py_ssize_t i = 0; i < array->size; i++) {
+        Py_INCREF(array->items[i]);
+        PYDS_LIST_SET_ITEM(list, i, array->items[i]);
+    }
+    return list;
+}
+
+// Bytes allocated for the references; the objects themselves are not counted
+static inline size_t pyds_object_array_memory_usage(const pyds_object_array_t* array) {
+    return sizeof(PyObject*) * (size_t)array->capacity;
+}
+
+/**
+ * @brief Parses the optional iterable argument of an object container's
+ * constructor.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_parse_iterable(PyObject* args, PyObject* kwds, const char* format, PyObject** iterable) {
+    static char* kwlist[] = {"iterable", NULL};
+
+    *iterable = NULL;
+    return PyArg_ParseTupleAndKeywords(args, kwds, format, kwlist, iterable) ? 0 : -1;
+}
+
+/**
+ * @brief Calls fn with each item of iterable.
+ * @return 0 on success, -1 with an exception set as soon as iteration or
+ * fn fails.
+ */
+static inline int pyds_for_each(PyObject* iterable, int (*fn)(void* ctx, PyObject* item), void* ctx) {
+    PyObject* iterator = PyObject_GetIter(iterable);
+    if (!iterator) return -1;
+
+    PyObject* item;
+    while ((item = PyIter_Next(iterator))) {
+        int status = fn(ctx, item);
+        Py_DECREF(item);
+        if (status < 0) {
+            Py_DECREF(iterator);
+            return -1;
+        }
+    }
+    Py_DECREF(iterator);
+    return PyErr_Occurred() ? -1 : 0;
+}
+
+/**
+ * @brief Visits the type of a heap type instance, which owns a reference to
+ * it from 3.9 on.
+ */
+#if PY_VERSION_HEX >= 0x03090000
+#define PYDS_VISIT_TYPE(self) Py_VISIT(Py_TYPE((PyObject*)(self)))
+#else
+#define PYDS_VISIT_TYPE(self) ((void)0)
+#endif
+
+#ifdef Py_TPFLAGS_IMMUTABLETYPE
+#define PYDS_TPFLAGS_GC (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_IMMUTABLETYPE | Py_TPFLAGS_HAVE_GC)
+#else
+#define PYDS_TPFLAGS_GC (Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC)
+#endif
+
+#endif // PYDS_OBJECTS_H
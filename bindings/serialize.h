@@ -0,0 +1,308 @@
+// bindings/serialize.h
+
+#ifndef PYDS_SERIALIZE_H
+#define PYDS_SERIALIZE_H
+
+/**
+ * @file serialize.h
+ * @brief Binary serialization shared by the bindings.
+ *
+ * Every container serializes as the sequence of its int32 values. tobytes()
+ * and pickles carry the bare little-endian payload; dump() prefixes it with
+ * a 16-byte header:
+ *
+ *     offset 0   "PYDS"       magic
+ *     offset 4   uint8        format version
+ *     offset 5   uint8        container tag (pyds_container_t)
+ *     offset 6   uint16 LE    element size, always 4
+ *     offset 8   uint64 LE    element count
+ *     offset 16  int32 LE[]   payload
+ *
+ * Payloads are produced and consumed in chunks so dump() and load() never
+ * hold more than one chunk outside the container. The linked lists are the
+ * exception: dump() calls back into Python between chunks, where another
+ * thread may free the node a cursor points at, so they dump a copy taken
+ * under the object's critical section.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/mapped_file.h"
+
+#define PYDS_STREAM_VERSION 1
+#define PYDS_STREAM_HEADER_SIZE 16
+#define PYDS_STREAM_CHUNK 65536  // elements per write/read call
+
+/**
+ * @brief Copies up to max values, in container order, into out.
+ * @return Number of values produced; 0 once the container is exhausted.
+ */
+typedef Py_ssize_t (*pyds_fill_fn)(void* ctx, int32_t* out, Py_ssize_t max);
+
+/**
+ * @brief Appends count values, in container order, to the container.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+typedef int (*pyds_extend_fn)(void* ctx, const int32_t* values, Py_ssize_t count);
+
+/**
+ * @brief Cursor over a plain copy of a container's values.
+ */
+typedef struct {
+    const int32_t* values;
+    Py_ssize_t index;
+    Py_ssize_t size;
+} pyds_array_cursor_t;
+
+static inline Py_ssize_t pyds_array_fill(void* ctx, int32_t* out, Py_ssize_t max) {
+    pyds_array_cursor_t* cursor = (pyds_array_cursor_t*)ctx;
+    Py_ssize_t n = Py_MIN(max, cursor->size - cursor->index);
+    memcpy(out, cursor->values + cursor->index, (size_t)n * sizeof(int32_t));
+    cursor->index += n;
+    return n;
+}
+
+static void pyds_store_le32(unsigned char* out, const int32_t* values, Py_ssize_t count) {
+#if PY_LITTLE_ENDIAN
+    memcpy(out, values, (size_t)count * sizeof(int32_t));
+#else
+    for (Py_ssize_t i = 0; i < count; i++) {
+        uint32_t v = (uint32_t)values[i];
+        out[4 * i] = (unsigned char)v;
+        out[4 * i + 1] = (unsigned char)(v >> 8);
+        out[4 * i + 2] = (unsigned char)(v >> 16);
+        out[4 * i + 3] = (unsigned char)(v >> 24);
+    }
+#endif
+}
+
+static void pyds_load_le32(int32_t* values, const unsigned char* in, Py_ssize_t count) {
+#if PY_LITTLE_ENDIAN
+    memcpy(values, in, (size_t)count * sizeof(int32_t));
+#else
+    for (Py_ssize_t i = 0; i < count; i++) {
+        values[i] = (int32_t)((uint32_t)in[4 * i] | ((uint32_t)in[4 * i + 1] << 8) |
+                              ((uint32_t)in[4 * i + 2] << 16) | ((uint32_t)in[4 * i + 3] << 24));
+    }
+#endif
+}
+
+/**
+ * @brief Builds the little-endian payload of a container as a bytes object.
+ */
+static inline PyObject* pyds_tobytes(Py_ssize_t count, pyds_fill_fn fill, void* ctx) {
+    PyObject* bytes = PyBytes_FromStringAndSize(NULL, count * (Py_ssize_t)sizeof(int32_t));
+    if (!bytes) return NULL;
+
+    unsigned char* out = (unsigned char*)PyBytes_AsString(bytes);
+    int32_t chunk[1024];
+    Py_ssize_t written = 0;
+    while (written < count) {
+        Py_ssize_t n = fill(ctx, chunk, Py_MIN(count - written, (Py_ssize_t)1024));
+        if (n <= 0) break;
+        pyds_store_le32(out + written * sizeof(int32_t), chunk, n);
+        written += n;
+    }
+
+    if (written != count) {
+        Py_DECREF(bytes);
+        PyErr_SetString(PyExc_RuntimeError, "container changed size during serialization");
+        return NULL;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Feeds a little-endian payload from any buffer object to extend.
+ */
+static inline int pyds_frombytes(PyObject* data, pyds_extend_fn extend, void* ctx) {
+    Py_buffer view;
+    if (PyObject_GetBuffer(data, &view, PyBUF_SIMPLE) < 0) return -1;
+
+    if (view.len % (Py_ssize_t)sizeof(int32_t) != 0) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError, "payload length must be a multiple of 4");
+        return -1;
+    }
+
+    const unsigned char* in = view.buf;
+    Py_ssize_t count = view.len / (Py_ssize_t)sizeof(int32_t);
+    int32_t chunk[1024];
+    for (Py_ssize_t done = 0; done < count;) {
+        Py_ssize_t n = Py_MIN(count - done, (Py_ssize_t)1024);
+        pyds_load_le32(chunk, in + done * sizeof(int32_t), n);
+        if (extend(ctx, chunk, n) < 0) {
+            PyBuffer_Release(&view);
+            return -1;
+        }
+        done += n;
+    }
+
+    PyBuffer_Release(&view);
+    return 0;
+}
+
+/**
+ * @brief Implements __reduce__ as (type(self).frombytes, (payload,)).
+ */
+static inline PyObject* pyds_reduce(PyObject* self, PyObject* payload) {
+    PyObject* constructor = PyObject_GetAttrString((PyObject*)Py_TYPE(self), "frombytes");
+    if (!constructor) return NULL;
+
+    return Py_BuildValue("(N(O))", constructor, payload);
+}
+
+/**
+ * @brief Writes the stream header and payload to fileobj.write in chunks.
+ */
+static inline int pyds_dump(PyObject* fileobj, pyds_container_t tag, Py_ssize_t count, pyds_fill_fn fill, void* ctx) {
+    PyObject* write = PyObject_GetAttrString(fileobj, "write");
+    if (!write) return -1;
+
+    unsigned char header[PYDS_STREAM_HEADER_SIZE] = {'P', 'Y', 'D', 'S', PYDS_STREAM_VERSION, (unsigned char)tag, 4, 0};
+    uint64_t n = (uint64_t)count;
+    for (int i = 0; i < 8; i++) header[8 + i] = (unsigned char)(n >> (8 * i));
+
+    PyObject* result = PyObject_CallFunction(write, "y#", (const char*)header, (Py_ssize_t)sizeof(header));
+    if (!result) goto error;
+    Py_DECREF(result);
+
+    int32_t* values = PyMem_Malloc(PYDS_STREAM_CHUNK * sizeof(int32_t));
+    if (!values) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    Py_ssize_t written = 0;
+    while (written < count) {
+        Py_ssize_t len = fill(ctx, values, Py_MIN(count - written, (Py_ssize_t)PYDS_STREAM_CHUNK));
+        if (len <= 0) break;
+
+        PyObject* chunk = PyBytes_FromStringAndSize(NULL, len * (Py_ssize_t)sizeof(int32_t));
+        if (!chunk) {
+            PyMem_Free(values);
+            goto error;
+        }
+        pyds_store_le32((unsigned char*)PyBytes_AsString(chunk), values, len);
+
+        result = PyObject_CallFunctionObjArgs(write, chunk, NULL);
+        Py_DECREF(chunk);
+        if (!result) {
+            PyMem_Free(values);
+            goto error;
+        }
+        Py_DECREF(result);
+        written += len;
+    }
+    PyMem_Free(values);
+
+    if (written != count) {
+        PyErr_SetString(PyExc_RuntimeError, "container changed size during serialization");
+        goto error;
+    }
+
+    Py_DECREF(write);
+    return 0;
+
+error:
+    Py_DECREF(write);
+    return -1;
+}
+
+/**
+ * @brief Reads exactly size bytes from fileobj.read, or fails with EOFError.
+ */
+static inline PyObject* pyds_read_exact(PyObject* read, Py_ssize_t size) {
+    PyObject* data = PyObject_CallFunction(read, "n", size);
+    if (!data) return NULL;
+    if (!PyBytes_Check(data)) {
+        Py_DECREF(data);
+        PyErr_SetString(PyExc_TypeError, "file must be opened in binary mode");
+        return NULL;
+    }
+
+    // Raw streams may return short reads; keep reading until the chunk is complete
+    while (PyBytes_Size(data) < size) {
+        PyObject* more = PyObject_CallFunction(read, "n", size - PyBytes_Size(data));
+        if (!more) {
+            Py_DECREF(data);
+            return NULL;
+        }
+        if (!PyBytes_Check(more) || PyBytes_Size(more) == 0) {
+            Py_DECREF(more);
+            Py_DECREF(data);
+            PyErr_SetString(PyExc_EOFError, "unexpected end of pydatastructs stream");
+            return NULL;
+        }
+        PyBytes_ConcatAndDel(&data, more);
+        if (!data) return NULL;
+    }
+    return data;
+}
+
+/**
+ * @brief Reads a stream written by pyds_dump and feeds its payload to extend.
+ */
+static inline int pyds_load(PyObject* fileobj, pyds_container_t tag, pyds_extend_fn extend, void* ctx) {
+    PyObject* read = PyObject_GetAttrString(fileobj, "read");
+    if (!read) return -1;
+
+    PyObject* header = pyds_read_exact(read, PYDS_STREAM_HEADER_SIZE);
+    if (!header) goto error;
+
+    const unsigned char* h = (const unsigned char*)PyBytes_AsString(header);
+    if (memcmp(h, "PYDS", 4) != 0 || h[6] != 4 || h[7] != 0) {
+        Py_DECREF(header);
+        PyErr_SetString(PyExc_ValueError, "not a pydatastructs stream");
+        goto error;
+    }
+    if (h[4] != PYDS_STREAM_VERSION) {
+        PyErr_Format(PyExc_ValueError, "unsupported pydatastructs stream version %d", (int)h[4]);
+        Py_DECREF(header);
+        goto error;
+    }
+    if (h[5] != (unsigned char)tag) {
+        Py_DECREF(header);
+        PyErr_SetString(PyExc_ValueError, "stream holds a different container type");
+        goto error;
+    }
+
+    uint64_t count = 0;
+    for (int i = 0; i < 8; i++) count |= (uint64_t)h[8 + i] << (8 * i);
+    Py_DECREF(header);
+
+    int32_t* values = PyMem_Malloc(PYDS_STREAM_CHUNK * sizeof(int32_t));
+    if (!values) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    for (uint64_t done = 0; done < count;) {
+        Py_ssize_t n = (Py_ssize_t)((count - done) < PYDS_STREAM_CHUNK ? (count - done) : PYDS_STREAM_CHUNK);
+        PyObject* chunk = pyds_read_exact(read, n * (Py_ssize_t)sizeof(int32_t));
+        if (!chunk) {
+            PyMem_Free(values);
+            goto error;
+        }
+        pyds_load_le32(values, (const unsigned char*)PyBytes_AsString(chunk), n);
+        Py_DECREF(chunk);
+
+        if (extend(ctx, values, n) < 0) {
+            PyMem_Free(values);
+            goto error;
+        }
+        done += (uint64_t)n;
+    }
+    PyMem_Free(values);
+
+    Py_DECREF(read);
+    return 0;
+
+error:
+    Py_DECREF(read);
+    return -1;
+}
+
+#endif // PYDS_SERIALIZE_H
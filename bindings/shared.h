@@ -0,0 +1,58 @@
+// bindings/shared.h
+
+#ifndef PYDS_SHARED_H
+#define PYDS_SHARED_H
+
+/**
+ * @file shared.h
+ * @brief Buffer handling for containers attached to shared memory.
+ *
+ * attach() keeps a writable buffer export of the region for the lifetime of
+ * the container, so the memory cannot be released underneath it (for a
+ * multiprocessing.shared_memory.SharedMemory, close() raises BufferError
+ * until the container is gone). Operations on a shared container hold the
+ * region lock only around C code; anything that can run Python code works
+ * on a copy taken under the lock.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include "../src/shared_region.h"
+
+#define PYDS_SHARED_ALIGNMENT 8
+
+/**
+ * @brief Exports a writable, contiguous, suitably aligned view of buffer.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static int pyds_shared_view(PyObject* buffer, Py_buffer* view) {
+    if (PyObject_GetBuffer(buffer, view, PyBUF_WRITABLE) < 0) return -1;
+
+    if ((uintptr_t)view->buf % PYDS_SHARED_ALIGNMENT != 0) {
+        PyBuffer_Release(view);
+        PyErr_Format(PyExc_ValueError, "shared buffer must be %d-byte aligned", PYDS_SHARED_ALIGNMENT);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Raises the exception matching a failed attach of a shared name.
+ */
+static PyObject* pyds_shared_error(shared_region_status_t status, const char* name) {
+    switch (status) {
+        case SHARED_REGION_ERROR_TOO_SMALL:
+            PyErr_Format(PyExc_ValueError, "buffer is too small for a shared %s", name);
+            break;
+        case SHARED_REGION_ERROR_FORMAT:
+            PyErr_Format(PyExc_ValueError, "buffer does not hold a shared %s", name);
+            break;
+        default:
+            PyErr_SetString(PyExc_OSError, "could not create the process-shared lock");
+            break;
+    }
+    return NULL;
+}
+
+#endif // PYDS_SHARED_H
@@ -0,0 +1,340 @@
+// bindings/sliding_median_py.c
+//
+// update() reads an int32 buffer in place and writes the results straight
+// into a float64 buffer, so a whole block of samples costs one call.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "../src/sliding_median.h"
+#include "boxing.h"
+#include "compat.h"
+#include "memory.h"
+#include "stats.h"
+
+typedef struct {
+    PyObject_HEAD;
+    sliding_median_t* median;
+} PySlidingMedianObject;
+
+static void PySlidingMedian_dealloc(PySlidingMedianObject* self) {
+    sliding_median_free(self->median);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PySlidingMedian_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"window", "quantile", NULL};
+    int window;
+    double quantile = 0.5;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i|d:SlidingMedian", kwlist, &window, &quantile)) return NULL;
+    if (window < 1) {
+        PyErr_SetString(PyExc_ValueError, "window must be at least 1");
+        return NULL;
+    }
+    if (!(quantile >= 0.0 && quantile <= 1.0)) {
+        PyErr_SetString(PyExc_ValueError, "quantile must be between 0 and 1");
+        return NULL;
+    }
+
+    sliding_median_t* median = sliding_median_create(window, quantile);
+    if (!median) return PyErr_NoMemory();
+
+    PySlidingMedianObject* self = (PySlidingMedianObject*)PyType_GenericAlloc(type, 0);
+    if (!self) {
+        sliding_median_free(median);
+        return NULL;
+    }
+    self->median = median;
+    return (PyObject*)self;
+}
+
+static PyObject* PySlidingMedian_push(PySlidingMedianObject* self, PyObject* arg) {
+    int32_t value;
+    double result;
+
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+
+    Py_BEGIN_CRITICAL_SECTION(self);
+    result = sliding_median_push(self->median, value);
+    Py_END_CRITICAL_SECTION();
+
+    return PyFloat_FromDouble(result);
+}
+
+/**
+ * @brief Gets a writable C-contiguous buffer of native float64 values, such
+ * as an array('d') or a numpy float64 array.
+ * @return 0 with view filled, or -1 with an exception set.
+ */
+static int PySlidingMedian_get_out(PyObject* obj, Py_buffer* view) {
+    if (PyObject_GetBuffer(obj, view, PyBUF_WRITABLE | PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) == 0) {
+        const char* format = view->format ? view->format : "B";
+        if (*format == '@' || *format == '=' || *format == (PY_LITTLE_ENDIAN ? '<' : '>')) format++;
+        if (view->itemsize == (Py_ssize_t)sizeof(double) && format[0] == 'd' && !format[1]) return 0;
+        PyBuffer_Release(view);
+    } else if (!PyErr_ExceptionMatches(PyExc_BufferError) && !PyErr_ExceptionMatches(PyExc_TypeError)) {
+        return -1;
+    }
+    PyErr_Clear();
+    PyErr_SetString(PyExc_TypeError, "out must be a writable C-contiguous float64 buffer");
+    return -1;
+}
+
+// An array('d') of count zeros, made by repeating a one-element array
+static PyObject* PySlidingMedian_new_array(Py_ssize_t count) {
+    PyObject* module = PyImport_ImportModule("array");
+    if (!module) return NULL;
+
+    PyObject* unit = PyObject_CallMethod(module, "array", "s(d)", "d", 0.0);
+    Py_DECREF(module);
+    if (!unit) return NULL;
+
+    PyObject* result = PySequence_Repeat(unit, count);
+    Py_DECREF(unit);
+    return result;
+}
+
+// Copies the int32 values of any iterable into a PyMem block for update()
+static int32_t* PySlidingMedian_collect(PyObject* iterable, Py_ssize_t* count) {
+    PyObject* iterator = PyObject_GetIter(iterable);
+    if (!iterator) return NULL;
+
+    Py_ssize_t size = 0, capacity = 16;
+    int32_t* values = PyMem_Malloc(sizeof(int32_t) * (size_t)capacity);
+    PyObject* item;
+    while (values && (item = PyIter_Next(iterator))) {
+        if (size == capacity) {
+            int32_t* grown = PyMem_Realloc(values, sizeof(int32_t) * (size_t)capacity * 2);
+            if (!grown) {
+                Py_DECREF(item);
+                PyMem_Free(values);
+                values = NULL;
+                PyErr_NoMemory();
+                break;
+            }
+            values = grown;
+            capacity *= 2;
+        }
+        int status = pyds_as_int32(item, &values[size]);
+        Py_DECREF(item);
+        if (status < 0) {
+            PyMem_Free(values);
+            values = NULL;
+            break;
+        }
+        size++;
+    }
+    Py_DECREF(iterator);
+
+    if (!values) {
+        if (!PyErr_Occurred()) PyErr_NoMemory();
+        return NULL;
+    }
+    if (PyErr_Occurred()) {
+        PyMem_Free(values);
+        return NULL;
+    }
+    *count = size;
+    return values;
+}
+
+// Runs the samples through the window into out, or into a new array('d') when out is NULL
+static PyObject* PySlidingMedian_write(PySlidingMedianObject* self, const int32_t* values, Py_ssize_t count,
+                                       PyObject* out) {
+    PyObject* array = NULL;
+    Py_buffer view;
+    if (!out) {
+        array = PySlidingMedian_new_array(count);
+        if (!array) return NULL;
+        if (PyObject_GetBuffer(array, &view, PyBUF_WRITABLE) < 0) {
+            Py_DECREF(array);
+            return NULL;
+        }
+    } else if (PySlidingMedian_get_out(out, &view) < 0) {
+        return NULL;
+    }
+
+    Py_ssize_t room = view.len / (Py_ssize_t)sizeof(double);
+    const char* in = (const char*)values;
+    const char* result = (const char*)view.buf;
+    if (room < count) {
+        PyErr_Format(PyExc_ValueError, "out holds %zd values, values %zd", room, count);
+    } else if (count > 0 && result < in + count * (Py_ssize_t)sizeof(int32_t) &&
+               in < result + count * (Py_ssize_t)sizeof(double)) {
+        PyErr_SetString(PyExc_ValueError, "out must not overlap values");
+    } else {
+        Py_BEGIN_CRITICAL_SECTION(self);
+        sliding_median_update(self->median, values, (double*)view.buf, (size_t)count);
+        Py_END_CRITICAL_SECTION();
+
+        PyBuffer_Release(&view);
+        return array ? array : PyLong_FromSsize_t(count);
+    }
+
+    PyBuffer_Release(&view);
+    Py_XDECREF(array);
+    return NULL;
+}
+
+static PyObject* PySlidingMedian_update(PySlidingMedianObject* self, PyObject* args, PyObject* kwargs) {
+    static char* kwlist[] = {"values", "out", NULL};
+    PyObject* values;
+    PyObject* out = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:update", kwlist, &values, &out)) return NULL;
+    if (out == Py_None) out = NULL;
+
+    // Samples from an int32 buffer in place, or copied from any other iterable
+    Py_buffer input;
+    int status = pyds_get_int32_buffer(values, &input);
+    if (status < 0) return NULL;
+    if (status > 0) {
+        PyObject* result = PySlidingMedian_write(self, (const int32_t*)input.buf,
+                                                 input.len / (Py_ssize_t)sizeof(int32_t), out);
+        PyBuffer_Release(&input);
+        return result;
+    }
+
+    Py_ssize_t count;
+    int32_t* collected = PySlidingMedian_collect(values, &count);
+    if (!collected) return NULL;
+    PyObject* result = PySlidingMedian_write(self, collected, count, out);
+    PyMem_Free(collected);
+    return result;
+}
+
+static PyObject* PySlidingMedian_clear(PySlidingMedianObject* self, PyObject* Py_UNUSED(ignored)) {
+    Py_BEGIN_CRITICAL_SECTION(self);
+    sliding_median_clear(self->median);
+    Py_END_CRITICAL_SECTION();
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PySlidingMedian_get_value(PySlidingMedianObject* self, void* Py_UNUSED(closure)) {
+    double value;
+    char found;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    found = sliding_median_value(self->median, &value);
+    Py_END_CRITICAL_SECTION();
+
+    if (!found) Py_RETURN_NONE;
+    return PyFloat_FromDouble(value);
+}
+
+static PyObject* PySlidingMedian_get_window(PySlidingMedianObject* self, void* Py_UNUSED(closure)) {
+    return PyLong_FromLong(self->median->window);
+}
+
+static PyObject* PySlidingMedian_get_quantile(PySlidingMedianObject* self, void* Py_UNUSED(closure)) {
+    return PyFloat_FromDouble(self->median->quantile);
+}
+
+static Py_ssize_t PySlidingMedian_length(PySlidingMedianObject* self) {
+    int count;
+    Py_BEGIN_CRITICAL_SECTION(self);
+    count = self->median->count;
+    Py_END_CRITICAL_SECTION();
+
+    return (Py_ssize_t)count;
+}
+
+static PyObject* PySlidingMedian_sizeof(PySlidingMedianObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSize_t(sizeof(PySlidingMedianObject) + sliding_median_memory_usage(self->median));
+}
+
+static PyGetSetDef PySlidingMedian_getset[] = {
+    {"value", (getter)PySlidingMedian_get_value, NULL, "The quantile of the samples in the window, or None if it is empty.", NULL},
+    {"window", (getter)PySlidingMedian_get_window, NULL, "Most samples kept.", NULL},
+    {"quantile", (getter)PySlidingMedian_get_quantile, NULL, "Quantile reported, 0.5 for the median.", NULL},
+    {NULL}
+};
+
+static PyMethodDef PySlidingMedian_methods[] = {
+    {"push", (PyCFunction)PySlidingMedian_push, METH_O, "Add a sample and return the quantile of the window."},
+    {"update", (PyCFunction)(void(*)(void))PySlidingMedian_update, METH_VARARGS | METH_KEYWORDS,
+     "Add every sample of values and return the quantile after each one as array('d'), or write them to out and return their number."},
+    {"clear", (PyCFunction)PySlidingMedian_clear, METH_NOARGS, "Remove every sample."},
+    {"__sizeof__", (PyCFunction)PySlidingMedian_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PySlidingMedian_slots[] = {
+    {Py_tp_doc, (void*)"Sliding Median\n"
+        "\n"
+        "SlidingMedian(window, quantile=0.5) reports a quantile of the last window int32 samples, interpolated "
+        "linearly between neighbouring ranks, so the median of an even window is the mean of its two middle "
+        "samples. Results before the window fills cover the samples seen so far.\n"
+        "\n"
+        "- push(value: int) -> float - Add a sample and return the quantile of the window.\n"
+        "- update(values, out=None) -> array | int - Add every sample of values, an int32 buffer or any iterable, and return "
+        "the quantile after each one as array('d'), or write them to out, a float64 buffer, and return their number.\n"
+        "- clear() - Remove every sample.\n"
+        "- value -> Optional[float] - The quantile of the samples in the window.\n"
+        "- window -> int - Most samples kept.\n"
+        "- quantile -> float - Quantile reported.\n"},
+    {Py_tp_methods, PySlidingMedian_methods},
+    {Py_tp_getset, PySlidingMedian_getset},
+    {Py_tp_new, PySlidingMedian_new},
+    {Py_tp_dealloc, PySlidingMedian_dealloc},
+    {Py_sq_length, PySlidingMedian_length},
+    {0, NULL}
+};
+
+static PyType_Spec PySlidingMedian_spec = {
+    .name = "pydatastructs.sliding_median.SlidingMedian",
+    .basicsize = sizeof(PySlidingMedianObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PySlidingMedian_slots,
+};
+
+typedef struct {
+    PyObject* type;  // SlidingMedian
+} sliding_median_module_state;
+
+static int sliding_median_module_exec(PyObject* m) {
+    sliding_median_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PySlidingMedian_spec, NULL);
+    if (!state->type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int sliding_median_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    sliding_median_module_state* state = PyModule_GetState(m);
+    if (state) Py_VISIT(state->type);
+    return 0;
+}
+
+static int sliding_median_module_clear(PyObject* m) {
+    sliding_median_module_state* state = PyModule_GetState(m);
+    if (state) Py_CLEAR(state->type);
+    return 0;
+}
+
+static void sliding_median_module_free(void* m) {
+    sliding_median_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot sliding_median_module_slots[] = {
+    {Py_mod_exec, (void*)sliding_median_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef sliding_median_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "sliding_median",
+    .m_doc = "This module exposes a sliding-window median and quantile "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(sliding_median_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = sliding_median_module_slots,
+    .m_traverse = sliding_median_module_traverse,
+    .m_clear = sliding_median_module_clear,
+    .m_free = sliding_median_module_free,
+};
+
+PyMODINIT_FUNC PyInit_sliding_median(void) {
+    return PyModuleDef_Init(&sliding_median_module);
+}
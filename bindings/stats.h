@@ -0,0 +1,161 @@
+// bindings/stats.h
+
+#ifndef PYDS_BINDING_STATS_H
+#define PYDS_BINDING_STATS_H
+
+/**
+ * @file stats.h
+ * @brief stats() and reset_stats() support shared by the container types.
+ *
+ * In a PYDATASTRUCTS_STATS=1 build (PYDS_STATS) every container object
+ * holds a pyds_latency_t next to its C structure. PYDS_TIMED() times the
+ * core call of a hot method and adds it to that histogram. stats() merges
+ * the histogram with the structure's counters into a dict. In the default
+ * build PYDS_TIMED() is just the statement, and stats() raises
+ * RuntimeError.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <string.h>
+#include "../src/stats.h"
+
+#ifdef PYDS_STATS
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/**
+ * @brief Log2 histogram of call latencies in nanoseconds.
+ */
+typedef struct {
+    uint64_t buckets[PYDS_STATS_BUCKETS];
+} pyds_latency_t;
+
+static inline uint64_t pyds_now_ns(void) {
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+#define PYDS_LATENCY_RESET(obj) memset(&(obj)->latency, 0, sizeof(pyds_latency_t))
+
+// Runs the statement and records how long it took in obj->latency
+#define PYDS_TIMED(obj, ...) do { \
+        uint64_t pyds_start_ = pyds_now_ns(); \
+        __VA_ARGS__; \
+        (obj)->latency.buckets[pyds_stats_bucket(pyds_now_ns() - pyds_start_)]++; \
+    } while (0)
+
+/**
+ * @brief Adds the non-empty buckets of a histogram to dict under key, as
+ * {lower bound: count}.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_stats_add_histogram(PyObject* dict, const char* key, const uint64_t* buckets) {
+    PyObject* histogram = PyDict_New();
+    if (!histogram) return -1;
+
+    for (int i = 0; i < PYDS_STATS_BUCKETS; i++) {
+        if (!buckets[i]) continue;
+
+        PyObject* bound = PyLong_FromUnsignedLongLong(i == 0 ? 0 : 1ull << (i - 1));
+        PyObject* count = PyLong_FromUnsignedLongLong(buckets[i]);
+        int status = bound && count ? PyDict_SetItem(histogram, bound, count) : -1;
+        Py_XDECREF(bound);
+        Py_XDECREF(count);
+        if (status < 0) {
+            Py_DECREF(histogram);
+            return -1;
+        }
+    }
+
+    int status = PyDict_SetItemString(dict, key, histogram);
+    Py_DECREF(histogram);
+    return status;
+}
+
+/**
+ * @brief Builds the dict returned by stats().
+ * @return New reference, or NULL with an exception set.
+ */
+static inline PyObject* pyds_stats_dict(const pyds_stats_t* stats, const pyds_latency_t* latency) {
+    const struct {
+        const char* key;
+        uint64_t value;
+    } counters[] = {
+        {"ops", stats->ops},
+        {"comparisons", stats->comparisons},
+        {"moves", stats->moves},
+        {"steps", stats->steps},
+        {"reallocs", stats->reallocs},
+        {"allocations", stats->allocations},
+        {"bytes_allocated", stats->bytes_allocated},
+        {"high_water", stats->high_water},
+    };
+
+    PyObject* dict = PyDict_New();
+    if (!dict) return NULL;
+
+    for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); i++) {
+        PyObject* value = PyLong_FromUnsignedLongLong(counters[i].value);
+        int status = value ? PyDict_SetItemString(dict, counters[i].key, value) : -1;
+        Py_XDECREF(value);
+        if (status < 0) {
+            Py_DECREF(dict);
+            return NULL;
+        }
+    }
+
+    if (pyds_stats_add_histogram(dict, "cascade", stats->cascade) < 0 ||
+        pyds_stats_add_histogram(dict, "latency_ns", latency->buckets) < 0) {
+        Py_DECREF(dict);
+        return NULL;
+    }
+    return dict;
+}
+
+#else
+
+#define PYDS_LATENCY_RESET(obj) ((void)0)
+#define PYDS_TIMED(obj, ...) do { __VA_ARGS__; } while (0)
+
+#endif // PYDS_STATS
+
+/**
+ * @brief Sets the error stats() and reset_stats() raise in builds without
+ * PYDS_STATS.
+ * @return NULL.
+ */
+static inline PyObject* pyds_stats_unavailable(void) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "stats are not compiled in; rebuild with PYDATASTRUCTS_STATS=1");
+    return NULL;
+}
+
+/**
+ * @brief Adds the STATS_ENABLED flag to a module.
+ * @return 0 on success, -1 with an exception set on failure.
+ */
+static inline int pyds_add_stats_flag(PyObject* module) {
+    PyObject* enabled = PYDS_STATS_ENABLED ? Py_True : Py_False;
+    Py_INCREF(enabled);
+    if (PyModule_AddObject(module, "STATS_ENABLED", enabled) < 0) {
+        Py_DECREF(enabled);
+        return -1;
+    }
+    return 0;
+}
+
+#endif // PYDS_BINDING_STATS_H
@@ -0,0 +1,183 @@
+// bindings/ws_deque_py.c
+//
+// The deque synchronizes itself, so unlike the other containers its methods
+// take no critical section: push() and pop() check that they run on the
+// owner thread and steal() may run on any thread at the same time.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <pythread.h>
+#include "../src/ws_deque.h"
+#include "compat.h"
+#include "memory.h"
+#include "stats.h"
+
+typedef struct {
+    PyObject_HEAD;
+    ws_deque_t* deque;
+    unsigned long owner;  // PyThread_get_thread_ident() of the thread that created it
+} PyWSDequeObject;
+
+static void PyWSDeque_dealloc(PyWSDequeObject* self) {
+    ws_deque_destroy(self->deque);
+    pyds_type_free((PyObject*)self);
+}
+
+static PyObject* PyWSDeque_alloc(PyTypeObject* type) {
+    PyWSDequeObject* self;
+    self = (PyWSDequeObject*)PyType_GenericAlloc(type, 0);
+    if (!self) return NULL;
+
+    self->deque = ws_deque_create(0);
+    if (!self->deque) {
+        Py_DECREF(self);
+        return PyErr_NoMemory();
+    }
+    self->owner = PyThread_get_thread_ident();
+
+    return (PyObject*)self;
+}
+
+static PyObject* PyWSDeque_new(PyTypeObject* type, PyObject* args, PyObject* kwargs) {
+    if (pyds_check_no_args(type, PyTuple_Size(args), kwargs ? PyDict_Size(kwargs) : 0) < 0) return NULL;
+    return PyWSDeque_alloc(type);
+}
+
+#ifdef PYDS_HAVE_TYPE_VECTORCALL
+static PyObject* PyWSDeque_vectorcall(PyObject* type, PyObject* const* args, size_t nargsf, PyObject* kwnames) {
+    if (pyds_check_no_args((PyTypeObject*)type, PyVectorcall_NARGS(nargsf), kwnames ? PyTuple_GET_SIZE(kwnames) : 0) < 0) return NULL;
+    return PyWSDeque_alloc((PyTypeObject*)type);
+}
+#endif
+
+static inline int PyWSDeque_check_owner(PyWSDequeObject* self, const char* method) {
+    if (PyThread_get_thread_ident() == self->owner) return 0;
+
+    PyErr_Format(PyExc_RuntimeError, "%s() must be called from the thread that created the WorkStealingDeque",
+                 method);
+    return -1;
+}
+
+static PyObject* PyWSDeque_push(PyWSDequeObject* self, PyObject* arg) {
+    int32_t value;
+
+    if (PyWSDeque_check_owner(self, "push") < 0) return NULL;
+    if (pyds_as_int32(arg, &value) < 0) return NULL;
+    if (ws_deque_push(self->deque, value) != WS_DEQUE_OK) return PyErr_NoMemory();
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* PyWSDeque_pop(PyWSDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    int32_t value;
+
+    if (PyWSDeque_check_owner(self, "pop") < 0) return NULL;
+    if (ws_deque_pop(self->deque, &value) != WS_DEQUE_OK) Py_RETURN_NONE;
+
+    return PyLong_FromLong(value);
+}
+
+static PyObject* PyWSDeque_steal(PyWSDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    int32_t value;
+    ws_deque_status_t status;
+
+    // An abort means another thread took the top value, and there may be more
+    do {
+        status = ws_deque_steal(self->deque, &value);
+    } while (status == WS_DEQUE_ABORT);
+    if (status != WS_DEQUE_OK) Py_RETURN_NONE;
+
+    return PyLong_FromLong(value);
+}
+
+static Py_ssize_t PyWSDeque_length(PyWSDequeObject* self) {
+    return (Py_ssize_t)ws_deque_size(self->deque);
+}
+
+static PyObject* PyWSDeque_sizeof(PyWSDequeObject* self, PyObject* Py_UNUSED(ignored)) {
+    return PyLong_FromSize_t(sizeof(PyWSDequeObject) + ws_deque_memory_usage(self->deque));
+}
+
+static PyMethodDef PyWSDeque_methods[] = {
+    {"push", (PyCFunction)PyWSDeque_push, METH_O, "Add a value at the bottom. Owner thread only."},
+    {"pop", (PyCFunction)PyWSDeque_pop, METH_NOARGS, "Remove the value pushed last. Owner thread only. If there is no element, return None."},
+    {"steal", (PyCFunction)PyWSDeque_steal, METH_NOARGS, "Remove the oldest value. Any thread. If there is no element, return None."},
+    {"__sizeof__", (PyCFunction)PyWSDeque_sizeof, METH_NOARGS, "Return the size of the object and its native memory in bytes."},
+    {NULL}
+};
+
+static PyType_Slot PyWSDeque_slots[] = {
+    {Py_tp_doc, (void*)"Work-Stealing Deque\n"
+        "\n"
+        "Chase-Lev deque of int32 values, such as indices into a task table. The thread that\n"
+        "creates it owns the bottom end; any thread may steal from the top. None of the methods\n"
+        "take a lock.\n"
+        "\n"
+        "- push(value: int) - Add a value at the bottom. Owner thread only.\n"
+        "- pop() -> Optional[int] - Remove the value pushed last. Owner thread only.\n"
+        "- steal() -> Optional[int] - Remove the oldest value. Any thread.\n"
+        "- len(deque) -> int - Get number of items; a snapshot while other threads steal.\n"},
+    {Py_tp_methods, PyWSDeque_methods},
+    {Py_tp_new, PyWSDeque_new},
+    {Py_tp_dealloc, PyWSDeque_dealloc},
+    {Py_sq_length, PyWSDeque_length},
+    {0, NULL}
+};
+
+static PyType_Spec PyWSDeque_spec = {
+    .name = "pydatastructs.ws_deque.WorkStealingDeque",
+    .basicsize = sizeof(PyWSDequeObject),
+    .itemsize = 0,
+    .flags = PYDS_TPFLAGS_DEFAULT,
+    .slots = PyWSDeque_slots,
+};
+
+typedef struct {
+    PyObject* type;  // WorkStealingDeque
+} ws_deque_module_state;
+
+static int ws_deque_module_exec(PyObject* m) {
+    ws_deque_module_state* state = PyModule_GetState(m);
+    state->type = pyds_add_type(m, &PyWSDeque_spec, PYDS_VECTORCALL(PyWSDeque_vectorcall));
+    if (!state->type) return -1;
+    if (pyds_add_stats_flag(m) < 0) return -1;
+    return pyds_memory_init(m);
+}
+
+static int ws_deque_module_traverse(PyObject* m, visitproc visit, void* arg) {
+    ws_deque_module_state* state = PyModule_GetState(m);
+    if (state) Py_VISIT(state->type);
+    return 0;
+}
+
+static int ws_deque_module_clear(PyObject* m) {
+    ws_deque_module_state* state = PyModule_GetState(m);
+    if (state) Py_CLEAR(state->type);
+    return 0;
+}
+
+static void ws_deque_module_free(void* m) {
+    ws_deque_module_clear((PyObject*)m);
+}
+
+static PyModuleDef_Slot ws_deque_module_slots[] = {
+    {Py_mod_exec, (void*)ws_deque_module_exec},
+    PYDS_MODULE_SLOTS
+};
+
+static PyModuleDef ws_deque_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "ws_deque",
+    .m_doc = "This module exposes a lock-free Chase-Lev work-stealing deque "
+    "implementation written in C to Python via the C API",
+    .m_size = sizeof(ws_deque_module_state),
+    .m_methods = pyds_memory_methods,
+    .m_slots = ws_deque_module_slots,
+    .m_traverse = ws_deque_module_traverse,
+    .m_clear = ws_deque_module_clear,
+    .m_free = ws_deque_module_free,
+};
+
+PyMODINIT_FUNC PyInit_ws_deque(void) {
+    return PyModuleDef_Init(&ws_deque_module);
+}
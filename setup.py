@@ -1,36 +1,254 @@
+import glob
+import os
+import subprocess
+import sys
 from setuptools import setup, Extension, find_packages
+from setuptools.command.build_clib import build_clib
+from setuptools.command.build_ext import build_ext
+
+# PYDATASTRUCTS_SEGMENTED_ARRAY=1 builds dynamic_array_t as power-of-two
+# segments (no-copy growth, stable element addresses) instead of one buffer.
+dynamic_array_macros = []
+if os.environ.get('PYDATASTRUCTS_SEGMENTED_ARRAY') == '1':
+    dynamic_array_macros.append(('DYNAMIC_ARRAY_SEGMENTED', None))
+
+# PYDATASTRUCTS_STATS=1 compiles in the operation counters and latency
+# histograms behind stats(). The counters change struct layouts, so the core
+# library and every extension must agree on it.
+stats_macros = [('PYDS_STATS', None)] if os.environ.get('PYDATASTRUCTS_STATS') == '1' else []
+
+# PYDATASTRUCTS_LIMITED_API=1 builds against the stable ABI (abi3), so one
+# wheel works on CPython 3.11 and every later version. A version such as
+# PYDATASTRUCTS_LIMITED_API=3.12 raises that floor; 3.12 is the first stable
+# ABI that can declare support for per-interpreter GILs (PEP 684).
+limited_api_env = os.environ.get('PYDATASTRUCTS_LIMITED_API', '')
+limited_api = limited_api_env != ''
+limited_api_version = (3, 11) if limited_api_env in ('', '1') else tuple(int(p) for p in limited_api_env.split('.'))
+if limited_api and limited_api_version < (3, 11):
+    raise SystemExit('PYDATASTRUCTS_LIMITED_API needs Python 3.11 or later')
+limited_api_macros = [('Py_LIMITED_API', '0x%02X%02X0000' % limited_api_version)] if limited_api else []
+limited_api_tag = 'cp%d%d' % limited_api_version
+
+# PYDATASTRUCTS_PROFILE picks the optimization flags for GCC and Clang:
+#   default  the interpreter's own flags
+#   release  -O3
+#   lto      -O3 with link-time optimization, so the bindings' small wrappers
+#            inline into the C core
+# PYDATASTRUCTS_NATIVE=1 adds -march=native; the result only runs on CPUs
+# like the build machine. PYDATASTRUCTS_PGO=1 builds instrumented modules,
+# runs benchmarks/bench_calls.py as the training workload and rebuilds with
+# the collected profile (GCC only).
+PROFILES = {
+    'default': ([], []),
+    'release': (['-O3'], []),
+    'lto': (['-O3', '-flto', '-ffat-lto-objects', '-fvisibility=hidden'], ['-O3', '-flto']),
+}
+build_profile = os.environ.get('PYDATASTRUCTS_PROFILE', 'default')
+if build_profile not in PROFILES:
+    raise SystemExit('PYDATASTRUCTS_PROFILE must be one of: ' + ', '.join(PROFILES))
+native = os.environ.get('PYDATASTRUCTS_NATIVE') == '1'
+pgo = os.environ.get('PYDATASTRUCTS_PGO') == '1'
+pgo_flags = []  # set per stage by build_ext.run_pgo
+
+
+def profile_flags(compiler_type):
+    """Returns (compile, link) flags for the selected profile."""
+    if compiler_type == 'msvc':
+        return [], []
+    compile_args, link_args = PROFILES[build_profile]
+    compile_args = compile_args + (['-march=native'] if native else []) + pgo_flags
+    link_args = link_args + pgo_flags
+    return compile_args, link_args
+
+
+class build_core(build_clib):
+    def build_libraries(self, libraries):
+        cflags, _ = profile_flags(self.compiler.compiler_type)
+        for name, info in libraries:
+            # build_clib only compiles out-of-date objects and ignores --force
+            if self.force:
+                for obj in self.compiler.object_filenames(info['sources'], output_dir=self.build_temp):
+                    if os.path.exists(obj):
+                        os.remove(obj)
+            super().build_libraries([(name, dict(info, cflags=info.get('cflags', []) + cflags))])
+
+
+class build_profiled_ext(build_ext):
+    def run(self):
+        # Keep the core library next to the extension objects when build_ext
+        # runs on its own with --build-temp
+        clib = self.distribution.get_command_obj('build_clib')
+        if clib.build_clib is None:
+            clib.build_clib = clib.build_temp = os.path.join(self.build_temp, 'core')
+
+        if pgo:
+            self.run_pgo(clib)
+        else:
+            self.run_command('build_clib')
+            super().run()
+
+    def build_extension(self, ext):
+        compile_args, link_args = profile_flags(self.compiler.compiler_type)
+        ext.extra_compile_args = compile_args
+        ext.extra_link_args = link_args
+        # Relink when the core library changes
+        clib = self.get_finalized_command('build_clib')
+        core = os.path.join(clib.build_clib, self.compiler.library_filename(core_lib[0]))
+        if core not in ext.depends:
+            ext.depends = ext.depends + [core]
+        super().build_extension(ext)
+
+    def run_pgo(self, clib):
+        global pgo_flags
+        # Both stages compile to the same object paths, which is how GCC
+        # matches the profile data to each translation unit.
+        profile_dir = os.path.abspath(os.path.join(self.build_temp, 'pgo-profile'))
+        train_lib = os.path.abspath(os.path.join(self.build_temp, 'pgo-train'))
+        final_lib = self.build_lib
+        compiler = self.compiler
+        clib.force = self.force = True
+
+        pgo_flags = ['-fprofile-generate=' + profile_dir, '-fprofile-update=atomic']
+        self.build_lib = train_lib
+        self.run_command('build_clib')
+        super().run()
+
+        env = dict(os.environ, PYTHONPATH=train_lib)
+        subprocess.check_call([sys.executable, os.path.join('benchmarks', 'bench_calls.py'),
+                               '--number', '20000', '--repeat', '1'], env=env)
+
+        pgo_flags = ['-fprofile-use=' + profile_dir, '-fprofile-correction', '-Wno-missing-profile']
+        # run() replaces the compiler name with a compiler object
+        self.build_lib = final_lib
+        self.compiler = clib.compiler = compiler
+        clib.run()
+        super().run()
+
+
+# The C structures build once into a static library that every extension
+# links. Variant files (dynamic_array_*.c, monotonic_increasing_stack_*.c)
+# are #included by their front files and are not listed.
+core_lib = ('pydatastructs_core', {
+    'sources': [
+        'src/alloc.c',
+        'src/deque.c',
+        'src/dllist.c',
+        'src/dynamic_array.c',
+        'src/event_queue.c',
+        'src/external_heap.c',
+        'src/graph.c',
+        'src/linked_list.c',
+        'src/loser_tree.c',
+        'src/mapped_file.c',
+        'src/min_heap.c',
+        'src/monotonic_increasing_stack.c',
+        'src/shared_region.c',
+        'src/sliding_median.c',
+        'src/timer_heap.c',
+        'src/ws_deque.c',
+    ],
+    'macros': dynamic_array_macros + stats_macros,
+    # The front files #include their variants, so rebuild on any change in src/
+    'obj_deps': {'': sorted(glob.glob('src/*.[ch]'))},
+})
 
 dllist_ext = Extension(
     name='pydatastructs.dllist',
     sources=[
         'bindings/dllist_py.c',
-        'src/dllist.c',
     ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
 )
 
 min_heap_ext = Extension(
     name='pydatastructs.min_heap',
     sources=[
         'bindings/min_heap_py.c',
-        'src/min_heap.c',
     ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
 )
 
 linked_list_ext = Extension(
     name='pydatastructs.linked_list',
     sources=[
         'bindings/linked_list_py.c',
-        'src/linked_list.c'
-    ]
+    ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
 )
 
 monotonic_increasing_stack_ext = Extension(
     name='pydatastructs.monotonic_increasing_stack',
     sources=[
         'bindings/monotonic_increasing_stack_py.c',
-        'src/monotonic_increasing_stack.c',
-        'src/dynamic_array.c'
-    ]
+    ],
+    define_macros=dynamic_array_macros + stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+int_array_ext = Extension(
+    name='pydatastructs.int_array',
+    sources=[
+        'bindings/int_array_py.c',
+    ],
+    define_macros=dynamic_array_macros + stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+deque_ext = Extension(
+    name='pydatastructs.deque',
+    sources=[
+        'bindings/deque_py.c',
+    ],
+    define_macros=dynamic_array_macros + stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+ws_deque_ext = Extension(
+    name='pydatastructs.ws_deque',
+    sources=[
+        'bindings/ws_deque_py.c',
+    ],
+    define_macros=dynamic_array_macros + stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+merge_ext = Extension(
+    name='pydatastructs.merge',
+    sources=[
+        'bindings/merge_py.c',
+    ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+sliding_median_ext = Extension(
+    name='pydatastructs.sliding_median',
+    sources=[
+        'bindings/sliding_median_py.c',
+    ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+aio_ext = Extension(
+    name='pydatastructs.aio',
+    sources=[
+        'bindings/aio_py.c',
+    ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
+)
+
+graph_ext = Extension(
+    name='pydatastructs.graph',
+    sources=[
+        'bindings/graph_py.c',
+    ],
+    define_macros=stats_macros + limited_api_macros,
+    py_limited_api=limited_api,
 )
 
 setup(
@@ -38,10 +256,15 @@ setup(
     version="0.1.0",
     description="Data Structures in C for Python",
     author="irbbb",
-    ext_modules=[dllist_ext, min_heap_ext, linked_list_ext, monotonic_increasing_stack_ext],
+    libraries=[core_lib],
+    ext_modules=[dllist_ext, min_heap_ext, linked_list_ext, monotonic_increasing_stack_ext, int_array_ext,
+                 deque_ext, ws_deque_ext, merge_ext, sliding_median_ext, aio_ext,
+                 graph_ext],
+    cmdclass={'build_clib': build_core, 'build_ext': build_profiled_ext},
     classifiers=[
         'Programming Language :: Python :: 3',
         'Programming Language :: C',
     ],
-    python_requires='>=3.7',
-)
\ No newline at end of file
+    python_requires='>=%d.%d' % limited_api_version if limited_api else '>=3.7',
+    options={'bdist_wheel': {'py_limited_api': limited_api_tag}} if limited_api else {},
+)
@@ -0,0 +1,60 @@
+// src/alloc.c
+
+#include <stdlib.h>
+#include "alloc.h"
+
+static void* pyds_libc_malloc(void* ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void* pyds_libc_calloc(void* ctx, size_t count, size_t size) {
+    (void)ctx;
+    return calloc(count, size);
+}
+
+static void* pyds_libc_realloc(void* ctx, void* ptr, size_t size) {
+    (void)ctx;
+    return realloc(ptr, size);
+}
+
+static void pyds_libc_free(void* ctx, void* ptr) {
+    (void)ctx;
+    free(ptr);
+}
+
+static const pyds_allocator_t pyds_libc_allocator = {
+    NULL, pyds_libc_malloc, pyds_libc_calloc, pyds_libc_realloc, pyds_libc_free,
+};
+
+pyds_allocator_t pyds_allocator = {
+    NULL, pyds_libc_malloc, pyds_libc_calloc, pyds_libc_realloc, pyds_libc_free,
+};
+
+pyds_alloc_tracker_t pyds_alloc_tracker = {NULL, NULL};
+
+long pyds_alloc_live_blocks = 0;
+
+bool pyds_set_allocator(const pyds_allocator_t* allocator) {
+    if (pyds_alloc_live() != 0) return false;
+
+    pyds_allocator = allocator ? *allocator : pyds_libc_allocator;
+    return true;
+}
+
+void pyds_get_allocator(pyds_allocator_t* out) {
+    *out = pyds_allocator;
+}
+
+void pyds_set_alloc_tracker(const pyds_alloc_tracker_t* tracker) {
+    if (tracker) {
+        pyds_alloc_tracker = *tracker;
+    } else {
+        pyds_alloc_tracker.track = NULL;
+        pyds_alloc_tracker.untrack = NULL;
+    }
+}
+
+long pyds_alloc_live(void) {
+    return PYDS_ALLOC_COUNT(0);
+}
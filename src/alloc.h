@@ -0,0 +1,121 @@
+// src/alloc.h
+
+#ifndef PYDS_ALLOC_H
+#define PYDS_ALLOC_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file alloc.h
+ * @brief Allocator table used for every heap allocation in the core.
+ *
+ * The core never calls malloc() directly. pyds_malloc() and friends go
+ * through pyds_allocator, which defaults to the C library and can be
+ * replaced with pyds_set_allocator(), e.g. by a jemalloc or mimalloc arena.
+ * The table has the same shape as CPython's PyMemAllocatorEx.
+ *
+ * An optional tracker sees every block with its size, which is how the
+ * bindings report native memory to tracemalloc.
+ *
+ * The core counts live blocks, and the allocator can only be replaced
+ * while that count is zero: a block must be freed by the allocator that
+ * returned it. Memory mapped from files or shared regions does not go
+ * through the table.
+ */
+
+/**
+ * @brief Allocation functions; ctx is passed back to each of them.
+ */
+typedef struct {
+    void* ctx;
+    void* (*malloc)(void* ctx, size_t size);
+    void* (*calloc)(void* ctx, size_t count, size_t size);
+    void* (*realloc)(void* ctx, void* ptr, size_t size);
+    void (*free)(void* ctx, void* ptr);
+} pyds_allocator_t;
+
+/**
+ * @brief Callbacks told about every block the allocator hands out or takes back.
+ */
+typedef struct {
+    void (*track)(void* ptr, size_t size);
+    void (*untrack)(void* ptr);
+} pyds_alloc_tracker_t;
+
+extern pyds_allocator_t pyds_allocator;
+extern pyds_alloc_tracker_t pyds_alloc_tracker;
+extern long pyds_alloc_live_blocks;
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PYDS_ALLOC_COUNT(delta) _InterlockedExchangeAdd(&pyds_alloc_live_blocks, (delta))
+#else
+#define PYDS_ALLOC_COUNT(delta) __atomic_fetch_add(&pyds_alloc_live_blocks, (delta), __ATOMIC_RELAXED)
+#endif
+
+static inline void* pyds_malloc(size_t size) {
+    void* ptr = pyds_allocator.malloc(pyds_allocator.ctx, size);
+    if (!ptr) return NULL;
+    PYDS_ALLOC_COUNT(1);
+    if (pyds_alloc_tracker.track) pyds_alloc_tracker.track(ptr, size);
+    return ptr;
+}
+
+static inline void* pyds_calloc(size_t count, size_t size) {
+    void* ptr = pyds_allocator.calloc(pyds_allocator.ctx, count, size);
+    if (!ptr) return NULL;
+    PYDS_ALLOC_COUNT(1);
+    if (pyds_alloc_tracker.track) pyds_alloc_tracker.track(ptr, count * size);
+    return ptr;
+}
+
+static inline void* pyds_realloc(void* ptr, size_t size) {
+    void* moved = pyds_allocator.realloc(pyds_allocator.ctx, ptr, size);
+    if (!moved) return NULL;
+    if (!ptr) PYDS_ALLOC_COUNT(1);
+    if (pyds_alloc_tracker.track) {
+        if (ptr && moved != ptr) pyds_alloc_tracker.untrack(ptr);
+        pyds_alloc_tracker.track(moved, size);
+    }
+    return moved;
+}
+
+static inline void pyds_free(void* ptr) {
+    if (!ptr) return;
+    if (pyds_alloc_tracker.untrack) pyds_alloc_tracker.untrack(ptr);
+    PYDS_ALLOC_COUNT(-1);
+    pyds_allocator.free(pyds_allocator.ctx, ptr);
+}
+
+/**
+ * @brief Replaces the allocator.
+ * @param allocator New table, or NULL for the C library's.
+ * @return false, leaving the allocator unchanged, while blocks are live.
+ */
+bool pyds_set_allocator(const pyds_allocator_t* allocator);
+
+/**
+ * @brief Copies the current allocator table.
+ */
+void pyds_get_allocator(pyds_allocator_t* out);
+
+/**
+ * @brief Installs the tracker, or removes it when tracker is NULL.
+ */
+void pyds_set_alloc_tracker(const pyds_alloc_tracker_t* tracker);
+
+/**
+ * @brief Number of blocks allocated and not yet freed.
+ */
+long pyds_alloc_live(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PYDS_ALLOC_H
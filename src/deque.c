@@ -0,0 +1,261 @@
+// src/deque.c
+
+#include <stdlib.h>
+#include <string.h>
+#include "alloc.h"
+#include "deque.h"
+
+#define DEQUE_INITIAL_CAPACITY 16
+
+static inline size_t deque_mask(const deque_t* deque) {
+    return deque->storage.capacity - 1;
+}
+
+// Number of values held after adding count, before any value is dropped
+static inline size_t deque_needed(const deque_t* deque, size_t count) {
+    size_t needed = count > SIZE_MAX - deque->size ? SIZE_MAX : deque->size + count;
+    return needed < deque->maxlen ? needed : deque->maxlen;
+}
+
+/**
+ * @brief Copies count slots from src to dst; the two runs do not overlap.
+ */
+static void deque_move(dynamic_array_t* storage, size_t dst, size_t src, size_t count) {
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+    for (size_t i = 0; i < count; i++) {
+        *dynamic_array_slot(storage, dst + i) = *dynamic_array_slot(storage, src + i);
+    }
+#else
+    memcpy(storage->data + dst, storage->data + src, count * sizeof(int32_t));
+#endif
+}
+
+/**
+ * @brief Grows the storage to the smallest power of two holding needed values.
+ *
+ * Values that wrapped past the end of the old storage are moved so the ring
+ * is contiguous modulo the new capacity: either the wrapped run from slot 0
+ * goes after the old end, or the front run goes to the new end, whichever is
+ * shorter. The storage may have grown even when the reservation fails, so
+ * the values are moved in both cases.
+ */
+static dyn_array_status_t deque_reserve(deque_t* deque, size_t needed) {
+    size_t old_capacity = deque->storage.capacity;
+    if (needed <= old_capacity) return DYN_ARRAY_OK;
+
+    size_t capacity = old_capacity;
+    while (capacity < needed) {
+        if (capacity > SIZE_MAX / 2) return DYN_ARRAY_ERROR_NO_MEMORY;
+        capacity *= 2;
+    }
+
+    dyn_array_status_t status = dynamic_array_reserve(&deque->storage, capacity);
+    if (deque->storage.capacity == old_capacity) return status;
+
+    if (deque->head + deque->size > old_capacity) {
+        size_t wrapped = deque->head + deque->size - old_capacity;
+        size_t front = old_capacity - deque->head;
+        if (wrapped <= front) {
+            deque_move(&deque->storage, old_capacity, 0, wrapped);
+        } else {
+            size_t head = deque->storage.capacity - front;
+            deque_move(&deque->storage, head, deque->head, front);
+            deque->head = head;
+        }
+    }
+    return status;
+}
+
+deque_t* deque_create(size_t maxlen) {
+    deque_t* deque = pyds_malloc(sizeof(deque_t));
+    if (!deque) return NULL;
+
+    if (dynamic_array_init(&deque->storage, DEQUE_INITIAL_CAPACITY) != DYN_ARRAY_OK) {
+        pyds_free(deque);
+        return NULL;
+    }
+
+    deque->head = 0;
+    deque->size = 0;
+    deque->maxlen = maxlen;
+
+    // The mask needs a power of two, whatever minimum the storage rounds up to
+    size_t capacity = deque->storage.capacity;
+    if (capacity & (capacity - 1)) {
+        while (capacity & (capacity - 1)) capacity &= capacity - 1;
+        if (dynamic_array_reserve(&deque->storage, capacity * 2) != DYN_ARRAY_OK) {
+            deque_destroy(deque);
+            return NULL;
+        }
+    }
+    return deque;
+}
+
+void deque_destroy(deque_t* deque) {
+    if (!deque) return;
+    dynamic_array_free(&deque->storage);
+    pyds_free(deque);
+}
+
+dyn_array_status_t deque_push_back(deque_t* deque, int32_t value) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    if (deque->size == deque->maxlen) {
+        if (deque->maxlen == 0) return DYN_ARRAY_OK;
+        deque->head = (deque->head + 1) & deque_mask(deque);
+        deque->size--;
+    } else if (deque->size == deque->storage.capacity) {
+        dyn_array_status_t status = deque_reserve(deque, deque->size + 1);
+        if (status != DYN_ARRAY_OK) return status;
+    }
+
+    *deque_slot(deque, deque->size++) = value;
+    PYDS_STAT_HIGH_WATER(deque->storage.stats, deque->size);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t deque_push_front(deque_t* deque, int32_t value) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    if (deque->size == deque->maxlen) {
+        if (deque->maxlen == 0) return DYN_ARRAY_OK;
+        deque->size--;
+    } else if (deque->size == deque->storage.capacity) {
+        dyn_array_status_t status = deque_reserve(deque, deque->size + 1);
+        if (status != DYN_ARRAY_OK) return status;
+    }
+
+    deque->head = (deque->head - 1) & deque_mask(deque);
+    *deque_slot(deque, 0) = value;
+    deque->size++;
+    PYDS_STAT_HIGH_WATER(deque->storage.stats, deque->size);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t deque_pop_back(deque_t* deque, int32_t* removed) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    if (deque->size == 0) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+
+    *removed = *deque_slot(deque, --deque->size);
+    if (deque->size == 0) deque->head = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t deque_pop_front(deque_t* deque, int32_t* removed) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    if (deque->size == 0) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+
+    *removed = *deque_slot(deque, 0);
+    deque->head = --deque->size == 0 ? 0 : (deque->head + 1) & deque_mask(deque);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t deque_extend_back(deque_t* deque, const int32_t* values, size_t count) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    dyn_array_status_t status = deque_reserve(deque, deque_needed(deque, count));
+    if (status != DYN_ARRAY_OK) return status;
+
+    // Only the last maxlen values survive
+    if (count >= deque->maxlen) {
+        values += count - deque->maxlen;
+        count = deque->maxlen;
+        deque->head = 0;
+        deque->size = 0;
+    }
+
+    size_t drop = deque->size + count > deque->maxlen ? deque->size + count - deque->maxlen : 0;
+    deque->head = (deque->head + drop) & deque_mask(deque);
+    deque->size -= drop;
+
+    for (size_t i = 0; i < count; i++) {
+        *deque_slot(deque, deque->size + i) = values[i];
+    }
+    deque->size += count;
+    PYDS_STAT_HIGH_WATER(deque->storage.stats, deque->size);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t deque_extend_front(deque_t* deque, const int32_t* values, size_t count) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    dyn_array_status_t status = deque_reserve(deque, deque_needed(deque, count));
+    if (status != DYN_ARRAY_OK) return status;
+
+    if (count >= deque->maxlen) {
+        values += count - deque->maxlen;
+        count = deque->maxlen;
+        deque->head = 0;
+        deque->size = 0;
+    }
+
+    // Front pushes drop values from the back
+    if (deque->size + count > deque->maxlen) deque->size = deque->maxlen - count;
+
+    size_t mask = deque_mask(deque);
+    for (size_t i = 0; i < count; i++) {
+        deque->head = (deque->head - 1) & mask;
+        *dynamic_array_slot(&deque->storage, deque->head) = values[i];
+    }
+    deque->size += count;
+    PYDS_STAT_HIGH_WATER(deque->storage.stats, deque->size);
+    return DYN_ARRAY_OK;
+}
+
+void deque_clear(deque_t* deque) {
+    if (!deque) return;
+    PYDS_STAT_ADD(deque->storage.stats, ops, 1);
+    deque->head = 0;
+    deque->size = 0;
+}
+
+bool deque_fits(const deque_t* deque, size_t count) {
+    return deque_needed(deque, count) <= deque->storage.capacity;
+}
+
+dyn_array_status_t deque_segments(deque_t* deque, int32_t** first, size_t* first_length,
+                                  int32_t** second, size_t* second_length) {
+    CHECK_PTR_RET(deque, DYN_ARRAY_ERROR_NULL_POINTER);
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+    (void)first;
+    (void)first_length;
+    (void)second;
+    (void)second_length;
+    return DYN_ARRAY_ERROR_UNSUPPORTED;
+#else
+    size_t to_end = deque->storage.capacity - deque->head;
+    *first = deque->storage.data + deque->head;
+    *first_length = deque->size < to_end ? deque->size : to_end;
+    *second = deque->storage.data;
+    *second_length = deque->size - *first_length;
+    return DYN_ARRAY_OK;
+#endif
+}
+
+size_t deque_memory_usage(const deque_t* deque) {
+    if (!deque) return 0;
+    return sizeof(deque_t) - sizeof(dynamic_array_t) + dynamic_array_memory_usage(&deque->storage);
+}
+
+void deque_get_stats(const deque_t* deque, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (deque) *out = deque->storage.stats;
+#else
+    (void)deque;
+#endif
+}
+
+void deque_reset_stats(deque_t* deque) {
+    if (!deque) return;
+    PYDS_STAT_RESET(deque->storage.stats);
+    PYDS_STAT_HIGH_WATER(deque->storage.stats, deque->size);
+}
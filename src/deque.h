@@ -0,0 +1,206 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "dynamic_array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file deque.h
+ * @brief Double-ended queue of int32 values in a power-of-two ring buffer.
+ *
+ * The ring lives in a dynamic_array_t whose capacity is always a power of
+ * two, so element i sits in slot (head + i) & (capacity - 1). Pushes and
+ * pops at either end and random access are O(1); growth doubles the
+ * storage through dynamic_array_reserve() and moves the shorter of the two
+ * wrapped parts. The storage's own size field is not used.
+ *
+ * A bounded deque keeps at most maxlen values: pushing onto a full one
+ * drops a value from the opposite end, like collections.deque.
+ */
+
+/**
+ * @brief maxlen of a deque that grows without bound.
+ */
+#define DEQUE_UNBOUNDED SIZE_MAX
+
+typedef struct {
+    dynamic_array_t storage; /**< Ring slots; capacity is a power of two */
+    size_t head;             /**< Slot of the first value */
+    size_t size;             /**< Number of values */
+    size_t maxlen;           /**< Most values kept, or DEQUE_UNBOUNDED */
+} deque_t;
+
+/**
+ * @brief Creates an empty deque.
+ * @param maxlen Most values kept, or DEQUE_UNBOUNDED.
+ * @return deque_t* Pointer to the deque, or NULL on allocation failure.
+ */
+deque_t* deque_create(size_t maxlen);
+
+/**
+ * @brief Frees the deque and its storage.
+ * @param deque Pointer to deque; NULL is ignored.
+ */
+void deque_destroy(deque_t* deque);
+
+/**
+ * @brief Add a value at the back, dropping the front value of a full bounded deque.
+ * @param deque Pointer to deque.
+ * @param value Value to add.
+ * @return Status code.
+ */
+dyn_array_status_t deque_push_back(deque_t* deque, int32_t value);
+
+/**
+ * @brief Add a value at the front, dropping the back value of a full bounded deque.
+ * @param deque Pointer to deque.
+ * @param value Value to add.
+ * @return Status code.
+ */
+dyn_array_status_t deque_push_front(deque_t* deque, int32_t value);
+
+/**
+ * @brief Remove the back value.
+ * @param deque Pointer to deque.
+ * @param removed Receives the value.
+ * @return DYN_ARRAY_ERROR_OUT_OF_RANGE if the deque is empty.
+ */
+dyn_array_status_t deque_pop_back(deque_t* deque, int32_t* removed);
+
+/**
+ * @brief Remove the front value.
+ * @param deque Pointer to deque.
+ * @param removed Receives the value.
+ * @return DYN_ARRAY_ERROR_OUT_OF_RANGE if the deque is empty.
+ */
+dyn_array_status_t deque_pop_front(deque_t* deque, int32_t* removed);
+
+/**
+ * @brief Add count values at the back, in order. The storage grows at most
+ * once, and a bounded deque only copies the values it keeps.
+ * @param deque Pointer to deque.
+ * @param values Values to add.
+ * @param count Number of values.
+ * @return Status code; on failure no value was added.
+ */
+dyn_array_status_t deque_extend_back(deque_t* deque, const int32_t* values, size_t count);
+
+/**
+ * @brief Add count values at the front one by one, so they end up in
+ * reverse order, like collections.deque.extendleft().
+ * @param deque Pointer to deque.
+ * @param values Values to add.
+ * @param count Number of values.
+ * @return Status code; on failure no value was added.
+ */
+dyn_array_status_t deque_extend_front(deque_t* deque, const int32_t* values, size_t count);
+
+/**
+ * @brief Remove every value, keeping the storage.
+ * @param deque Pointer to deque.
+ */
+void deque_clear(deque_t* deque);
+
+/**
+ * @brief Whether count more values fit without reallocating the storage.
+ *
+ * A bounded deque that is full only drops values, so values always fit once
+ * the storage holds maxlen of them.
+ *
+ * @param deque Pointer to deque.
+ * @param count Number of values to add.
+ * @return true if adding them keeps every slot address.
+ */
+bool deque_fits(const deque_t* deque, size_t count);
+
+/**
+ * @brief The values as at most two runs of consecutive slots.
+ *
+ * The first run starts at the front value; the second, empty unless the
+ * values wrap around the end of the storage, starts at slot 0. Both stay
+ * valid until the storage grows. Only the contiguous storage build has them.
+ *
+ * @param deque Pointer to deque.
+ * @param first Receives the start of the first run.
+ * @param first_length Receives its length.
+ * @param second Receives the start of the second run.
+ * @param second_length Receives its length.
+ * @return DYN_ARRAY_ERROR_UNSUPPORTED in a DYNAMIC_ARRAY_SEGMENTED build.
+ */
+dyn_array_status_t deque_segments(deque_t* deque, int32_t** first, size_t* first_length,
+                                  int32_t** second, size_t* second_length);
+
+/**
+ * @brief Bytes allocated for the deque and its storage.
+ * @param deque Pointer to deque.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t deque_memory_usage(const deque_t* deque);
+
+/**
+ * @brief Copy the operation counters of a PYDS_STATS build.
+ *
+ * Pushes, pops, extends and clear count as operations; get and set do not.
+ *
+ * @param deque Pointer to deque.
+ * @param out Receives the counters; all zero when built without PYDS_STATS.
+ */
+void deque_get_stats(const deque_t* deque, pyds_stats_t* out);
+
+/**
+ * @brief Zero the operation counters; high_water restarts at the current size.
+ * @param deque Pointer to deque.
+ */
+void deque_reset_stats(deque_t* deque);
+
+/**
+ * @brief Address of the slot holding value index, without bounds checking.
+ * @param deque Pointer to deque.
+ * @param index Position from the front, must be < size.
+ * @return Pointer to the slot.
+ */
+static inline int32_t* deque_slot(const deque_t* deque, size_t index) {
+    return dynamic_array_slot(&deque->storage, (deque->head + index) & (deque->storage.capacity - 1));
+}
+
+/**
+ * @brief Get the value at index from the front.
+ * @param deque Pointer to deque.
+ * @param index Position of the value.
+ * @param out_value Receives the value.
+ * @return DYN_ARRAY_ERROR_OUT_OF_RANGE if index >= size.
+ */
+static inline dyn_array_status_t deque_get(const deque_t* deque, size_t index, int32_t* out_value) {
+    if (index >= deque->size) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+    *out_value = *deque_slot(deque, index);
+    return DYN_ARRAY_OK;
+}
+
+/**
+ * @brief Replace the value at index from the front.
+ * @param deque Pointer to deque.
+ * @param index Position of the value.
+ * @param value New value.
+ * @return DYN_ARRAY_ERROR_OUT_OF_RANGE if index >= size.
+ */
+static inline dyn_array_status_t deque_set(deque_t* deque, size_t index, int32_t value) {
+    if (index >= deque->size) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+    *deque_slot(deque, index) = value;
+    return DYN_ARRAY_OK;
+}
+
+static inline size_t deque_size(const deque_t* deque) {
+    return deque ? deque->size : 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEQUE_H */
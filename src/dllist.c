@@ -1,14 +1,17 @@
 // src/dllist.c
 
 #include <stdlib.h>
+#include <string.h>
+#include "alloc.h"
 #include "dllist.h"
 
 DoublyLinkedList* dll_create() {
-    DoublyLinkedList* dll = (DoublyLinkedList*)malloc(sizeof(DoublyLinkedList));
+    DoublyLinkedList* dll = (DoublyLinkedList*)pyds_malloc(sizeof(DoublyLinkedList));
     if (!dll) return NULL;
     dll->head = NULL;
     dll->tail = NULL;
     dll->size = 0;
+    PYDS_STAT_RESET(dll->stats);
     return dll;
 }
 
@@ -17,16 +20,18 @@ void dll_free(DoublyLinkedList* dll) {
     Node* current = dll->head;
     while (current) {
         Node* next = current->next;
-        free(current);
+        pyds_free(current);
         current = next;
     }
-    free(dll);
+    pyds_free(dll);
 }
 
 void dll_append(DoublyLinkedList* list, int value) {
     if (!list) return;
-    Node* node = (Node*)malloc(sizeof(Node));
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    Node* node = (Node*)pyds_malloc(sizeof(Node));
     if (!node) return;
+    PYDS_STAT_ALLOC(list->stats, sizeof(Node));
     node->value = value;
     node->next = NULL;
     node->prev = list->tail;
@@ -38,12 +43,15 @@ void dll_append(DoublyLinkedList* list, int value) {
 
     list->tail = node;
     list->size++;
+    PYDS_STAT_HIGH_WATER(list->stats, list->size);
 }
 
 void dll_prepend(DoublyLinkedList* list, int value) {
     if (!list) return;
-    Node* node = (Node*)malloc(sizeof(Node));
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    Node* node = (Node*)pyds_malloc(sizeof(Node));
     if (!node) return;
+    PYDS_STAT_ALLOC(list->stats, sizeof(Node));
     node->value = value;
     node->prev = NULL;
     node->next = list->head;
@@ -55,13 +63,17 @@ void dll_prepend(DoublyLinkedList* list, int value) {
 
     list->head = node;
     list->size++;
+    PYDS_STAT_HIGH_WATER(list->stats, list->size);
 }
 
 char dll_remove(DoublyLinkedList* list, int value, int* removed_value) {
     if (!list) return 0;
+    PYDS_STAT_ADD(list->stats, ops, 1);
     Node* current = list->head;
 
     while (current) {
+        PYDS_STAT_ADD(list->stats, steps, 1);
+        PYDS_STAT_ADD(list->stats, comparisons, 1);
         if (current->value == value) {
             if (current->prev)
                 current->prev->next = current->next;
@@ -74,7 +86,7 @@ char dll_remove(DoublyLinkedList* list, int value, int* removed_value) {
                 list->tail = current->prev;
 
             *removed_value = current->value;
-            free(current);
+            pyds_free(current);
             list->size--;
             return 1;
         }
@@ -86,6 +98,7 @@ char dll_remove(DoublyLinkedList* list, int value, int* removed_value) {
 
 char dll_pop(DoublyLinkedList* list, int index, int* removed_value) {
     if(!list) return 0;
+    PYDS_STAT_ADD(list->stats, ops, 1);
     if(index >= list->size) return 0;
 
     Node* current = list->head;
@@ -93,6 +106,7 @@ char dll_pop(DoublyLinkedList* list, int index, int* removed_value) {
     for(int i = 0; i < index; i++) {
         current = current->next;
     }
+    PYDS_STAT_ADD(list->stats, steps, index);
 
     if (current->prev)
         current->prev->next = current->next;
@@ -105,7 +119,7 @@ char dll_pop(DoublyLinkedList* list, int index, int* removed_value) {
         list->tail = current->prev;
 
     *removed_value = current->value;
-    free(current);
+    pyds_free(current);
     list->size--;
     return 1;
 }
@@ -119,7 +133,7 @@ int* dll_to_array(DoublyLinkedList* list) {
     if (!list) return NULL;
     if (list->size == 0) return NULL;
 
-    int* arr = (int*)malloc(sizeof(int) * list->size);
+    int* arr = (int*)pyds_malloc(sizeof(int) * list->size);
     if (!arr) return NULL;
 
     Node* current = list->head;
@@ -129,4 +143,132 @@ int* dll_to_array(DoublyLinkedList* list) {
         current = current->next;
     }
     return arr;
-}
\ No newline at end of file
+}
+
+// The node at index in [0, size), walking from the nearer end
+static Node* dll_node_at(DoublyLinkedList* list, int index) {
+    Node* current;
+    if (index < list->size / 2) {
+        current = list->head;
+        for (int i = 0; i < index; i++) current = current->next;
+        PYDS_STAT_ADD(list->stats, steps, index);
+    } else {
+        current = list->tail;
+        for (int i = list->size - 1; i > index; i--) current = current->prev;
+        PYDS_STAT_ADD(list->stats, steps, list->size - 1 - index);
+    }
+    return current;
+}
+
+// Takes every node of other, leaving it empty
+static void dll_take_all(DoublyLinkedList* list, DoublyLinkedList* other, Node** first, Node** last) {
+    *first = other->head;
+    *last = other->tail;
+    list->size += other->size;
+    other->head = other->tail = NULL;
+    other->size = 0;
+    PYDS_STAT_HIGH_WATER(list->stats, list->size);
+}
+
+void dll_extend(DoublyLinkedList* list, DoublyLinkedList* other) {
+    if (!list || !other || list == other) return;
+    dll_splice(list, list->size, other);
+}
+
+void dll_splice(DoublyLinkedList* list, int index, DoublyLinkedList* other) {
+    if (!list || !other || list == other) return;
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    PYDS_STAT_ADD(other->stats, ops, 1);
+    if (other->size == 0 || index < 0 || index > list->size) return;
+
+    Node* after = index < list->size ? dll_node_at(list, index) : NULL;
+    Node* before = after ? after->prev : list->tail;
+    Node *first, *last;
+    dll_take_all(list, other, &first, &last);
+
+    first->prev = before;
+    last->next = after;
+    if (before) before->next = first;
+    else list->head = first;
+    if (after) after->prev = last;
+    else list->tail = last;
+}
+
+void dll_split(DoublyLinkedList* list, int index, DoublyLinkedList* rest) {
+    if (!list || !rest || list == rest) return;
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    PYDS_STAT_ADD(rest->stats, ops, 1);
+    if (index < 0 || index >= list->size) return;
+
+    Node* first = dll_node_at(list, index);
+    Node* last = list->tail;
+    int moved = list->size - index;
+
+    list->tail = first->prev;
+    if (list->tail) list->tail->next = NULL;
+    else list->head = NULL;
+    list->size = index;
+
+    first->prev = rest->tail;
+    if (rest->tail) rest->tail->next = first;
+    else rest->head = first;
+    rest->tail = last;
+    rest->size += moved;
+    PYDS_STAT_HIGH_WATER(rest->stats, rest->size);
+}
+
+void dll_rotate(DoublyLinkedList* list, int steps) {
+    if (!list) return;
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    if (list->size < 2) return;
+
+    int shift = steps % list->size;
+    if (shift < 0) shift += list->size;
+    if (shift == 0) return;
+
+    // Close the ring, then open it before the node that becomes the head
+    Node* head = dll_node_at(list, list->size - shift);
+    list->tail->next = list->head;
+    list->head->prev = list->tail;
+    list->head = head;
+    list->tail = head->prev;
+    head->prev = NULL;
+    list->tail->next = NULL;
+}
+
+void dll_reverse(DoublyLinkedList* list) {
+    if (!list) return;
+    PYDS_STAT_ADD(list->stats, ops, 1);
+    PYDS_STAT_ADD(list->stats, steps, list->size);
+
+    Node* current = list->head;
+    while (current) {
+        Node* next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+    Node* head = list->head;
+    list->head = list->tail;
+    list->tail = head;
+}
+
+void dll_get_stats(const DoublyLinkedList* list, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (list) *out = list->stats;
+#else
+    (void)list;
+#endif
+}
+
+void dll_reset_stats(DoublyLinkedList* list) {
+    if (!list) return;
+    PYDS_STAT_RESET(list->stats);
+    PYDS_STAT_HIGH_WATER(list->stats, list->size);
+}
+
+size_t dll_memory_usage(const DoublyLinkedList* list) {
+    if (!list) return 0;
+    return sizeof(DoublyLinkedList) + sizeof(Node) * (size_t)list->size;
+}
@@ -3,6 +3,8 @@
 #ifndef DLLIST_H
 #define DLLIST_H
 
+#include "stats.h"
+
 typedef struct Node {
     int value;
     struct Node* prev;
@@ -13,6 +15,9 @@ typedef struct {
     Node* head;
     Node* tail;
     int size;
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+#endif
 } DoublyLinkedList;
 
 DoublyLinkedList* dll_create();
@@ -22,6 +27,23 @@ void dll_prepend(DoublyLinkedList* list, int value);
 char dll_remove(DoublyLinkedList* list, int value, int* removed_value);
 char dll_pop(DoublyLinkedList* list, int index, int* removed_value);
 int dll_length(DoublyLinkedList* list);
-int* dll_to_array(DoublyLinkedList* list);
+int* dll_to_array(DoublyLinkedList* list);  // Free the result with pyds_free()
+
+// Restructuring relinks nodes in place, without allocating or freeing any.
+// Indexes are in [0, size]; the lists passed as other or rest must differ
+// from list, their combined size must fit in an int, and other ends up empty.
+void dll_extend(DoublyLinkedList* list, DoublyLinkedList* other);  // Move other's nodes to the end
+void dll_splice(DoublyLinkedList* list, int index, DoublyLinkedList* other);  // Move other's nodes before index
+void dll_split(DoublyLinkedList* list, int index, DoublyLinkedList* rest);  // Move the nodes from index on to the end of rest
+void dll_rotate(DoublyLinkedList* list, int steps);  // Move the last steps nodes to the front; negative rotates left
+void dll_reverse(DoublyLinkedList* list);
+
+// Bytes allocated for the list and its nodes
+size_t dll_memory_usage(const DoublyLinkedList* list);
+
+// Counters from a PYDS_STATS build; all zero otherwise. Resetting restarts
+// high_water at the current size.
+void dll_get_stats(const DoublyLinkedList* list, pyds_stats_t* out);
+void dll_reset_stats(DoublyLinkedList* list);
 
 #endif
@@ -4,8 +4,12 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <limits.h>
 #include <errno.h>
 #include <pthread.h>
+#include "mapped_file.h"
+#include "shared_region.h"
+#include "stats.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -28,6 +32,10 @@ typedef enum {
     DYN_ARRAY_ERROR_OUT_OF_RANGE,     /**< Index out of valid range */
     DYN_ARRAY_ERROR_NO_MEMORY,        /**< Memory allocation failed */
     DYN_ARRAY_ERROR_MUTEX,            /**< Mutex error */
+    DYN_ARRAY_ERROR_IO,               /**< File or mapping operation failed, see errno */
+    DYN_ARRAY_ERROR_FORMAT,           /**< File is not a dynamic array file */
+    DYN_ARRAY_ERROR_CHECKSUM,         /**< File payload does not match its checksum */
+    DYN_ARRAY_ERROR_UNSUPPORTED,      /**< Operation not available in this build */
 } dyn_array_status_t;
 
 /**
@@ -73,16 +81,48 @@ typedef enum {
 #define DYN_ARRAY_UNLOCK(mutex)
 #endif
 
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+/**
+ * @brief log2 of the number of elements held by each of the first two segments.
+ *
+ * Segment 0 and segment 1 hold DYN_ARRAY_SEGMENT_BASE elements, and segment
+ * k >= 1 holds DYN_ARRAY_SEGMENT_BASE << (k - 1) elements. The capacity is
+ * therefore always a power of two, and growing only allocates the next segment.
+ */
+#define DYN_ARRAY_SEGMENT_SHIFT 4
+#define DYN_ARRAY_SEGMENT_BASE ((size_t)1 << DYN_ARRAY_SEGMENT_SHIFT)
+
+/**
+ * @brief Number of directory entries needed to address the whole size_t range.
+ */
+#define DYN_ARRAY_MAX_SEGMENTS (sizeof(size_t) * CHAR_BIT - DYN_ARRAY_SEGMENT_SHIFT + 1)
+#endif
+
 /**
  * @brief Dynamic array structure.
+ *
+ * When DYNAMIC_ARRAY_SEGMENTED is defined the elements live in power-of-two
+ * segments indexed by a fixed directory instead of one contiguous buffer.
+ * Growth never copies and element addresses stay stable until the element
+ * is popped.
  */
 typedef struct {
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+    DYN_ARRAY_TYPE *segments[DYN_ARRAY_MAX_SEGMENTS]; /**< Segment directory */
+    size_t segment_count;                             /**< Allocated segments */
+#else
     DYN_ARRAY_TYPE *restrict data;
+    mapped_file_t *file;  /**< Backing file mapping, or NULL for heap memory */
+    pyds_shared_header_t *shared; /**< Shared region header, or NULL for private memory */
+#endif
     size_t size;
     size_t capacity;
 #ifdef DYNAMIC_ARRAY_THREAD_SAFE
     pthread_mutex_t lock;
 #endif
+#ifdef PYDS_STATS
+    pyds_stats_t stats; /**< Operation counters */
+#endif
 } dynamic_array_t;
 
 /* Constructors and destructors */
@@ -114,6 +154,66 @@ dyn_array_status_t dynamic_array_init(dynamic_array_t* array, size_t capacity);
  */
 dyn_array_status_t dynamic_array_init_with_value(dynamic_array_t* array, size_t capacity, DYN_ARRAY_TYPE default_value);
 
+/**
+ * @brief Initialize a dynamic array backed by a memory-mapped file.
+ *
+ * The file is created if it is empty or missing. An existing file is mapped
+ * in place, so opening does not depend on its size unless verify is set.
+ * Growth extends the file with ftruncate and remaps it. Not available when
+ * DYNAMIC_ARRAY_SEGMENTED is defined.
+ *
+ * @param array Pointer to dynamic array to initialize.
+ * @param path Path of the backing file.
+ * @param verify Check the payload against the checksum stored at the last sync.
+ * @return Status code.
+ */
+dyn_array_status_t dynamic_array_open(dynamic_array_t* array, const char* path, bool verify);
+
+/**
+ * @brief Write size and checksum to the backing file and flush it to disk.
+ * Does nothing for arrays that are not file-backed.
+ * @param array Pointer to dynamic array.
+ * @return Status code.
+ */
+dyn_array_status_t dynamic_array_sync(dynamic_array_t* array);
+
+/**
+ * @brief Initialize a dynamic array over a caller-owned shared memory region.
+ *
+ * The region layout is offset-based, so other processes can attach the same
+ * memory at any address. Capacity is fixed by the region length and pushing
+ * past it fails with DYN_ARRAY_ERROR_NO_MEMORY. The region must outlive the
+ * array; dynamic_array_free() does not release it. Not available when
+ * DYNAMIC_ARRAY_SEGMENTED is defined.
+ *
+ * @param array Pointer to dynamic array to initialize.
+ * @param base Start of the region, aligned to at least 8 bytes.
+ * @param length Region length in bytes.
+ * @param create Lay out an empty array, discarding the region contents.
+ *               Otherwise the region must already hold an array.
+ * @return Status code.
+ */
+dyn_array_status_t dynamic_array_attach(dynamic_array_t* array, void* base, size_t length, bool create);
+
+/**
+ * @brief Take the cross-process lock of a shared array and reload its size.
+ *
+ * Every access to a shared array, including dynamic_array_get() and
+ * dynamic_array_size(), must happen between dynamic_array_lock() and
+ * dynamic_array_unlock(). The lock is recursive. Does nothing for arrays
+ * that are not shared.
+ *
+ * @param array Pointer to dynamic array.
+ */
+void dynamic_array_lock(dynamic_array_t* array);
+
+/**
+ * @brief Publish the size of a shared array and release its lock.
+ * Does nothing for arrays that are not shared.
+ * @param array Pointer to dynamic array.
+ */
+void dynamic_array_unlock(dynamic_array_t* array);
+
 /**
  * @brief Free all resources used by the dynamic array internals.
  * Does NOT free the dynamic_array struct itself.
@@ -179,7 +279,53 @@ dyn_array_status_t dynamic_array_reserve(dynamic_array_t* array, size_t new_capa
  */
 dyn_array_status_t dynamic_array_copy(const dynamic_array_t* src, dynamic_array_t* dst);
 
+/**
+ * @brief Bytes allocated for the array header and its buffer or segments.
+ *
+ * Mapped files and shared regions are not counted.
+ *
+ * @param array Pointer to dynamic array.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t dynamic_array_memory_usage(const dynamic_array_t* array);
+
+/**
+ * @brief Copy the operation counters of a PYDS_STATS build.
+ *
+ * push_back, pop_back, reserve, shrink_to_fit and clear count as
+ * operations; the inline get and set do not.
+ *
+ * @param array Pointer to dynamic array.
+ * @param out Receives the counters; all zero when built without PYDS_STATS.
+ */
+void dynamic_array_get_stats(const dynamic_array_t* array, pyds_stats_t* out);
+
+/**
+ * @brief Zero the operation counters; high_water restarts at the current size.
+ * @param array Pointer to dynamic array.
+ */
+void dynamic_array_reset_stats(dynamic_array_t* array);
+
 /* Accessors */
+/**
+ * @brief Address of the element slot at index, without bounds checking.
+ * @param array Pointer to dynamic array.
+ * @param index Index of the slot, must be < capacity.
+ * @return Pointer to the slot.
+ */
+static inline __attribute__((always_inline)) DYN_ARRAY_TYPE* dynamic_array_slot(
+    const dynamic_array_t* array,
+    size_t index
+) {
+#ifdef DYNAMIC_ARRAY_SEGMENTED
+    if (index < DYN_ARRAY_SEGMENT_BASE) return &array->segments[0][index];
+    unsigned msb = (unsigned)(sizeof(unsigned long long) * CHAR_BIT - 1) - (unsigned)__builtin_clzll(index);
+    return &array->segments[msb - DYN_ARRAY_SEGMENT_SHIFT + 1][index - ((size_t)1 << msb)];
+#else
+    return &array->data[index];
+#endif
+}
+
 /**
  * @brief Get element at index safely.
  * @param array Pointer to dynamic array.
@@ -194,7 +340,7 @@ static inline dyn_array_status_t dynamic_array_get(
 ) {
     CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
     if (__builtin_expect(index >= array->size, 0)) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
-    *out_value = array->data[index];
+    *out_value = *dynamic_array_slot(array, index);
     return DYN_ARRAY_OK;
 }
 
@@ -212,7 +358,10 @@ static inline __attribute__((always_inline)) dyn_array_status_t dynamic_array_se
 ) {
     CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
     if (__builtin_expect(index >= array->size, 0)) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
-    array->data[index] = value;
+#ifndef DYNAMIC_ARRAY_SEGMENTED
+    mapped_file_touch(array->file);
+#endif
+    *dynamic_array_slot(array, index) = value;
     return DYN_ARRAY_OK;
 }
 
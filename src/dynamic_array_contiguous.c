@@ -0,0 +1,440 @@
+// dynamic_array_contiguous.c
+
+#include "dynamic_array.h"
+#include "alloc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdio.h>  // for debug prints if needed
+
+static const size_t DYN_ARRAY_MIN_CAPACITY = 16;
+static const size_t DYN_ARRAY_GROW_FACTOR = 2;
+static const size_t DYN_ARRAY_SHRINK_THRESHOLD_DIV = 4;
+static const size_t DYN_ARRAY_FILE_MIN_CAPACITY = 1024;
+
+/**
+ * @brief Helper to check multiplication overflow of size_t.
+ * @param a First operand.
+ * @param b Second operand.
+ * @return true if overflow would occur, false otherwise.
+ */
+static bool mul_overflow_size_t(size_t a, size_t b) {
+    if (a == 0 || b == 0) return false;
+    return a > SIZE_MAX / b;
+}
+
+/**
+ * @brief Translate a mapped file status into a dynamic array status.
+ * @param status Mapped file status.
+ * @return Status code.
+ */
+static dyn_array_status_t dynamic_array_file_status(mapped_file_status_t status) {
+    switch (status) {
+        case MAPPED_FILE_OK: return DYN_ARRAY_OK;
+        case MAPPED_FILE_ERROR_FORMAT: return DYN_ARRAY_ERROR_FORMAT;
+        case MAPPED_FILE_ERROR_CHECKSUM: return DYN_ARRAY_ERROR_CHECKSUM;
+        case MAPPED_FILE_ERROR_UNSUPPORTED: return DYN_ARRAY_ERROR_UNSUPPORTED;
+        default: return DYN_ARRAY_ERROR_IO;
+    }
+}
+
+/**
+ * @brief Internal helper to resize the backing file of a file-backed array.
+ * @param array Pointer to dynamic array.
+ * @param new_capacity Desired new capacity.
+ * @return Status code.
+ */
+static dyn_array_status_t dynamic_array_remap(dynamic_array_t *array, size_t new_capacity) {
+    dyn_array_status_t status = dynamic_array_file_status(mapped_file_resize(array->file, new_capacity));
+    if (status != DYN_ARRAY_OK) return status;
+
+    array->data = mapped_file_payload(array->file);
+    array->capacity = new_capacity;
+    PYDS_STAT_ADD(array->stats, reallocs, 1);
+    return DYN_ARRAY_OK;
+}
+
+/**
+ * @brief Internal helper to grow the dynamic array capacity.
+ * @param array Pointer to dynamic array.
+ * @return Status code.
+ */
+static dyn_array_status_t dynamic_array_grow(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    size_t new_capacity = (array->capacity == 0) ? DYN_ARRAY_MIN_CAPACITY : array->capacity * DYN_ARRAY_GROW_FACTOR;
+
+    if (mul_overflow_size_t(new_capacity, sizeof(DYN_ARRAY_TYPE))) {
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+    if (array->shared) return DYN_ARRAY_ERROR_NO_MEMORY;
+    if (array->file) return dynamic_array_remap(array, new_capacity);
+
+    DYN_ARRAY_TYPE *tmp = pyds_realloc(array->data, new_capacity * sizeof(DYN_ARRAY_TYPE));
+    if (!tmp) {
+#ifdef DEBUG
+        fprintf(stderr, "ERROR: realloc failed during grow at %s:%d\n", __FILE__, __LINE__);
+#endif
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+
+    array->data = tmp;
+    array->capacity = new_capacity;
+    PYDS_STAT_ADD(array->stats, reallocs, 1);
+    PYDS_STAT_ALLOC(array->stats, new_capacity * sizeof(DYN_ARRAY_TYPE));
+    return DYN_ARRAY_OK;
+}
+
+/**
+ * @brief Internal helper to reallocate the dynamic array's buffer.
+ *
+ * Ensures the new capacity is not below the minimum allowed, checks for
+ * multiplication overflow, and reallocates the array's internal buffer.
+ *
+ * @param array Pointer to the dynamic array.
+ * @param new_capacity Desired new capacity.
+ * @return DYN_ARRAY_OK on success, or an appropriate error code on failure.
+ */
+static dyn_array_status_t dynamic_array_realloc(dynamic_array_t *array, size_t new_capacity) {
+    if (new_capacity < DYN_ARRAY_MIN_CAPACITY) {
+        new_capacity = DYN_ARRAY_MIN_CAPACITY;
+    }
+
+    if (mul_overflow_size_t(new_capacity, sizeof(DYN_ARRAY_TYPE))) {
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+    // A shared region cannot be resized; it can only satisfy requests that already fit
+    if (array->shared) return new_capacity <= array->capacity ? DYN_ARRAY_OK : DYN_ARRAY_ERROR_NO_MEMORY;
+    if (array->file) return dynamic_array_remap(array, new_capacity);
+
+    DYN_ARRAY_TYPE *tmp = pyds_realloc(array->data, new_capacity * sizeof(DYN_ARRAY_TYPE));
+    if (!tmp) {
+#ifdef DEBUG
+        fprintf(stderr, "Memory allocation failed during realloc at %s:%d\n", __FILE__, __LINE__);
+#endif
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+
+    array->data = tmp;
+    array->capacity = new_capacity;
+    PYDS_STAT_ADD(array->stats, reallocs, 1);
+    PYDS_STAT_ALLOC(array->stats, new_capacity * sizeof(DYN_ARRAY_TYPE));
+    return DYN_ARRAY_OK;
+}
+
+dynamic_array_t* dynamic_array_create(size_t capacity) {
+    dynamic_array_t *array = pyds_malloc(sizeof(dynamic_array_t));
+    if(!array) {
+        return NULL;
+    }
+
+    dyn_array_status_t status = dynamic_array_init(array, capacity);
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(array);
+        return NULL;
+    }
+    return array;
+}
+
+dyn_array_status_t dynamic_array_init(dynamic_array_t *array, size_t capacity) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    if (capacity < DYN_ARRAY_MIN_CAPACITY) {
+        capacity = DYN_ARRAY_MIN_CAPACITY;
+    }
+    array->data = pyds_malloc(capacity * sizeof(DYN_ARRAY_TYPE));
+    if (!array->data) return DYN_ARRAY_ERROR_NO_MEMORY;
+
+    array->file = NULL;
+    array->shared = NULL;
+    array->size = 0;
+    array->capacity = capacity;
+    PYDS_STAT_RESET(array->stats);
+    PYDS_STAT_ALLOC(array->stats, capacity * sizeof(DYN_ARRAY_TYPE));
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    if (pthread_mutex_init(&array->lock, NULL) != 0) {
+        pyds_free(array->data);
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+#endif
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_init_with_value(dynamic_array_t *array, size_t capacity, DYN_ARRAY_TYPE default_value) {
+    dyn_array_status_t status = dynamic_array_init(array, capacity);
+    if (status != DYN_ARRAY_OK) return status;
+
+    for (size_t i = 0; i < capacity; i++) {
+        array->data[i] = default_value;
+    }
+    array->size = capacity;
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_open(dynamic_array_t *array, const char *path, bool verify) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(path, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    mapped_file_t *file = pyds_malloc(sizeof(mapped_file_t));
+    if (!file) return DYN_ARRAY_ERROR_NO_MEMORY;
+
+    dyn_array_status_t status = dynamic_array_file_status(
+        mapped_file_open(file, path, PYDS_CONTAINER_INT_ARRAY, sizeof(DYN_ARRAY_TYPE), DYN_ARRAY_FILE_MIN_CAPACITY, verify));
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(file);
+        return status;
+    }
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    if (pthread_mutex_init(&array->lock, NULL) != 0) {
+        mapped_file_close(file, mapped_file_header(file)->size);
+        pyds_free(file);
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+#endif
+
+    array->file = file;
+    array->shared = NULL;
+    array->data = mapped_file_payload(file);
+    array->size = (size_t)mapped_file_header(file)->size;
+    array->capacity = (size_t)mapped_file_header(file)->capacity;
+    PYDS_STAT_RESET(array->stats);
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_sync(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    if (!array->file) return DYN_ARRAY_OK;
+
+    return dynamic_array_file_status(mapped_file_sync(array->file, array->size));
+}
+
+dyn_array_status_t dynamic_array_attach(dynamic_array_t *array, void *base, size_t length, bool create) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(base, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    shared_region_status_t status = create
+        ? shared_region_init(base, length, PYDS_CONTAINER_INT_ARRAY, sizeof(DYN_ARRAY_TYPE))
+        : shared_region_attach(base, length, PYDS_CONTAINER_INT_ARRAY, sizeof(DYN_ARRAY_TYPE));
+    switch (status) {
+        case SHARED_REGION_OK: break;
+        case SHARED_REGION_ERROR_TOO_SMALL: return DYN_ARRAY_ERROR_NO_MEMORY;
+        case SHARED_REGION_ERROR_MUTEX: return DYN_ARRAY_ERROR_MUTEX;
+        default: return DYN_ARRAY_ERROR_FORMAT;
+    }
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    if (pthread_mutex_init(&array->lock, NULL) != 0) return DYN_ARRAY_ERROR_NO_MEMORY;
+#endif
+
+    pyds_shared_header_t *header = base;
+    array->shared = header;
+    array->file = NULL;
+    array->data = shared_region_payload(header);
+    array->size = (size_t)header->size;
+    array->capacity = (size_t)header->capacity;
+    PYDS_STAT_RESET(array->stats);
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+    return DYN_ARRAY_OK;
+}
+
+void dynamic_array_lock(dynamic_array_t *array) {
+    if (!array || !array->shared) return;
+    shared_region_lock(array->shared);
+    array->size = (size_t)array->shared->size;
+}
+
+void dynamic_array_unlock(dynamic_array_t *array) {
+    if (!array || !array->shared) return;
+    array->shared->size = array->size;
+    shared_region_unlock(array->shared);
+}
+
+dyn_array_status_t dynamic_array_free(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    pthread_mutex_destroy(&array->lock);
+#endif
+
+    if (array->file) {
+        mapped_file_close(array->file, array->size);
+        pyds_free(array->file);
+        array->file = NULL;
+    } else if (array->shared) {
+        array->shared = NULL;
+    } else {
+        pyds_free(array->data);
+    }
+    array->data = NULL;
+    array->size = 0;
+    array->capacity = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_destroy(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    dyn_array_status_t status = dynamic_array_free(array);
+    if (status != DYN_ARRAY_OK) return status;
+    pyds_free(array);
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_clear(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    array->size = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_push_back(dynamic_array_t *array, DYN_ARRAY_TYPE value) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(array->lock);
+#endif
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    if (array->size >= array->capacity) {
+        dyn_array_status_t grow_status = dynamic_array_grow(array);
+        if (grow_status != DYN_ARRAY_OK) {
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+            DYN_ARRAY_UNLOCK(array->lock);
+#endif
+            return grow_status;
+        }
+    }
+    mapped_file_touch(array->file);
+    array->data[array->size++] = value;
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(array->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_pop_back(dynamic_array_t *array, DYN_ARRAY_TYPE* removed) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    if (array->size == 0) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(array->lock);
+#endif
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    array->size--;
+    if (removed) {
+        *removed = array->data[array->size];
+    }
+
+    // File-backed arrays keep their capacity to avoid truncating on every pop
+    if (!array->file && !array->shared && array->capacity > DYN_ARRAY_MIN_CAPACITY &&
+        array->size < array->capacity / DYN_ARRAY_SHRINK_THRESHOLD_DIV) {
+        dynamic_array_realloc(array, array->capacity / DYN_ARRAY_GROW_FACTOR);
+    }
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(array->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_shrink_to_fit(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    if (array->size == array->capacity) return DYN_ARRAY_OK;
+    return dynamic_array_realloc(array, array->size);
+}
+
+dyn_array_status_t dynamic_array_reserve(dynamic_array_t *array, size_t new_capacity) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    if (new_capacity <= array->capacity) return DYN_ARRAY_OK;
+    if (new_capacity < array->size) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+
+    return dynamic_array_realloc(array, new_capacity);
+}
+
+dyn_array_status_t dynamic_array_copy(const dynamic_array_t *src, dynamic_array_t *dst) {
+    CHECK_PTR_RET(src, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(src->data, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(dst, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(dst->data, DYN_ARRAY_ERROR_NULL_POINTER);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(src->lock);
+    DYN_ARRAY_LOCK(dst->lock);
+#endif
+
+    if (dst->capacity < src->size) {
+        dyn_array_status_t status = dynamic_array_realloc(dst, src->capacity);
+        if (status != DYN_ARRAY_OK) {
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+            DYN_ARRAY_UNLOCK(src->lock);
+            DYN_ARRAY_UNLOCK(dst->lock);
+#endif
+            return status;
+        }
+    }
+    memcpy(dst->data, src->data, src->size * sizeof(DYN_ARRAY_TYPE));
+    dst->size = src->size;
+    PYDS_STAT_HIGH_WATER(dst->stats, dst->size);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(src->lock);
+    DYN_ARRAY_UNLOCK(dst->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+size_t dynamic_array_memory_usage(const dynamic_array_t *array) {
+    if (!array) return 0;
+
+    size_t usage = sizeof(dynamic_array_t);
+    if (array->file) usage += sizeof(mapped_file_t);
+    else if (!array->shared) usage += array->capacity * sizeof(DYN_ARRAY_TYPE);
+    return usage;
+}
+
+
+/* Iterator implementation */
+
+dyn_array_status_t dynamic_array_iterator_init(const dynamic_array_t *array, dynamic_array_iterator_t *iterator) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(iterator, DYN_ARRAY_ERROR_NULL_POINTER);
+    iterator->array = array;
+    iterator->current = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_iterator_next(dynamic_array_iterator_t *iterator, DYN_ARRAY_TYPE *out_value, bool *out_has_next) {
+    CHECK_PTR_RET(iterator, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(out_value, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(out_has_next, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    if (iterator->current < iterator->array->size) {
+        *out_value = iterator->array->data[iterator->current++];
+        *out_has_next = true;
+    } else {
+        *out_has_next = false;
+    }
+    return DYN_ARRAY_OK;
+}
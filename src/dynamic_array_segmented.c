@@ -0,0 +1,343 @@
+// dynamic_array_segmented.c
+
+#include "dynamic_array.h"
+#include "alloc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdio.h>  // for debug prints if needed
+
+static const size_t DYN_ARRAY_MIN_CAPACITY = DYN_ARRAY_SEGMENT_BASE;
+static const size_t DYN_ARRAY_SHRINK_THRESHOLD_DIV = 4;
+
+/**
+ * @brief Number of elements held by a segment.
+ * @param segment Segment index in the directory.
+ * @return Segment length in elements.
+ */
+static inline size_t segment_length(size_t segment) {
+    return segment == 0 ? DYN_ARRAY_SEGMENT_BASE : DYN_ARRAY_SEGMENT_BASE << (segment - 1);
+}
+
+/**
+ * @brief Capacity of an array holding the given number of segments.
+ * @param segment_count Number of allocated segments.
+ * @return Total capacity in elements.
+ */
+static inline size_t capacity_for_segments(size_t segment_count) {
+    return segment_count == 0 ? 0 : DYN_ARRAY_SEGMENT_BASE << (segment_count - 1);
+}
+
+/**
+ * @brief Internal helper to append one segment to the directory.
+ *
+ * The new segment is as large as the current capacity, so the capacity
+ * doubles without touching the existing elements.
+ *
+ * @param array Pointer to dynamic array.
+ * @return Status code.
+ */
+static dyn_array_status_t dynamic_array_add_segment(dynamic_array_t *array) {
+    if (array->segment_count >= DYN_ARRAY_MAX_SEGMENTS) return DYN_ARRAY_ERROR_NO_MEMORY;
+
+    size_t length = segment_length(array->segment_count);
+    if (length > SIZE_MAX / sizeof(DYN_ARRAY_TYPE)) return DYN_ARRAY_ERROR_NO_MEMORY;
+
+    DYN_ARRAY_TYPE *segment = pyds_malloc(length * sizeof(DYN_ARRAY_TYPE));
+    if (!segment) {
+#ifdef DEBUG
+        fprintf(stderr, "ERROR: malloc failed during grow at %s:%d\n", __FILE__, __LINE__);
+#endif
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+
+    array->segments[array->segment_count++] = segment;
+    array->capacity = capacity_for_segments(array->segment_count);
+    PYDS_STAT_ADD(array->stats, reallocs, 1);
+    PYDS_STAT_ALLOC(array->stats, length * sizeof(DYN_ARRAY_TYPE));
+    return DYN_ARRAY_OK;
+}
+
+/**
+ * @brief Internal helper to release the last segment of the directory.
+ * @param array Pointer to dynamic array.
+ */
+static void dynamic_array_release_segment(dynamic_array_t *array) {
+    array->segment_count--;
+    pyds_free(array->segments[array->segment_count]);
+    array->segments[array->segment_count] = NULL;
+    array->capacity = capacity_for_segments(array->segment_count);
+}
+
+/**
+ * @brief Internal helper to allocate segments until capacity is reached.
+ * @param array Pointer to dynamic array.
+ * @param capacity Minimum capacity required.
+ * @return Status code.
+ */
+static dyn_array_status_t dynamic_array_reserve_segments(dynamic_array_t *array, size_t capacity) {
+    while (array->capacity < capacity) {
+        dyn_array_status_t status = dynamic_array_add_segment(array);
+        if (status != DYN_ARRAY_OK) return status;
+    }
+    return DYN_ARRAY_OK;
+}
+
+dynamic_array_t* dynamic_array_create(size_t capacity) {
+    dynamic_array_t *array = pyds_malloc(sizeof(dynamic_array_t));
+    if(!array) {
+        return NULL;
+    }
+
+    dyn_array_status_t status = dynamic_array_init(array, capacity);
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(array);
+        return NULL;
+    }
+    return array;
+}
+
+dyn_array_status_t dynamic_array_init(dynamic_array_t *array, size_t capacity) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    if (capacity < DYN_ARRAY_MIN_CAPACITY) {
+        capacity = DYN_ARRAY_MIN_CAPACITY;
+    }
+
+    memset(array->segments, 0, sizeof(array->segments));
+    array->segment_count = 0;
+    array->size = 0;
+    array->capacity = 0;
+    PYDS_STAT_RESET(array->stats);
+
+    dyn_array_status_t status = dynamic_array_reserve_segments(array, capacity);
+    if (status != DYN_ARRAY_OK) {
+        while (array->segment_count > 0) dynamic_array_release_segment(array);
+        return status;
+    }
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    if (pthread_mutex_init(&array->lock, NULL) != 0) {
+        while (array->segment_count > 0) dynamic_array_release_segment(array);
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+#endif
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_init_with_value(dynamic_array_t *array, size_t capacity, DYN_ARRAY_TYPE default_value) {
+    dyn_array_status_t status = dynamic_array_init(array, capacity);
+    if (status != DYN_ARRAY_OK) return status;
+
+    size_t filled = 0;
+    for (size_t s = 0; s < array->segment_count && filled < capacity; s++) {
+        size_t length = segment_length(s);
+        if (length > capacity - filled) length = capacity - filled;
+        for (size_t i = 0; i < length; i++) {
+            array->segments[s][i] = default_value;
+        }
+        filled += length;
+    }
+    array->size = capacity;
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_open(dynamic_array_t *array, const char *path, bool verify) {
+    (void)array; (void)path; (void)verify;
+    // Segments cannot be mapped as one file; use the contiguous variant for persistence
+    return DYN_ARRAY_ERROR_UNSUPPORTED;
+}
+
+dyn_array_status_t dynamic_array_sync(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_attach(dynamic_array_t *array, void *base, size_t length, bool create) {
+    (void)array; (void)base; (void)length; (void)create;
+    // Segment pointers are process-local; shared regions need the contiguous variant
+    return DYN_ARRAY_ERROR_UNSUPPORTED;
+}
+
+void dynamic_array_lock(dynamic_array_t *array) {
+    (void)array;
+}
+
+void dynamic_array_unlock(dynamic_array_t *array) {
+    (void)array;
+}
+
+dyn_array_status_t dynamic_array_free(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    pthread_mutex_destroy(&array->lock);
+#endif
+
+    while (array->segment_count > 0) dynamic_array_release_segment(array);
+    array->size = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_destroy(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    dyn_array_status_t status = dynamic_array_free(array);
+    if (status != DYN_ARRAY_OK) return status;
+    pyds_free(array);
+
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_clear(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    array->size = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_push_back(dynamic_array_t *array, DYN_ARRAY_TYPE value) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(array->lock);
+#endif
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    if (array->size >= array->capacity) {
+        dyn_array_status_t grow_status = dynamic_array_add_segment(array);
+        if (grow_status != DYN_ARRAY_OK) {
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+            DYN_ARRAY_UNLOCK(array->lock);
+#endif
+            return grow_status;
+        }
+    }
+    *dynamic_array_slot(array, array->size++) = value;
+    PYDS_STAT_HIGH_WATER(array->stats, array->size);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(array->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_pop_back(dynamic_array_t *array, DYN_ARRAY_TYPE* removed) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+    if (array->size == 0) return DYN_ARRAY_ERROR_OUT_OF_RANGE;
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(array->lock);
+#endif
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    array->size--;
+    if (removed) {
+        *removed = *dynamic_array_slot(array, array->size);
+    }
+
+    if (array->capacity > DYN_ARRAY_MIN_CAPACITY &&
+        array->size < array->capacity / DYN_ARRAY_SHRINK_THRESHOLD_DIV) {
+        dynamic_array_release_segment(array);
+    }
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(array->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_shrink_to_fit(dynamic_array_t *array) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    while (array->segment_count > 1 && capacity_for_segments(array->segment_count - 1) >= array->size) {
+        dynamic_array_release_segment(array);
+    }
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_reserve(dynamic_array_t *array, size_t new_capacity) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(array->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+    PYDS_STAT_ADD(array->stats, ops, 1);
+    if (new_capacity <= array->capacity) return DYN_ARRAY_OK;
+
+    return dynamic_array_reserve_segments(array, new_capacity);
+}
+
+dyn_array_status_t dynamic_array_copy(const dynamic_array_t *src, dynamic_array_t *dst) {
+    CHECK_PTR_RET(src, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(src->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(dst, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(dst->segments[0], DYN_ARRAY_ERROR_NULL_POINTER);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_LOCK(src->lock);
+    DYN_ARRAY_LOCK(dst->lock);
+#endif
+
+    if (dynamic_array_reserve_segments(dst, src->size) != DYN_ARRAY_OK) {
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+        DYN_ARRAY_UNLOCK(src->lock);
+        DYN_ARRAY_UNLOCK(dst->lock);
+#endif
+        return DYN_ARRAY_ERROR_NO_MEMORY;
+    }
+
+    // Both arrays share the same segment geometry, so segments copy one to one
+    size_t copied = 0;
+    for (size_t s = 0; copied < src->size; s++) {
+        size_t length = segment_length(s);
+        if (length > src->size - copied) length = src->size - copied;
+        memcpy(dst->segments[s], src->segments[s], length * sizeof(DYN_ARRAY_TYPE));
+        copied += length;
+    }
+    dst->size = src->size;
+    PYDS_STAT_HIGH_WATER(dst->stats, dst->size);
+
+#ifdef DYNAMIC_ARRAY_THREAD_SAFE
+    DYN_ARRAY_UNLOCK(src->lock);
+    DYN_ARRAY_UNLOCK(dst->lock);
+#endif
+    return DYN_ARRAY_OK;
+}
+
+size_t dynamic_array_memory_usage(const dynamic_array_t *array) {
+    if (!array) return 0;
+    return sizeof(dynamic_array_t) + array->capacity * sizeof(DYN_ARRAY_TYPE);
+}
+
+
+/* Iterator implementation */
+
+dyn_array_status_t dynamic_array_iterator_init(const dynamic_array_t *array, dynamic_array_iterator_t *iterator) {
+    CHECK_PTR_RET(array, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(iterator, DYN_ARRAY_ERROR_NULL_POINTER);
+    iterator->array = array;
+    iterator->current = 0;
+    return DYN_ARRAY_OK;
+}
+
+dyn_array_status_t dynamic_array_iterator_next(dynamic_array_iterator_t *iterator, DYN_ARRAY_TYPE *out_value, bool *out_has_next) {
+    CHECK_PTR_RET(iterator, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(out_value, DYN_ARRAY_ERROR_NULL_POINTER);
+    CHECK_PTR_RET(out_has_next, DYN_ARRAY_ERROR_NULL_POINTER);
+
+    if (iterator->current < iterator->array->size) {
+        *out_value = *dynamic_array_slot(iterator->array, iterator->current++);
+        *out_has_next = true;
+    } else {
+        *out_has_next = false;
+    }
+    return DYN_ARRAY_OK;
+}
@@ -0,0 +1,182 @@
+// src/event_queue.c
+
+#include <string.h>
+#include "alloc.h"
+#include "event_queue.h"
+
+#define EVENT_QUEUE_ARITY 4
+#define EVENT_QUEUE_INITIAL_CAPACITY 16
+
+static inline int event_queue_less(const event_queue_entry_t* a, const event_queue_entry_t* b) {
+    return a->time < b->time || (a->time == b->time && a->sequence < b->sequence);
+}
+
+static void event_queue_sift_up(event_queue_entry_t* heap, size_t index, event_queue_entry_t entry) {
+    while (index > 0) {
+        size_t parent = (index - 1) / EVENT_QUEUE_ARITY;
+        if (!event_queue_less(&entry, &heap[parent])) break;
+        heap[index] = heap[parent];
+        index = parent;
+    }
+    heap[index] = entry;
+}
+
+static void event_queue_sift_down(event_queue_entry_t* heap, size_t size, size_t index, event_queue_entry_t entry) {
+    while (1) {
+        size_t first = index * EVENT_QUEUE_ARITY + 1;
+        if (first >= size) break;
+
+        size_t last = first + EVENT_QUEUE_ARITY < size ? first + EVENT_QUEUE_ARITY : size;
+        size_t child = first;
+        for (size_t i = child + 1; i < last; i++) {
+            if (event_queue_less(&heap[i], &heap[child])) child = i;
+        }
+        if (!event_queue_less(&heap[child], &entry)) break;
+        heap[index] = heap[child];
+        index = child;
+    }
+    heap[index] = entry;
+}
+
+// Doubles the ring and moves its wrapped part after the old end, so it stays in order
+static char event_queue_grow_ring(event_queue_t* queue) {
+    size_t capacity = queue->ring_capacity * 2;
+    if (capacity > SIZE_MAX / sizeof(event_queue_entry_t)) return 0;
+
+    event_queue_entry_t* ring = pyds_realloc(queue->ring, sizeof(event_queue_entry_t) * capacity);
+    if (!ring) return 0;
+
+    size_t end = queue->ring_head + queue->ring_size;
+    if (end > queue->ring_capacity) {
+        memcpy(ring + queue->ring_capacity, ring, sizeof(event_queue_entry_t) * (end - queue->ring_capacity));
+    }
+    queue->ring = ring;
+    queue->ring_capacity = capacity;
+    return 1;
+}
+
+static char event_queue_grow_heap(event_queue_t* queue) {
+    size_t capacity = queue->heap_capacity * 2;
+    if (capacity > SIZE_MAX / sizeof(event_queue_entry_t)) return 0;
+
+    event_queue_entry_t* heap = pyds_realloc(queue->heap, sizeof(event_queue_entry_t) * capacity);
+    if (!heap) return 0;
+    queue->heap = heap;
+    queue->heap_capacity = capacity;
+    return 1;
+}
+
+static inline const event_queue_entry_t* event_queue_ring_last(const event_queue_t* queue) {
+    return &queue->ring[(queue->ring_head + queue->ring_size - 1) & (queue->ring_capacity - 1)];
+}
+
+// The part holding the next event: 1 for the ring, 2 for the heap, 0 if both are empty
+static inline int event_queue_next_part(const event_queue_t* queue) {
+    if (queue->heap_size == 0) return queue->ring_size > 0;
+    if (queue->ring_size == 0) return 2;
+    return event_queue_less(&queue->heap[0], &queue->ring[queue->ring_head]) ? 2 : 1;
+}
+
+event_queue_t* event_queue_create(void) {
+    event_queue_t* queue = pyds_malloc(sizeof(event_queue_t));
+    if (!queue) return NULL;
+
+    queue->ring_head = 0;
+    queue->ring_size = 0;
+    queue->ring_capacity = EVENT_QUEUE_INITIAL_CAPACITY;
+    queue->heap_size = 0;
+    queue->heap_capacity = EVENT_QUEUE_INITIAL_CAPACITY;
+    queue->next_sequence = 0;
+    queue->ring = pyds_malloc(sizeof(event_queue_entry_t) * EVENT_QUEUE_INITIAL_CAPACITY);
+    queue->heap = pyds_malloc(sizeof(event_queue_entry_t) * EVENT_QUEUE_INITIAL_CAPACITY);
+    if (!queue->ring || !queue->heap) {
+        event_queue_free(queue);
+        return NULL;
+    }
+
+    return queue;
+}
+
+void event_queue_free(event_queue_t* queue) {
+    if (!queue) return;
+    pyds_free(queue->ring);
+    pyds_free(queue->heap);
+    pyds_free(queue);
+}
+
+char event_queue_push(event_queue_t* queue, int64_t time, int64_t id) {
+    event_queue_entry_t entry = {time, queue->next_sequence, id};
+
+    // Its sequence is the largest yet, so an event no earlier than the ring's
+    // last one keeps the ring sorted
+    if (queue->ring_size == 0 || event_queue_ring_last(queue)->time <= time) {
+        if (queue->ring_size == queue->ring_capacity && !event_queue_grow_ring(queue)) return 0;
+        queue->ring[(queue->ring_head + queue->ring_size) & (queue->ring_capacity - 1)] = entry;
+        queue->ring_size++;
+    } else {
+        if (queue->heap_size == queue->heap_capacity && !event_queue_grow_heap(queue)) return 0;
+        event_queue_sift_up(queue->heap, queue->heap_size++, entry);
+    }
+
+    queue->next_sequence++;
+    return 1;
+}
+
+char event_queue_peek(const event_queue_t* queue, event_queue_entry_t* out) {
+    switch (event_queue_next_part(queue)) {
+    case 1:
+        *out = queue->ring[queue->ring_head];
+        return 1;
+    case 2:
+        *out = queue->heap[0];
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+char event_queue_pop(event_queue_t* queue, event_queue_entry_t* out) {
+    switch (event_queue_next_part(queue)) {
+    case 1:
+        if (out) *out = queue->ring[queue->ring_head];
+        queue->ring_head = (queue->ring_head + 1) & (queue->ring_capacity - 1);
+        queue->ring_size--;
+        return 1;
+    case 2:
+        if (out) *out = queue->heap[0];
+        if (--queue->heap_size > 0) {
+            event_queue_sift_down(queue->heap, queue->heap_size, 0, queue->heap[queue->heap_size]);
+        }
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+size_t event_queue_pop_batch(event_queue_t* queue, int64_t* time, int64_t* ids, size_t max) {
+    event_queue_entry_t entry;
+    if (max == 0 || !event_queue_peek(queue, &entry)) return 0;
+
+    *time = entry.time;
+    size_t count = 0;
+    while (count < max && event_queue_peek(queue, &entry) && entry.time == *time) {
+        event_queue_pop(queue, NULL);
+        ids[count++] = entry.id;
+    }
+    return count;
+}
+
+size_t event_queue_size(const event_queue_t* queue) {
+    return queue->ring_size + queue->heap_size;
+}
+
+void event_queue_clear(event_queue_t* queue) {
+    queue->ring_head = 0;
+    queue->ring_size = 0;
+    queue->heap_size = 0;
+}
+
+size_t event_queue_memory_usage(const event_queue_t* queue) {
+    if (!queue) return 0;
+    return sizeof(event_queue_t) + sizeof(event_queue_entry_t) * (queue->ring_capacity + queue->heap_capacity);
+}
@@ -0,0 +1,116 @@
+// src/event_queue.h
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file event_queue.h
+ * @brief Event calendar for discrete-event simulation.
+ *
+ * Events are ordered by (time, sequence): the sequence number counts pushes,
+ * so events at the same time come out in the order they were pushed.
+ *
+ * Simulations mostly schedule events at or after the latest one already
+ * pending, so the queue keeps two parts. Events that do not go back in time
+ * are appended to a sorted ring, which pushes and pops in O(1) from
+ * contiguous memory. The others go into a 4-ary min-heap. Popping takes the
+ * smaller of the ring's head and the heap's root.
+ */
+
+typedef struct {
+    int64_t time;
+    uint64_t sequence;
+    int64_t id;  ///< The caller's opaque event id
+} event_queue_entry_t;
+
+typedef struct {
+    event_queue_entry_t* ring;  ///< Sorted events, head first
+    size_t ring_head;
+    size_t ring_size;
+    size_t ring_capacity;       ///< 0 or a power of two
+    event_queue_entry_t* heap;  ///< 4-ary min-heap of events pushed out of order
+    size_t heap_size;
+    size_t heap_capacity;
+    uint64_t next_sequence;
+} event_queue_t;
+
+/**
+ * @brief Creates an empty event queue.
+ * @return event_queue_t* Pointer to the queue, or NULL on allocation failure.
+ */
+event_queue_t* event_queue_create(void);
+
+/**
+ * @brief Frees the queue.
+ * @param queue Pointer to queue; NULL is ignored.
+ */
+void event_queue_free(event_queue_t* queue);
+
+/**
+ * @brief Adds an event after every pending event with the same time.
+ * @param queue Pointer to queue.
+ * @param time Simulation time of the event.
+ * @param id Opaque event id.
+ * @return 1 on success, 0 on allocation failure.
+ */
+char event_queue_push(event_queue_t* queue, int64_t time, int64_t id);
+
+/**
+ * @brief The next event.
+ * @param queue Pointer to queue.
+ * @param out Receives the event.
+ * @return 1 on success, 0 if the queue is empty.
+ */
+char event_queue_peek(const event_queue_t* queue, event_queue_entry_t* out);
+
+/**
+ * @brief Removes the next event.
+ * @param queue Pointer to queue.
+ * @param out Receives the event; may be NULL.
+ * @return 1 on success, 0 if the queue is empty.
+ */
+char event_queue_pop(event_queue_t* queue, event_queue_entry_t* out);
+
+/**
+ * @brief Removes the next events that share the earliest time, in push order.
+ * @param queue Pointer to queue.
+ * @param time Receives the events' time.
+ * @param ids Receives the ids of up to max events.
+ * @param max Most events to remove.
+ * @return Number of events removed; 0 if the queue is empty. max means more
+ * events at that time may be left.
+ */
+size_t event_queue_pop_batch(event_queue_t* queue, int64_t* time, int64_t* ids, size_t max);
+
+/**
+ * @brief Number of pending events.
+ * @param queue Pointer to queue.
+ * @return Pending events.
+ */
+size_t event_queue_size(const event_queue_t* queue);
+
+/**
+ * @brief Removes every event. Sequence numbers keep counting.
+ * @param queue Pointer to queue.
+ */
+void event_queue_clear(event_queue_t* queue);
+
+/**
+ * @brief Bytes allocated for the queue.
+ * @param queue Pointer to queue.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t event_queue_memory_usage(const event_queue_t* queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_QUEUE_H */
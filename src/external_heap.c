@@ -0,0 +1,425 @@
+// src/external_heap.c
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "alloc.h"
+#include "external_heap.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define external_heap_seek _fseeki64
+#else
+#include <unistd.h>
+#define external_heap_seek fseeko
+#endif
+
+#define EXTERNAL_HEAP_MAX_RUNS 64
+#define EXTERNAL_HEAP_MIN_BLOCK 1024
+#define EXTERNAL_HEAP_MAX_BLOCK (1 << 20)
+
+// Run heads are ordered as keys: the value with its sign bit flipped, so
+// unsigned order matches signed order, above the run's slot
+static inline uint64_t external_heap_key(int32_t value, int slot) {
+    return ((uint64_t)((uint32_t)value ^ 0x80000000u) << 32) | (uint32_t)slot;
+}
+
+static inline int32_t external_heap_key_value(uint64_t key) {
+    return (int32_t)((uint32_t)(key >> 32) ^ 0x80000000u);
+}
+
+static void external_heap_heads_sift_down(external_heap_t* heap, int index) {
+    uint64_t* heads = heap->heads;
+    int count = heap->run_count;
+    uint64_t key = heads[index];
+
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= count) break;
+        if (child + 1 < count && heads[child + 1] < heads[child]) child++;
+        if (key <= heads[child]) break;
+        heads[index] = heads[child];
+        index = child;
+    }
+    heads[index] = key;
+}
+
+static void external_heap_heads_push(external_heap_t* heap, uint64_t key) {
+    uint64_t* heads = heap->heads;
+    int index = heap->run_count++;
+
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (heads[parent] <= key) break;
+        heads[index] = heads[parent];
+        index = parent;
+    }
+    heads[index] = key;
+}
+
+// An unlinked temporary file in directory, or NULL with errno set
+static FILE* external_heap_temp_file(const char* directory) {
+#ifdef _WIN32
+    char* name = _tempnam(directory, "pyds");
+    if (!name) return NULL;
+    FILE* file = fopen(name, "w+bD");  // D: deleted when closed
+    free(name);
+#else
+    static const char template[] = "/pyds-run-XXXXXX";
+    size_t length = strlen(directory);
+    char* path = pyds_malloc(length + sizeof(template));
+    if (!path) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    memcpy(path, directory, length);
+    memcpy(path + length, template, sizeof(template));
+
+    int fd = mkstemp(path);
+    if (fd >= 0) unlink(path);
+    pyds_free(path);
+    if (fd < 0) return NULL;
+
+    FILE* file = fdopen(fd, "w+b");
+    if (!file) {
+        close(fd);
+        return NULL;
+    }
+#endif
+    // Runs are written and read in large blocks; without a stdio buffer a
+    // short fwrite() means the data really did not reach the file
+    if (file) setvbuf(file, NULL, _IONBF, 0);
+    return file;
+}
+
+static int external_heap_free_slot(const external_heap_t* heap) {
+    for (int i = 0; i < heap->slots; i++) {
+        if (!heap->runs[i].file) return i;
+    }
+    return -1;
+}
+
+static void external_heap_close_run(external_heap_run_t* run) {
+    if (run->file) fclose(run->file);
+    pyds_free(run->block);
+    memset(run, 0, sizeof(*run));
+}
+
+// Reads the run's next block. On failure the run is left as it was, so the
+// read can be retried.
+static external_heap_status_t external_heap_refill(external_heap_t* heap, external_heap_run_t* run) {
+    uint64_t left = (run->length - run->offset) / sizeof(int32_t);
+    size_t count = left < heap->block_values ? (size_t)left : heap->block_values;
+
+    errno = 0;
+    if (external_heap_seek(run->file, (long long)run->offset, SEEK_SET) != 0 ||
+        fread(run->block, sizeof(int32_t), count, run->file) != count) {
+        if (!errno) errno = EIO;
+        return EXTERNAL_HEAP_ERROR_IO;
+    }
+
+    run->offset += count * sizeof(int32_t);
+    run->block_size = count;
+    run->block_pos = 0;
+    heap->bytes_read += count * sizeof(int32_t);
+    return EXTERNAL_HEAP_OK;
+}
+
+// Makes the file in slot a run and pushes its head; the file holds length bytes
+static external_heap_status_t external_heap_add_run(external_heap_t* heap, int slot, FILE* file, uint64_t length) {
+    external_heap_run_t* run = &heap->runs[slot];
+    run->file = file;
+    run->length = length;
+    run->offset = 0;
+    run->block = pyds_malloc(sizeof(int32_t) * heap->block_values);
+    if (!run->block) {
+        external_heap_close_run(run);
+        return EXTERNAL_HEAP_ERROR_MEMORY;
+    }
+
+    external_heap_status_t status = external_heap_refill(heap, run);
+    if (status != EXTERNAL_HEAP_OK) {
+        external_heap_close_run(run);
+        return status;
+    }
+    external_heap_heads_push(heap, external_heap_key(run->block[0], slot));
+    return EXTERNAL_HEAP_OK;
+}
+
+// Removes the smallest run head, advancing its run and closing it once it
+// is exhausted. Nothing is removed if the next block cannot be read.
+static external_heap_status_t external_heap_pop_run(external_heap_t* heap, int32_t* value) {
+    uint64_t key = heap->heads[0];
+    external_heap_run_t* run = &heap->runs[(uint32_t)key];
+
+    if (run->block_pos + 1 == run->block_size) {
+        if (run->offset == run->length) {
+            *value = external_heap_key_value(key);
+            external_heap_close_run(run);
+            heap->heads[0] = heap->heads[--heap->run_count];
+            if (heap->run_count > 0) external_heap_heads_sift_down(heap, 0);
+            return EXTERNAL_HEAP_OK;
+        }
+        external_heap_status_t status = external_heap_refill(heap, run);
+        if (status != EXTERNAL_HEAP_OK) return status;
+    } else {
+        run->block_pos++;
+    }
+
+    *value = external_heap_key_value(key);
+    heap->heads[0] = external_heap_key(run->block[run->block_pos], (int)(uint32_t)key);
+    external_heap_heads_sift_down(heap, 0);
+    return EXTERNAL_HEAP_OK;
+}
+
+// Writes count values and counts them; returns the number written
+static size_t external_heap_write(external_heap_t* heap, FILE* file, const int32_t* values, size_t count) {
+    size_t written = fwrite(values, sizeof(int32_t), count, file);
+    heap->bytes_written += written * sizeof(int32_t);
+    return written;
+}
+
+/**
+ * @brief Merges every open run into one, staging the output in the buffer's
+ * array, which is empty after a spill. If a write or read fails, the values
+ * merged so far stay in the partial run or go back into the buffer, sorted
+ * and so in heap order, and the remaining runs stay open.
+ */
+static external_heap_status_t external_heap_merge_runs(external_heap_t* heap) {
+    MinHeap* buffer = heap->buffer;
+    int32_t* staging = (int32_t*)buffer->data;
+    size_t capacity = (size_t)buffer->capacity;
+    size_t staged = 0;
+    uint64_t length = 0;
+    external_heap_status_t status = EXTERNAL_HEAP_OK;
+
+    int slot = external_heap_free_slot(heap);
+    FILE* file = external_heap_temp_file(heap->directory);
+    if (!file) return EXTERNAL_HEAP_ERROR_IO;
+
+    errno = 0;
+    while (status == EXTERNAL_HEAP_OK && heap->run_count > 0) {
+        status = external_heap_pop_run(heap, &staging[staged]);
+        if (status != EXTERNAL_HEAP_OK) break;
+        if (++staged < capacity && heap->run_count > 0) continue;
+
+        size_t written = external_heap_write(heap, file, staging, staged);
+        length += written * sizeof(int32_t);
+        staged -= written;
+        if (staged) {
+            memmove(staging, staging + written, staged * sizeof(int32_t));
+            if (!errno) errno = EIO;
+            status = EXTERNAL_HEAP_ERROR_IO;
+        }
+    }
+    buffer->size = (int)staged;
+
+    if (length == 0) {
+        fclose(file);
+        return status;
+    }
+    external_heap_status_t added = external_heap_add_run(heap, slot, file, length);
+    return status != EXTERNAL_HEAP_OK ? status : added;
+}
+
+#define EXTERNAL_HEAP_SORT_DIGIT(v, shift) ((((uint32_t)(v) ^ 0x80000000u) >> (shift)) & 0xff)
+
+/**
+ * @brief Sorts in place, most significant byte first, permuting each byte's
+ * values into their buckets by swaps (McIlroy, Bostic and McIlroy,
+ * "Engineering radix sort", 1993). Unlike a least significant digit sort
+ * it needs no second array, which the memory budget has no room for.
+ */
+static void external_heap_sort(int32_t* values, size_t count, int shift) {
+    if (count <= 32) {
+        for (size_t i = 1; i < count; i++) {
+            int32_t value = values[i];
+            size_t j = i;
+            for (; j > 0 && values[j - 1] > value; j--) values[j] = values[j - 1];
+            values[j] = value;
+        }
+        return;
+    }
+
+    size_t next[256] = {0}, end[256];
+    for (size_t i = 0; i < count; i++) next[EXTERNAL_HEAP_SORT_DIGIT(values[i], shift)]++;
+    size_t start = 0;
+    for (int b = 0; b < 256; b++) {
+        end[b] = start + next[b];
+        next[b] = start;
+        start = end[b];
+    }
+
+    for (int b = 0; b < 256; b++) {
+        while (next[b] < end[b]) {
+            int32_t value = values[next[b]];
+            unsigned digit = EXTERNAL_HEAP_SORT_DIGIT(value, shift);
+            if (digit == (unsigned)b) {
+                next[b]++;
+                continue;
+            }
+            values[next[b]] = values[next[digit]];
+            values[next[digit]++] = value;
+        }
+    }
+
+    if (shift == 0) return;
+    start = 0;
+    for (int b = 0; b < 256; b++) {
+        external_heap_sort(values + start, end[b] - start, shift - 8);
+        start = end[b];
+    }
+}
+
+/**
+ * @brief Sorts the buffer and writes it out as a run, then merges the runs
+ * if there are max_runs or more. A failed write leaves the values in the
+ * buffer, whose sorted array is still in heap order.
+ */
+static external_heap_status_t external_heap_spill(external_heap_t* heap) {
+    MinHeap* buffer = heap->buffer;
+    size_t count = (size_t)buffer->size;
+
+    // Only a merge that failed earlier leaves no slot free
+    int slot = external_heap_free_slot(heap);
+    if (slot < 0) {
+        errno = EMFILE;
+        return EXTERNAL_HEAP_ERROR_IO;
+    }
+    FILE* file = external_heap_temp_file(heap->directory);
+    if (!file) return EXTERNAL_HEAP_ERROR_IO;
+
+    external_heap_sort((int32_t*)buffer->data, count, 24);
+    errno = 0;
+    if (external_heap_write(heap, file, (int32_t*)buffer->data, count) != count) {
+        if (!errno) errno = EIO;
+        fclose(file);
+        return EXTERNAL_HEAP_ERROR_IO;
+    }
+
+    external_heap_status_t status = external_heap_add_run(heap, slot, file, count * sizeof(int32_t));
+    if (status != EXTERNAL_HEAP_OK) return status;
+    buffer->size = 0;
+
+    if (heap->run_count > heap->max_runs) return external_heap_merge_runs(heap);
+    return EXTERNAL_HEAP_OK;
+}
+
+external_heap_t* external_heap_create(size_t memory_limit, const char* directory) {
+    if (memory_limit < EXTERNAL_HEAP_MIN_MEMORY) memory_limit = EXTERNAL_HEAP_MIN_MEMORY;
+    if (!directory) directory = getenv("TMPDIR");
+#ifdef P_tmpdir
+    if (!directory) directory = P_tmpdir;
+#else
+    if (!directory) directory = ".";
+#endif
+
+    external_heap_t* heap = pyds_malloc(sizeof(external_heap_t));
+    if (!heap) return NULL;
+    memset(heap, 0, sizeof(*heap));
+
+    // Half the budget for the buffer, the rest for up to
+    // EXTERNAL_HEAP_MAX_RUNS blocks of run values
+    size_t blocks = memory_limit - memory_limit / 2;
+    heap->buffer_limit = memory_limit / 2 / sizeof(int32_t);
+    if (heap->buffer_limit > INT_MAX / 2) heap->buffer_limit = INT_MAX / 2;
+    heap->block_values = blocks / sizeof(int32_t) / EXTERNAL_HEAP_MAX_RUNS;
+    if (heap->block_values < EXTERNAL_HEAP_MIN_BLOCK) heap->block_values = EXTERNAL_HEAP_MIN_BLOCK;
+    if (heap->block_values > EXTERNAL_HEAP_MAX_BLOCK) heap->block_values = EXTERNAL_HEAP_MAX_BLOCK;
+    size_t max_runs = blocks / (heap->block_values * sizeof(int32_t));
+    heap->max_runs = max_runs < 2 ? 2 : max_runs > EXTERNAL_HEAP_MAX_RUNS ? EXTERNAL_HEAP_MAX_RUNS : (int)max_runs;
+    heap->slots = heap->max_runs + 2;
+
+    size_t length = strlen(directory);
+    heap->buffer = min_heap_create();
+    heap->runs = pyds_malloc(sizeof(external_heap_run_t) * (size_t)heap->slots);
+    heap->heads = pyds_malloc(sizeof(uint64_t) * (size_t)heap->slots);
+    heap->directory = pyds_malloc(length + 1);
+    if (!heap->buffer || !heap->runs || !heap->heads || !heap->directory) {
+        external_heap_free(heap);
+        return NULL;
+    }
+    memset(heap->runs, 0, sizeof(external_heap_run_t) * (size_t)heap->slots);
+    memcpy(heap->directory, directory, length + 1);
+
+    return heap;
+}
+
+void external_heap_free(external_heap_t* heap) {
+    if (!heap) return;
+    if (heap->runs) {
+        for (int i = 0; i < heap->slots; i++) external_heap_close_run(&heap->runs[i]);
+    }
+    min_heap_free(heap->buffer);
+    pyds_free(heap->runs);
+    pyds_free(heap->heads);
+    pyds_free(heap->directory);
+    pyds_free(heap);
+}
+
+external_heap_status_t external_heap_insert(external_heap_t* heap, int32_t value) {
+    MinHeap* buffer = heap->buffer;
+
+    // Spill instead of growing the buffer past its limit
+    if ((size_t)buffer->size >= heap->buffer_limit ||
+        (buffer->size == buffer->capacity && (size_t)buffer->capacity * 2 > heap->buffer_limit)) {
+        external_heap_status_t status = external_heap_spill(heap);
+        if (status != EXTERNAL_HEAP_OK && buffer->size == buffer->capacity) return status;
+    }
+
+    if (!min_heap_insert(buffer, value)) return EXTERNAL_HEAP_ERROR_MEMORY;
+    heap->size++;
+    return EXTERNAL_HEAP_OK;
+}
+
+external_heap_status_t external_heap_peek(const external_heap_t* heap, int32_t* value) {
+    int top;
+    char buffered = min_heap_peek(heap->buffer, &top);
+
+    if (heap->run_count > 0) {
+        int32_t head = external_heap_key_value(heap->heads[0]);
+        if (!buffered || head < top) {
+            *value = head;
+            return EXTERNAL_HEAP_OK;
+        }
+    }
+    if (!buffered) return EXTERNAL_HEAP_EMPTY;
+    *value = top;
+    return EXTERNAL_HEAP_OK;
+}
+
+external_heap_status_t external_heap_remove(external_heap_t* heap, int32_t* value) {
+    int top;
+    char buffered = min_heap_peek(heap->buffer, &top);
+
+    if (heap->run_count > 0 && (!buffered || external_heap_key_value(heap->heads[0]) < top)) {
+        external_heap_status_t status = external_heap_pop_run(heap, value);
+        if (status != EXTERNAL_HEAP_OK) return status;
+    } else if (buffered) {
+        min_heap_remove(heap->buffer, &top);
+        *value = top;
+    } else {
+        return EXTERNAL_HEAP_EMPTY;
+    }
+
+    heap->size--;
+    return EXTERNAL_HEAP_OK;
+}
+
+size_t external_heap_length(const external_heap_t* heap) {
+    return heap ? heap->size : 0;
+}
+
+size_t external_heap_spilled(const external_heap_t* heap) {
+    return heap ? heap->size - (size_t)heap->buffer->size : 0;
+}
+
+size_t external_heap_memory_usage(const external_heap_t* heap) {
+    if (!heap) return 0;
+
+    size_t usage = sizeof(external_heap_t) + min_heap_memory_usage(heap->buffer) + strlen(heap->directory) + 1;
+    usage += (sizeof(external_heap_run_t) + sizeof(uint64_t)) * (size_t)heap->slots;
+    usage += sizeof(int32_t) * heap->block_values * (size_t)heap->run_count;
+    return usage;
+}
@@ -0,0 +1,139 @@
+// src/external_heap.h
+
+#ifndef EXTERNAL_HEAP_H
+#define EXTERNAL_HEAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "min_heap.h"
+
+/**
+ * @file external_heap.h
+ * @brief Priority queue of int32 values that spills to temporary files.
+ *
+ * New values go into a MinHeap buffer. When the buffer reaches its share of
+ * the memory budget, it is sorted and written out as one run, a temporary
+ * file that is already unlinked (or deleted on close on Windows). Each run
+ * is read back one block at a time, and a small heap of run heads picks the
+ * smallest; removing a value compares that head with the buffer's minimum,
+ * so the runs are merged lazily, as values are removed.
+ *
+ * Runs are written in one sequential write and read in large blocks. Once
+ * max_runs runs are open, the next spill also merges them into a single run,
+ * which bounds both the open files and the block memory.
+ */
+
+#define EXTERNAL_HEAP_MIN_MEMORY (64 * 1024)  ///< Smallest memory budget in bytes
+
+/**
+ * @brief Status codes returned by external heap functions.
+ * I/O failures leave the cause in errno.
+ */
+typedef enum {
+    EXTERNAL_HEAP_OK = 0,
+    EXTERNAL_HEAP_EMPTY,           ///< Nothing to peek or remove
+    EXTERNAL_HEAP_ERROR_MEMORY,    ///< An allocation failed
+    EXTERNAL_HEAP_ERROR_IO,        ///< A temporary file could not be created, written or read, see errno
+} external_heap_status_t;
+
+/**
+ * @brief One sorted run in a temporary file.
+ */
+typedef struct {
+    FILE* file;             ///< Temporary file, or NULL for a free slot
+    uint64_t offset;        ///< Bytes of the file read into blocks so far
+    uint64_t length;        ///< Bytes in the file
+    int32_t* block;         ///< Values read from the file, block_values at most
+    size_t block_size;      ///< Values in block
+    size_t block_pos;       ///< Index of the run's head in block
+} external_heap_run_t;
+
+typedef struct {
+    MinHeap* buffer;            ///< Values not spilled yet
+    size_t buffer_limit;        ///< Values the buffer holds before it spills
+    size_t block_values;        ///< Values read from a run at a time
+    int max_runs;               ///< Runs kept open before a spill merges them
+    int run_count;              ///< Open runs
+    int slots;                  ///< Entries in runs and heads
+    external_heap_run_t* runs;  ///< Run slots; a spill and a merge may briefly use two more than max_runs
+    uint64_t* heads;            ///< Binary heap of the runs' head keys, run_count entries
+    size_t size;                ///< Values in the buffer and the runs
+    char* directory;            ///< Directory for the temporary files
+    uint64_t bytes_written;     ///< Bytes written to runs, merges included
+    uint64_t bytes_read;        ///< Bytes read back from runs
+} external_heap_t;
+
+/**
+ * @brief Creates an empty heap.
+ * @param memory_limit Budget in bytes for the buffer and the run blocks, at
+ * least EXTERNAL_HEAP_MIN_MEMORY. Half goes to the buffer.
+ * @param directory Directory for the temporary files, or NULL for $TMPDIR,
+ * falling back to the system's temporary directory.
+ * @return external_heap_t* Pointer to the heap, or NULL on allocation failure.
+ */
+external_heap_t* external_heap_create(size_t memory_limit, const char* directory);
+
+/**
+ * @brief Frees the heap and closes its runs, which removes their files.
+ * @param heap Pointer to heap; NULL is ignored.
+ */
+void external_heap_free(external_heap_t* heap);
+
+/**
+ * @brief Adds a value, first spilling the buffer if it is at its limit.
+ * @param heap Pointer to heap.
+ * @param value Value to add.
+ * @return EXTERNAL_HEAP_OK, or an error with the value not added and the
+ * heap unchanged.
+ */
+external_heap_status_t external_heap_insert(external_heap_t* heap, int32_t value);
+
+/**
+ * @brief Reads the smallest value.
+ * @param heap Pointer to heap.
+ * @param value Receives the value.
+ * @return EXTERNAL_HEAP_OK or EXTERNAL_HEAP_EMPTY.
+ */
+external_heap_status_t external_heap_peek(const external_heap_t* heap, int32_t* value);
+
+/**
+ * @brief Removes the smallest value, reading the next block of its run if needed.
+ * @param heap Pointer to heap.
+ * @param value Receives the value.
+ * @return EXTERNAL_HEAP_OK, EXTERNAL_HEAP_EMPTY, or EXTERNAL_HEAP_ERROR_IO
+ * with nothing removed.
+ */
+external_heap_status_t external_heap_remove(external_heap_t* heap, int32_t* value);
+
+/**
+ * @brief Number of values in the heap.
+ * @param heap Pointer to heap.
+ * @return Values in the buffer and the runs.
+ */
+size_t external_heap_length(const external_heap_t* heap);
+
+/**
+ * @brief Number of values in the runs rather than in memory.
+ * @param heap Pointer to heap.
+ * @return Values not yet removed from the runs.
+ */
+size_t external_heap_spilled(const external_heap_t* heap);
+
+/**
+ * @brief Bytes allocated for the heap, its buffer and its run blocks; the
+ * files are not counted.
+ * @param heap Pointer to heap.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t external_heap_memory_usage(const external_heap_t* heap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXTERNAL_HEAP_H */
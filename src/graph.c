@@ -0,0 +1,199 @@
+// src/graph.c
+
+#include "alloc.h"
+#include "graph.h"
+
+#define GRAPH_HEAP_ARITY 4
+
+// Workspace positions below 0
+#define GRAPH_UNSEEN (-1)  // Never queued
+#define GRAPH_DONE (-2)    // Settled, or taken into the forest
+
+static inline void graph_heap_place(graph_workspace_t* workspace, int32_t index, graph_heap_entry_t entry) {
+    workspace->heap[index] = entry;
+    workspace->positions[entry.vertex] = index;
+}
+
+static void graph_heap_sift_up(graph_workspace_t* workspace, int32_t index, graph_heap_entry_t entry) {
+    while (index > 0) {
+        int32_t parent = (index - 1) / GRAPH_HEAP_ARITY;
+        if (workspace->heap[parent].key <= entry.key) break;
+        graph_heap_place(workspace, index, workspace->heap[parent]);
+        index = parent;
+    }
+    graph_heap_place(workspace, index, entry);
+}
+
+static void graph_heap_sift_down(graph_workspace_t* workspace, int32_t index, graph_heap_entry_t entry) {
+    graph_heap_entry_t* heap = workspace->heap;
+    int32_t size = workspace->size;
+
+    while (1) {
+        int64_t first = (int64_t)index * GRAPH_HEAP_ARITY + 1;
+        if (first >= size) break;
+
+        int32_t last = first + GRAPH_HEAP_ARITY < size ? (int32_t)first + GRAPH_HEAP_ARITY : size;
+        int32_t child = (int32_t)first;
+        for (int32_t i = child + 1; i < last; i++) {
+            if (heap[i].key < heap[child].key) child = i;
+        }
+        if (entry.key <= heap[child].key) break;
+        graph_heap_place(workspace, index, heap[child]);
+        index = child;
+    }
+    graph_heap_place(workspace, index, entry);
+}
+
+// Queues vertex with key, or lowers the key of a queued vertex
+static inline void graph_heap_update(graph_workspace_t* workspace, int32_t vertex, int64_t key) {
+    graph_heap_entry_t entry = {key, vertex};
+    int32_t position = workspace->positions[vertex];
+    graph_heap_sift_up(workspace, position >= 0 ? position : workspace->size++, entry);
+}
+
+static inline graph_heap_entry_t graph_heap_pop(graph_workspace_t* workspace) {
+    graph_heap_entry_t top = workspace->heap[0];
+    workspace->positions[top.vertex] = GRAPH_DONE;
+    if (--workspace->size > 0) graph_heap_sift_down(workspace, 0, workspace->heap[workspace->size]);
+    return top;
+}
+
+// The edges of u, clamped to the edge arrays
+static inline void graph_edges(const graph_csr_t* graph, int32_t u, size_t* begin, size_t* end) {
+    int32_t first = graph->indptr[u];
+    int32_t last = graph->indptr[u + 1];
+    *begin = first < 0 ? 0 : (size_t)first;
+    *end = last < 0 ? 0 : (size_t)last;
+    if (*end > graph->edge_count) *end = graph->edge_count;
+}
+
+graph_status_t graph_check(const graph_csr_t* graph, size_t* where) {
+    int32_t previous = 0;
+    for (int32_t u = 0; u <= graph->vertex_count; u++) {
+        int32_t offset = graph->indptr[u];
+        if (offset < previous || (size_t)offset > graph->edge_count) {
+            if (where) *where = (size_t)u;
+            return GRAPH_ERROR_INDPTR;
+        }
+        previous = offset;
+    }
+
+    for (size_t e = (size_t)graph->indptr[0]; e < (size_t)previous; e++) {
+        if (graph->indices[e] < 0 || graph->indices[e] >= graph->vertex_count) {
+            if (where) *where = e;
+            return GRAPH_ERROR_INDEX;
+        }
+        if (graph->weights[e] < 0) {
+            if (where) *where = e;
+            return GRAPH_ERROR_WEIGHT;
+        }
+    }
+    return GRAPH_OK;
+}
+
+graph_workspace_t* graph_workspace_create(int32_t vertex_count) {
+    if (vertex_count < 0) return NULL;
+
+    graph_workspace_t* workspace = pyds_malloc(sizeof(graph_workspace_t));
+    if (!workspace) return NULL;
+
+    size_t count = vertex_count > 0 ? (size_t)vertex_count : 1;
+    workspace->vertex_count = vertex_count;
+    workspace->size = 0;
+    workspace->heap = pyds_malloc(sizeof(graph_heap_entry_t) * count);
+    workspace->positions = pyds_malloc(sizeof(int32_t) * count);
+    if (!workspace->heap || !workspace->positions) {
+        graph_workspace_free(workspace);
+        return NULL;
+    }
+
+    return workspace;
+}
+
+void graph_workspace_free(graph_workspace_t* workspace) {
+    if (!workspace) return;
+    pyds_free(workspace->heap);
+    pyds_free(workspace->positions);
+    pyds_free(workspace);
+}
+
+int64_t graph_shortest_paths(const graph_csr_t* graph, graph_workspace_t* workspace, int32_t source, int32_t target,
+                             const int32_t* heuristic, int64_t* distances, int32_t* predecessors) {
+    int32_t n = graph->vertex_count;
+    for (int32_t v = 0; v < n; v++) {
+        distances[v] = GRAPH_UNREACHED;
+        predecessors[v] = GRAPH_NO_VERTEX;
+        workspace->positions[v] = GRAPH_UNSEEN;
+    }
+    workspace->size = 0;
+
+    distances[source] = 0;
+    graph_heap_update(workspace, source, heuristic ? heuristic[source] : 0);
+
+    while (workspace->size > 0) {
+        int32_t u = graph_heap_pop(workspace).vertex;
+        if (u == target) return distances[u];
+
+        int64_t distance = distances[u];
+        size_t begin, end;
+        graph_edges(graph, u, &begin, &end);
+        for (size_t e = begin; e < end; e++) {
+            int32_t v = graph->indices[e];
+            int32_t weight = graph->weights[e];
+            if ((uint32_t)v >= (uint32_t)n || weight < 0) continue;
+
+            // Settled vertices only improve under an inconsistent heuristic,
+            // and are then queued again
+            int64_t candidate = distance + weight;
+            if (distances[v] != GRAPH_UNREACHED && distances[v] <= candidate) continue;
+            distances[v] = candidate;
+            predecessors[v] = u;
+            graph_heap_update(workspace, v, heuristic ? candidate + heuristic[v] : candidate);
+        }
+    }
+
+    return target == GRAPH_NO_VERTEX ? 0 : GRAPH_UNREACHED;
+}
+
+int64_t graph_prim(const graph_csr_t* graph, graph_workspace_t* workspace, int32_t root, int32_t* predecessors) {
+    int32_t n = graph->vertex_count;
+    for (int32_t v = 0; v < n; v++) {
+        predecessors[v] = GRAPH_NO_VERTEX;
+        workspace->positions[v] = GRAPH_UNSEEN;
+    }
+    workspace->size = 0;
+
+    // Each tree's key is the weight of the edge that brought a vertex in
+    int64_t total = 0;
+    int32_t next_root = 0;
+    while (1) {
+        graph_heap_update(workspace, root, 0);
+        while (workspace->size > 0) {
+            graph_heap_entry_t top = graph_heap_pop(workspace);
+            total += top.key;
+
+            size_t begin, end;
+            graph_edges(graph, top.vertex, &begin, &end);
+            for (size_t e = begin; e < end; e++) {
+                int32_t v = graph->indices[e];
+                int32_t weight = graph->weights[e];
+                if ((uint32_t)v >= (uint32_t)n || weight < 0) continue;
+
+                int32_t position = workspace->positions[v];
+                if (position == GRAPH_DONE || (position >= 0 && workspace->heap[position].key <= weight)) continue;
+                predecessors[v] = top.vertex;
+                graph_heap_update(workspace, v, weight);
+            }
+        }
+
+        while (next_root < n && workspace->positions[next_root] == GRAPH_DONE) next_root++;
+        if (next_root == n) return total;
+        root = next_root;
+    }
+}
+
+size_t graph_workspace_memory_usage(const graph_workspace_t* workspace) {
+    if (!workspace) return 0;
+    size_t count = workspace->vertex_count > 0 ? (size_t)workspace->vertex_count : 1;
+    return sizeof(graph_workspace_t) + (sizeof(graph_heap_entry_t) + sizeof(int32_t)) * count;
+}
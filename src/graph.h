@@ -0,0 +1,130 @@
+// src/graph.h
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file graph.h
+ * @brief Shortest paths and minimum spanning forests over CSR graphs.
+ *
+ * A graph is three caller-owned int32 arrays in compressed sparse row form:
+ * the edges leaving vertex u are indices[indptr[u]] to indices[indptr[u+1]-1]
+ * with the matching weights. The kernels only read them and check every
+ * edge as they go, so arrays changed after graph_check() give wrong answers
+ * but never read out of bounds.
+ *
+ * The kernels share an indexed 4-ary min-heap: each vertex records its heap
+ * position, so a shorter path found to a queued vertex lowers its key in
+ * place instead of queueing a duplicate. Its arrays live in a workspace that
+ * one thread reuses across runs.
+ */
+
+#define GRAPH_UNREACHED (-1)   ///< Distance of a vertex no path reaches
+#define GRAPH_NO_VERTEX (-1)   ///< Predecessor of a source, a root or an unreached vertex
+
+typedef struct {
+    int32_t vertex_count;
+    const int32_t* indptr;   ///< vertex_count + 1 offsets into indices and weights
+    const int32_t* indices;  ///< Target vertex of each edge
+    const int32_t* weights;  ///< Non-negative weight of each edge
+    size_t edge_count;       ///< Length of indices and weights
+} graph_csr_t;
+
+typedef enum {
+    GRAPH_OK = 0,
+    GRAPH_ERROR_INDPTR,  ///< indptr is negative, decreasing or past edge_count
+    GRAPH_ERROR_INDEX,   ///< An edge leads outside [0, vertex_count)
+    GRAPH_ERROR_WEIGHT,  ///< An edge weight is negative
+} graph_status_t;
+
+typedef struct {
+    int64_t key;
+    int32_t vertex;
+} graph_heap_entry_t;
+
+typedef struct {
+    int32_t vertex_count;
+    int32_t size;
+    graph_heap_entry_t* heap;
+    int32_t* positions;  ///< Per vertex: heap index, or a GRAPH_* state below 0
+} graph_workspace_t;
+
+/**
+ * @brief Checks that every edge of the graph is well formed.
+ * @param graph Graph to check.
+ * @param where Receives the offending vertex for GRAPH_ERROR_INDPTR, or
+ * edge otherwise; may be NULL.
+ * @return GRAPH_OK, or the first problem found.
+ */
+graph_status_t graph_check(const graph_csr_t* graph, size_t* where);
+
+/**
+ * @brief Creates a workspace for graphs of up to vertex_count vertices.
+ * @return graph_workspace_t* Pointer to the workspace, or NULL on allocation failure.
+ */
+graph_workspace_t* graph_workspace_create(int32_t vertex_count);
+
+/**
+ * @brief Frees the workspace.
+ * @param workspace Pointer to workspace; NULL is ignored.
+ */
+void graph_workspace_free(graph_workspace_t* workspace);
+
+/**
+ * @brief Dijkstra from source, or A* towards target.
+ *
+ * Without a target every reachable vertex is settled. With one, the search
+ * stops once the target is settled, and a heuristic steers it: heuristic[v]
+ * is a lower bound on the distance from v to the target. An admissible but
+ * inconsistent heuristic still finds a shortest path, by reopening
+ * vertices.
+ *
+ * @param graph Graph to search.
+ * @param workspace Workspace for at least graph->vertex_count vertices.
+ * @param source Start vertex, in [0, vertex_count).
+ * @param target Vertex to stop at, or GRAPH_NO_VERTEX.
+ * @param heuristic vertex_count lower bounds, or NULL for none.
+ * @param distances Receives vertex_count distances from source, or
+ * GRAPH_UNREACHED. After an early stop, vertices the search did not settle
+ * hold an upper bound or GRAPH_UNREACHED.
+ * @param predecessors Receives vertex_count predecessors on a shortest
+ * path, or GRAPH_NO_VERTEX.
+ * @return Distance to target, or GRAPH_UNREACHED; 0 without a target.
+ */
+int64_t graph_shortest_paths(const graph_csr_t* graph, graph_workspace_t* workspace, int32_t source, int32_t target,
+                             const int32_t* heuristic, int64_t* distances, int32_t* predecessors);
+
+/**
+ * @brief Prim's minimum spanning forest of an undirected graph.
+ *
+ * The graph must list every edge in both directions. The first tree grows
+ * from root and each later one from the lowest vertex not yet reached.
+ *
+ * @param graph Graph, symmetric.
+ * @param workspace Workspace for at least graph->vertex_count vertices.
+ * @param root First root, in [0, vertex_count).
+ * @param predecessors Receives each vertex's parent in its tree, or
+ * GRAPH_NO_VERTEX for the roots.
+ * @return Total weight of the forest.
+ */
+int64_t graph_prim(const graph_csr_t* graph, graph_workspace_t* workspace, int32_t root, int32_t* predecessors);
+
+/**
+ * @brief Bytes allocated for the workspace.
+ * @param workspace Pointer to workspace.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t graph_workspace_memory_usage(const graph_workspace_t* workspace);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GRAPH_H */
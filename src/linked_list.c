@@ -1,10 +1,12 @@
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #include <assert.h>
+#include "alloc.h"
 #include "linked_list.h"
 
 LinkedList* linked_list_create(void) {
-    LinkedList* ll = calloc(1, sizeof(LinkedList));
+    LinkedList* ll = pyds_calloc(1, sizeof(LinkedList));
     return ll;  // calloc zeroes the fields
 }
 
@@ -14,32 +16,36 @@ void linked_list_free(LinkedList* ll) {
     Node* current = ll->head;
     while (current) {
         Node* next = current->next;
-        free(current);
+        pyds_free(current);
         current = next;
     }
-    free(ll);
+    pyds_free(ll);
 }
 
 bool linked_list_prepend(LinkedList* ll, int value) {
     if (!ll) return false;
 
-    Node* new_node = malloc(sizeof(Node));
+    PYDS_STAT_ADD(ll->stats, ops, 1);
+    Node* new_node = pyds_malloc(sizeof(Node));
     if (!new_node) return false;
+    PYDS_STAT_ALLOC(ll->stats, sizeof(Node));
 
     new_node->value = value;
     new_node->next = ll->head;
     ll->head = new_node;
     ll->size++;
+    PYDS_STAT_HIGH_WATER(ll->stats, ll->size);
     return true;
 }
 
 bool linked_list_pop(LinkedList* ll, int* removed) {
     if (!ll || !ll->head || !removed) return false;
 
+    PYDS_STAT_ADD(ll->stats, ops, 1);
     Node* first = ll->head;
     *removed = first->value;
     ll->head = first->next;
-    free(first);
+    pyds_free(first);
     ll->size--;
     return true;
 }
@@ -51,6 +57,42 @@ bool linked_list_peek(const LinkedList* ll, int* peeked) {
     return true;
 }
 
+void linked_list_reverse(LinkedList* ll) {
+    if (!ll) return;
+
+    PYDS_STAT_ADD(ll->stats, ops, 1);
+    PYDS_STAT_ADD(ll->stats, steps, ll->size);
+    Node* previous = NULL;
+    Node* current = ll->head;
+    while (current) {
+        Node* next = current->next;
+        current->next = previous;
+        previous = current;
+        current = next;
+    }
+    ll->head = previous;
+}
+
 int linked_list_length(const LinkedList* ll) {
     return ll ? ll->size : 0;
 }
+
+void linked_list_get_stats(const LinkedList* ll, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (ll) *out = ll->stats;
+#else
+    (void)ll;
+#endif
+}
+
+void linked_list_reset_stats(LinkedList* ll) {
+    if (!ll) return;
+    PYDS_STAT_RESET(ll->stats);
+    PYDS_STAT_HIGH_WATER(ll->stats, ll->size);
+}
+
+size_t linked_list_memory_usage(const LinkedList* ll) {
+    if (!ll) return 0;
+    return sizeof(LinkedList) + sizeof(Node) * (size_t)ll->size;
+}
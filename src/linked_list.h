@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 #include <stdbool.h>  // For 'bool' return types
+#include "stats.h"
 
 /**
  * @file linked_list.h
@@ -28,6 +29,9 @@ typedef struct Node {
 typedef struct {
     Node* head; ///< Pointer to the first node
     int size;   ///< Number of elements in the list
+#ifdef PYDS_STATS
+    pyds_stats_t stats; ///< Operation counters
+#endif
 } LinkedList;
 
 /**
@@ -67,6 +71,12 @@ bool linked_list_pop(LinkedList* ll, int* removed);
  */
 bool linked_list_peek(const LinkedList* ll, int* peeked);
 
+/**
+ * @brief Reverses the order of the list in place.
+ * @param ll Pointer to the list. Safe to pass NULL.
+ */
+void linked_list_reverse(LinkedList* ll);
+
 /**
  * @brief Returns the number of elements in the list.
  * @param ll Pointer to the list.
@@ -74,6 +84,29 @@ bool linked_list_peek(const LinkedList* ll, int* peeked);
  */
 int linked_list_length(const LinkedList* ll);
 
+/**
+ * @brief Bytes allocated for the list and its nodes.
+ * @param ll Pointer to the list.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t linked_list_memory_usage(const LinkedList* ll);
+
+/**
+ * @brief Copies the operation counters of a PYDS_STATS build.
+ *
+ * prepend, pop and reverse count as operations; the const peek does not.
+ *
+ * @param ll Pointer to the list.
+ * @param out Receives the counters; all zero when built without PYDS_STATS.
+ */
+void linked_list_get_stats(const LinkedList* ll, pyds_stats_t* out);
+
+/**
+ * @brief Zeroes the operation counters; high_water restarts at the current size.
+ * @param ll Pointer to the list.
+ */
+void linked_list_reset_stats(LinkedList* ll);
+
 #ifdef __cplusplus
 }
 #endif
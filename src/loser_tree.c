@@ -0,0 +1,129 @@
+// src/loser_tree.c
+
+#include <string.h>
+#include "alloc.h"
+#include "loser_tree.h"
+
+#define LOSER_TREE_DONE_BIT (UINT64_C(1) << 63)
+#define LOSER_TREE_RUN_BITS 31
+
+static inline uint64_t loser_tree_key(int32_t value, int run) {
+    return ((uint64_t)((uint32_t)value ^ 0x80000000u) << LOSER_TREE_RUN_BITS) | (uint32_t)run;
+}
+
+static inline int32_t loser_tree_value(uint64_t key) {
+    return (int32_t)((uint32_t)(key >> LOSER_TREE_RUN_BITS) ^ 0x80000000u);
+}
+
+static inline int loser_tree_run(uint64_t key) {
+    return (int)(key & LOSER_TREE_MAX_RUNS);
+}
+
+// Key of the next value of run, or a done key that loses to every value
+static inline uint64_t loser_tree_head(const loser_tree_t* tree, int run) {
+    const int32_t* head = tree->heads[run];
+    return head < tree->ends[run] ? loser_tree_key(*head, run) : LOSER_TREE_DONE_BIT | (uint32_t)run;
+}
+
+static inline size_t loser_tree_size(int count) {
+    size_t slots = count > 0 ? (size_t)count : 1;
+    return sizeof(loser_tree_t) + slots * (2 * sizeof(int32_t*) + sizeof(uint64_t));
+}
+
+/**
+ * @brief Plays every match once, bottom-up. Leaf i is node count + i, so
+ * node n plays the winners of nodes 2n and 2n + 1.
+ */
+static int loser_tree_build(loser_tree_t* tree) {
+    int count = tree->count;
+    if (count <= 1) {
+        tree->nodes[0] = count ? loser_tree_head(tree, 0) : LOSER_TREE_DONE_BIT;
+        return 1;
+    }
+
+    uint64_t* winners = pyds_malloc(sizeof(uint64_t) * 2 * (size_t)count);
+    if (!winners) return 0;
+
+    for (int i = 0; i < count; i++) winners[count + i] = loser_tree_head(tree, i);
+    for (int n = count - 1; n > 0; n--) {
+        uint64_t a = winners[2 * n], b = winners[2 * n + 1];
+        winners[n] = a < b ? a : b;
+        tree->nodes[n] = a < b ? b : a;
+    }
+    tree->nodes[0] = winners[1];
+
+    pyds_free(winners);
+    return 1;
+}
+
+loser_tree_t* loser_tree_create(const int32_t* const* runs, const size_t* lengths, int count) {
+    if (count < 0 || count > LOSER_TREE_MAX_RUNS) return NULL;
+
+    // One block: the pointer arrays, then the nodes
+    size_t slots = count > 0 ? (size_t)count : 1;
+    loser_tree_t* tree = pyds_malloc(loser_tree_size(count));
+    if (!tree) return NULL;
+
+    tree->count = count;
+    tree->remaining = 0;
+    tree->heads = (const int32_t**)(tree + 1);
+    tree->ends = tree->heads + slots;
+    tree->nodes = (uint64_t*)(tree->ends + slots);
+
+    for (int i = 0; i < count; i++) {
+        tree->heads[i] = runs[i];
+        tree->ends[i] = lengths[i] ? runs[i] + lengths[i] : runs[i];
+        tree->remaining += lengths[i];
+    }
+
+    if (!loser_tree_build(tree)) {
+        pyds_free(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+void loser_tree_free(loser_tree_t* tree) {
+    pyds_free(tree);
+}
+
+size_t loser_tree_merge(loser_tree_t* tree, int32_t* out, size_t capacity) {
+    size_t written = 0;
+    if (!tree || tree->remaining == 0) return 0;
+
+    int count = tree->count;
+    uint64_t* nodes = tree->nodes;
+
+    // A single run has no matches to play
+    if (count == 1) {
+        written = capacity < tree->remaining ? capacity : tree->remaining;
+        memcpy(out, tree->heads[0], written * sizeof(int32_t));
+        tree->heads[0] += written;
+        tree->remaining -= written;
+        return written;
+    }
+
+    uint64_t key = nodes[0];
+    while (written < capacity && !(key & LOSER_TREE_DONE_BIT)) {
+        out[written++] = loser_tree_value(key);
+
+        int run = loser_tree_run(key);
+        tree->heads[run]++;
+        key = loser_tree_head(tree, run);
+
+        // Replay the run's path; the smaller key moves up each level
+        for (int n = (count + run) >> 1; n > 0; n >>= 1) {
+            uint64_t loser = nodes[n];
+            nodes[n] = loser < key ? key : loser;
+            key = loser < key ? loser : key;
+        }
+    }
+    nodes[0] = key;
+    tree->remaining -= written;
+    return written;
+}
+
+size_t loser_tree_memory_usage(const loser_tree_t* tree) {
+    if (!tree) return 0;
+    return loser_tree_size(tree->count);
+}
@@ -0,0 +1,77 @@
+#ifndef LOSER_TREE_H
+#define LOSER_TREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file loser_tree.h
+ * @brief K-way merge of sorted int32 runs with a tournament loser tree.
+ *
+ * Each internal node keeps the loser of the match played there, and
+ * the overall winner sits above the root. Taking the winner's next value
+ * replays only the matches on its path to the root: one comparison per
+ * level, log2(k) in all, where a binary heap needs two per level to pick
+ * the smaller child.
+ *
+ * The nodes hold 64-bit keys rather than run indices, so a match is one
+ * load and one compare. A key packs, from the top bit down: a done flag
+ * for an exhausted run, the value with its sign bit flipped so unsigned
+ * order matches signed order, and the run index. Equal values therefore
+ * leave in run order, which makes the merge stable.
+ *
+ * The tree reads the runs in place; the caller keeps them alive and
+ * unchanged until it frees the tree.
+ */
+
+#define LOSER_TREE_MAX_RUNS 0x7fffffff
+
+typedef struct {
+    int count;               ///< Number of runs
+    size_t remaining;        ///< Values not merged yet
+    const int32_t** heads;   ///< Next unread value of each run
+    const int32_t** ends;    ///< End of each run
+    uint64_t* nodes;         ///< nodes[0] is the winner's key, nodes[1..count-1] the losers'
+} loser_tree_t;
+
+/**
+ * @brief Creates a tree over count sorted runs.
+ * @param runs Start of each run; may be NULL where the length is 0.
+ * @param lengths Number of values in each run.
+ * @param count Number of runs, 0 to LOSER_TREE_MAX_RUNS.
+ * @return loser_tree_t* Pointer to the tree, or NULL on allocation failure.
+ */
+loser_tree_t* loser_tree_create(const int32_t* const* runs, const size_t* lengths, int count);
+
+/**
+ * @brief Frees the tree, but not the runs.
+ * @param tree Pointer to tree; NULL is ignored.
+ */
+void loser_tree_free(loser_tree_t* tree);
+
+/**
+ * @brief Writes the next values in ascending order.
+ * @param tree Pointer to tree.
+ * @param out Buffer for the values.
+ * @param capacity Most values to write.
+ * @return Number of values written; less than capacity only once the runs
+ * are exhausted.
+ */
+size_t loser_tree_merge(loser_tree_t* tree, int32_t* out, size_t capacity);
+
+/**
+ * @brief Bytes allocated for the tree; the runs are not counted.
+ * @param tree Pointer to tree.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t loser_tree_memory_usage(const loser_tree_t* tree);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOSER_TREE_H */
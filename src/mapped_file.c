@@ -0,0 +1,202 @@
+// src/mapped_file.c
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // mremap
+#endif
+
+#include <string.h>
+#include <errno.h>
+#include "mapped_file.h"
+
+#define PYDS_CHECKSUM_SEED 0xcbf29ce484222325ULL
+#define PYDS_CHECKSUM_PRIME 0x100000001b3ULL
+
+uint64_t pyds_checksum(const void* data, size_t length) {
+    const unsigned char* bytes = data;
+    uint64_t hash = PYDS_CHECKSUM_SEED;
+
+    // FNV-1a over 64-bit words keeps the hash close to memory bandwidth
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * PYDS_CHECKSUM_PRIME;
+    }
+    for (; i < length; i++) {
+        hash = (hash ^ bytes[i]) * PYDS_CHECKSUM_PRIME;
+    }
+    return hash;
+}
+
+#ifdef _WIN32
+
+mapped_file_status_t mapped_file_open(mapped_file_t* file, const char* path, pyds_container_t type,
+                                      size_t element_size, size_t min_capacity, bool verify) {
+    (void)file; (void)path; (void)type; (void)element_size; (void)min_capacity; (void)verify;
+    return MAPPED_FILE_ERROR_UNSUPPORTED;
+}
+
+mapped_file_status_t mapped_file_resize(mapped_file_t* file, size_t capacity) {
+    (void)file; (void)capacity;
+    return MAPPED_FILE_ERROR_UNSUPPORTED;
+}
+
+mapped_file_status_t mapped_file_sync(mapped_file_t* file, size_t size) {
+    (void)file; (void)size;
+    return MAPPED_FILE_ERROR_UNSUPPORTED;
+}
+
+void mapped_file_close(mapped_file_t* file, size_t size) {
+    (void)file; (void)size;
+}
+
+#else
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief File length needed for a given capacity, or 0 on overflow.
+ */
+static size_t mapped_file_length(size_t capacity, size_t element_size) {
+    if (element_size != 0 && capacity > (SIZE_MAX - sizeof(pyds_file_header_t)) / element_size) return 0;
+    return sizeof(pyds_file_header_t) + capacity * element_size;
+}
+
+/**
+ * @brief Store size and checksum in the header of an open mapping.
+ */
+static void mapped_file_write_header(mapped_file_t* file, size_t size) {
+    pyds_file_header_t* header = mapped_file_header(file);
+    header->size = size;
+    header->checksum = pyds_checksum(mapped_file_payload(file), size * header->element_size);
+    file->dirty = false;
+}
+
+static mapped_file_status_t mapped_file_fail(mapped_file_t* file, mapped_file_status_t status) {
+    int saved_errno = errno;
+    if (file->base && file->base != MAP_FAILED) munmap(file->base, file->length);
+    if (file->fd >= 0) close(file->fd);
+    file->base = NULL;
+    file->fd = -1;
+    file->length = 0;
+    errno = saved_errno;
+    return status;
+}
+
+mapped_file_status_t mapped_file_open(mapped_file_t* file, const char* path, pyds_container_t type,
+                                      size_t element_size, size_t min_capacity, bool verify) {
+    if (!file || !path || element_size == 0) {
+        errno = EINVAL;
+        return MAPPED_FILE_ERROR_IO;
+    }
+    file->base = NULL;
+    file->length = 0;
+    file->dirty = false;
+
+    file->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (file->fd < 0) return MAPPED_FILE_ERROR_IO;
+
+    struct stat st;
+    if (fstat(file->fd, &st) != 0) return mapped_file_fail(file, MAPPED_FILE_ERROR_IO);
+
+    bool created = (st.st_size == 0);
+    if (created) {
+        file->length = mapped_file_length(min_capacity, element_size);
+        if (file->length == 0) {
+            errno = EOVERFLOW;
+            return mapped_file_fail(file, MAPPED_FILE_ERROR_IO);
+        }
+        if (ftruncate(file->fd, (off_t)file->length) != 0) return mapped_file_fail(file, MAPPED_FILE_ERROR_IO);
+    } else {
+        if ((size_t)st.st_size < sizeof(pyds_file_header_t)) {
+            errno = EINVAL;
+            return mapped_file_fail(file, MAPPED_FILE_ERROR_FORMAT);
+        }
+        file->length = (size_t)st.st_size;
+    }
+
+    file->base = mmap(NULL, file->length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+    if (file->base == MAP_FAILED) return mapped_file_fail(file, MAPPED_FILE_ERROR_IO);
+
+    pyds_file_header_t* header = mapped_file_header(file);
+    if (created) {
+        memset(header, 0, sizeof(*header));
+        header->magic = PYDS_FILE_MAGIC;
+        header->version = PYDS_FILE_VERSION;
+        header->type = (uint16_t)type;
+        header->element_size = (uint32_t)element_size;
+        header->capacity = min_capacity;
+        mapped_file_write_header(file, 0);
+        return MAPPED_FILE_OK;
+    }
+
+    if (header->magic != PYDS_FILE_MAGIC || header->version != PYDS_FILE_VERSION ||
+        header->type != (uint16_t)type || header->element_size != element_size ||
+        header->size > header->capacity ||
+        mapped_file_length(header->capacity, element_size) == 0 ||
+        mapped_file_length(header->capacity, element_size) > file->length) {
+        errno = EINVAL;
+        return mapped_file_fail(file, MAPPED_FILE_ERROR_FORMAT);
+    }
+
+    if (verify &&
+        pyds_checksum(mapped_file_payload(file), header->size * element_size) != header->checksum) {
+        errno = EILSEQ;
+        return mapped_file_fail(file, MAPPED_FILE_ERROR_CHECKSUM);
+    }
+
+    return MAPPED_FILE_OK;
+}
+
+mapped_file_status_t mapped_file_resize(mapped_file_t* file, size_t capacity) {
+    pyds_file_header_t* header = mapped_file_header(file);
+    size_t length = mapped_file_length(capacity, header->element_size);
+    if (length == 0) {
+        errno = EOVERFLOW;
+        return MAPPED_FILE_ERROR_IO;
+    }
+
+    // Grow the file before the mapping, shrink the mapping before the file
+    if (length > file->length && ftruncate(file->fd, (off_t)length) != 0) return MAPPED_FILE_ERROR_IO;
+
+#ifdef __linux__
+    void* base = mremap(file->base, file->length, length, MREMAP_MAYMOVE);
+    if (base == MAP_FAILED) return MAPPED_FILE_ERROR_IO;
+#else
+    void* base = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+    if (base == MAP_FAILED) return MAPPED_FILE_ERROR_IO;
+    munmap(file->base, file->length);
+#endif
+
+    if (length < file->length && ftruncate(file->fd, (off_t)length) != 0) {
+        file->base = base;
+        file->length = length;
+        return MAPPED_FILE_ERROR_IO;
+    }
+
+    file->base = base;
+    file->length = length;
+    mapped_file_header(file)->capacity = capacity;
+    return MAPPED_FILE_OK;
+}
+
+mapped_file_status_t mapped_file_sync(mapped_file_t* file, size_t size) {
+    mapped_file_write_header(file, size);
+    if (msync(file->base, file->length, MS_SYNC) != 0) return MAPPED_FILE_ERROR_IO;
+    return MAPPED_FILE_OK;
+}
+
+void mapped_file_close(mapped_file_t* file, size_t size) {
+    if (!file || !file->base) return;
+    if (file->dirty || mapped_file_header(file)->size != size) mapped_file_write_header(file, size);
+    munmap(file->base, file->length);
+    close(file->fd);
+    file->base = NULL;
+    file->fd = -1;
+    file->length = 0;
+}
+
+#endif
@@ -0,0 +1,155 @@
+// src/mapped_file.h
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @file mapped_file.h
+ * @brief Memory-mapped file storage with a small versioned header.
+ *
+ * The file starts with a pyds_file_header_t followed by the raw element
+ * payload. The payload is stored in host byte order so it can be used in
+ * place; a byte-swapped magic identifies files written on another
+ * architecture.
+ */
+
+#define PYDS_FILE_MAGIC 0x53445950u /**< "PYDS" when read little-endian */
+#define PYDS_FILE_VERSION 1
+
+/**
+ * @brief Container type tags stored in file and stream headers.
+ */
+typedef enum {
+    PYDS_CONTAINER_INT_ARRAY = 1,
+    PYDS_CONTAINER_MIN_HEAP = 2,
+    PYDS_CONTAINER_DLLIST = 3,
+    PYDS_CONTAINER_LINKED_LIST = 4,
+    PYDS_CONTAINER_MONOTONIC_INCREASING_STACK = 5,
+    PYDS_CONTAINER_DEQUE = 6,
+} pyds_container_t;
+
+/**
+ * @brief On-disk header, padded to 64 bytes so the payload stays aligned.
+ */
+typedef struct {
+    uint32_t magic;        ///< PYDS_FILE_MAGIC
+    uint16_t version;      ///< PYDS_FILE_VERSION
+    uint16_t type;         ///< pyds_container_t
+    uint32_t element_size; ///< Size of one element in bytes
+    uint32_t reserved;
+    uint64_t size;         ///< Number of elements in use at the last sync
+    uint64_t capacity;     ///< Number of elements the payload can hold
+    uint64_t checksum;     ///< pyds_checksum of the first size elements at the last sync
+    uint64_t padding[3];
+} pyds_file_header_t;
+
+/**
+ * @brief Status codes returned by mapped file functions.
+ * I/O failures leave the cause in errno.
+ */
+typedef enum {
+    MAPPED_FILE_OK = 0,
+    MAPPED_FILE_ERROR_IO,          ///< A system call failed, see errno
+    MAPPED_FILE_ERROR_FORMAT,      ///< Bad magic, version, type or size
+    MAPPED_FILE_ERROR_CHECKSUM,    ///< Payload does not match the stored checksum
+    MAPPED_FILE_ERROR_UNSUPPORTED, ///< Memory mapping is not available
+} mapped_file_status_t;
+
+/**
+ * @brief An open mapping of a container file.
+ */
+typedef struct {
+    int fd;        ///< File descriptor
+    void* base;    ///< Start of the mapping (the header)
+    size_t length; ///< Mapping length in bytes
+    bool dirty;    ///< Payload changed since the header checksum was written
+} mapped_file_t;
+
+/**
+ * @brief Open or create a container file and map it read-write.
+ *
+ * An empty or missing file is initialized with a header and room for
+ * min_capacity elements. An existing file is mapped as is: opening costs
+ * the same regardless of its size unless verify is set.
+ *
+ * @param file Mapping to initialize.
+ * @param path Path of the file.
+ * @param type Expected container type.
+ * @param element_size Expected element size in bytes.
+ * @param min_capacity Capacity of a newly created file.
+ * @param verify Check the payload against the stored checksum.
+ * @return Status code.
+ */
+mapped_file_status_t mapped_file_open(mapped_file_t* file, const char* path, pyds_container_t type,
+                                      size_t element_size, size_t min_capacity, bool verify);
+
+/**
+ * @brief Resize the file and its mapping to hold capacity elements.
+ * The mapping may move; callers must reload mapped_file_payload().
+ * @param file Open mapping.
+ * @param capacity New capacity in elements.
+ * @return Status code.
+ */
+mapped_file_status_t mapped_file_resize(mapped_file_t* file, size_t capacity);
+
+/**
+ * @brief Record the element count and checksum, then flush the mapping to disk.
+ * @param file Open mapping.
+ * @param size Number of elements in use.
+ * @return Status code.
+ */
+mapped_file_status_t mapped_file_sync(mapped_file_t* file, size_t size);
+
+/**
+ * @brief Record the element count and checksum, then unmap and close the file.
+ * The checksum is only recomputed if the mapping is dirty or the count changed.
+ * Dirty pages are written back by the kernel; use mapped_file_sync() for durability.
+ * @param file Open mapping.
+ * @param size Number of elements in use.
+ */
+void mapped_file_close(mapped_file_t* file, size_t size);
+
+/**
+ * @brief Checksum used for the payload of container files.
+ * @param data Bytes to hash.
+ * @param length Number of bytes.
+ * @return 64-bit checksum.
+ */
+uint64_t pyds_checksum(const void* data, size_t length);
+
+/**
+ * @brief Header of an open mapping.
+ */
+static inline pyds_file_header_t* mapped_file_header(const mapped_file_t* file) {
+    return (pyds_file_header_t*)file->base;
+}
+
+/**
+ * @brief Start of the element payload of an open mapping.
+ */
+static inline void* mapped_file_payload(const mapped_file_t* file) {
+    return (char*)file->base + sizeof(pyds_file_header_t);
+}
+
+/**
+ * @brief Mark the payload as changed, so closing recomputes the checksum.
+ * Containers call this from every path that writes the payload.
+ * @param file Open mapping, or NULL for containers in heap memory.
+ */
+static inline void mapped_file_touch(mapped_file_t* file) {
+    if (file) file->dirty = true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAPPED_FILE_H
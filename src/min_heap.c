@@ -1,24 +1,44 @@
 // src/min_heap.c
 
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "alloc.h"
 #include "min_heap.h"
 
 #define MIN_HEAP_INITIAL_CAPACITY 3
+#define MIN_HEAP_FILE_INITIAL_CAPACITY 1024
 
-static void min_heap_sift_up(MinHeap* min_heap, int index) {
+#if defined(__GNUC__)
+#define MIN_HEAP_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define MIN_HEAP_ALWAYS_INLINE inline
+#endif
+
+// Payloads of keyed heaps move with their keys. Each sift is instantiated
+// with keyed as a constant, so plain heaps run the same loop as before.
+static MIN_HEAP_ALWAYS_INLINE void min_heap_sift_up_impl(MinHeap* min_heap, int index, const int keyed) {
     int value = min_heap->data[index];
+    void** payloads = min_heap->payloads;
+    void* payload = keyed ? payloads[index] : NULL;
     while (index > 0) {
         int parent = (index - 1) / 2;
+        PYDS_STAT_ADD(min_heap->stats, comparisons, 1);
         if (min_heap->data[parent] <= value) break;
         min_heap->data[index] = min_heap->data[parent];
+        if (keyed) payloads[index] = payloads[parent];
+        PYDS_STAT_ADD(min_heap->stats, moves, 1);
         index = parent;
     }
     min_heap->data[index] = value;
+    if (keyed) payloads[index] = payload;
 }
 
-static void min_heap_sift_down(MinHeap* min_heap, int index) {
+static MIN_HEAP_ALWAYS_INLINE void min_heap_sift_down_impl(MinHeap* min_heap, int index, const int keyed) {
     int value = min_heap->data[index];
     int size = min_heap->size;
+    void** payloads = min_heap->payloads;
+    void* payload = keyed ? payloads[index] : NULL;
 
     while (1) {
         int left = 2 * index + 1;
@@ -27,46 +47,211 @@ static void min_heap_sift_down(MinHeap* min_heap, int index) {
 
         if (left < size && min_heap->data[left] < min_heap->data[smallest]) smallest = left;
         if (right < size && min_heap->data[right] < min_heap->data[smallest]) smallest = right;
+        PYDS_STAT_ADD(min_heap->stats, comparisons, (left < size) + (right < size));
         if (smallest == index) break;
 
         min_heap->data[index] = min_heap->data[smallest];
         min_heap->data[smallest] = value;
+        if (keyed) {
+            payloads[index] = payloads[smallest];
+            payloads[smallest] = payload;
+        }
+        PYDS_STAT_ADD(min_heap->stats, moves, 1);
         index = smallest;
     }
 }
 
+static void min_heap_sift_up(MinHeap* min_heap, int index) {
+    if (min_heap->payloads) min_heap_sift_up_impl(min_heap, index, 1);
+    else min_heap_sift_up_impl(min_heap, index, 0);
+}
+
+static void min_heap_sift_down(MinHeap* min_heap, int index) {
+    if (min_heap->payloads) min_heap_sift_down_impl(min_heap, index, 1);
+    else min_heap_sift_down_impl(min_heap, index, 0);
+}
+
+static char min_heap_grow(MinHeap* min_heap) {
+    int new_capacity = min_heap->capacity > 0 ? min_heap->capacity * 2 : MIN_HEAP_INITIAL_CAPACITY;
+
+    if (min_heap->shared) return 0;
+
+    if (min_heap->file) {
+        if (mapped_file_resize(min_heap->file, (size_t)new_capacity) != MAPPED_FILE_OK) return 0;
+        min_heap->data = mapped_file_payload(min_heap->file);
+        min_heap->capacity = new_capacity;
+        PYDS_STAT_ADD(min_heap->stats, reallocs, 1);
+        return 1;
+    }
+
+    int* new_data = pyds_realloc(min_heap->data, sizeof(int) * new_capacity);
+    if (!new_data) return 0;
+    min_heap->data = new_data;
+
+    if (min_heap->payloads) {
+        void** new_payloads = pyds_realloc(min_heap->payloads, sizeof(void*) * new_capacity);
+        if (!new_payloads) return 0;
+        min_heap->payloads = new_payloads;
+        PYDS_STAT_ALLOC(min_heap->stats, sizeof(void*) * new_capacity);
+    }
+
+    min_heap->capacity = new_capacity;
+    PYDS_STAT_ADD(min_heap->stats, reallocs, 1);
+    PYDS_STAT_ALLOC(min_heap->stats, sizeof(int) * new_capacity);
+    return 1;
+}
+
 MinHeap* min_heap_create() {
-    MinHeap* min_heap = malloc(sizeof(MinHeap));
+    MinHeap* min_heap = pyds_malloc(sizeof(MinHeap));
     if(!min_heap) return NULL;
 
-    min_heap->data = malloc(sizeof(int) * MIN_HEAP_INITIAL_CAPACITY);
+    min_heap->data = pyds_malloc(sizeof(int) * MIN_HEAP_INITIAL_CAPACITY);
     if(!min_heap->data) {
-        free(min_heap);
+        pyds_free(min_heap);
         return NULL;
     }
 
+    min_heap->payloads = NULL;
     min_heap->capacity = MIN_HEAP_INITIAL_CAPACITY;
     min_heap->size = 0;
+    min_heap->file = NULL;
+    min_heap->shared = NULL;
+    PYDS_STAT_RESET(min_heap->stats);
+    PYDS_STAT_ALLOC(min_heap->stats, sizeof(int) * MIN_HEAP_INITIAL_CAPACITY);
 
     return min_heap;
 }
 
-MinHeap* min_heap_heapify(int* arr, int length) {
-    MinHeap* min_heap = malloc(sizeof(MinHeap));
+MinHeap* min_heap_create_keyed() {
+    MinHeap* min_heap = min_heap_create();
+    if (!min_heap) return NULL;
+
+    min_heap->payloads = pyds_malloc(sizeof(void*) * MIN_HEAP_INITIAL_CAPACITY);
+    if (!min_heap->payloads) {
+        min_heap_free(min_heap);
+        return NULL;
+    }
+    PYDS_STAT_ALLOC(min_heap->stats, sizeof(void*) * MIN_HEAP_INITIAL_CAPACITY);
+
+    return min_heap;
+}
+
+MinHeap* min_heap_open(const char* path, char verify, mapped_file_status_t* status) {
+    MinHeap* min_heap = pyds_malloc(sizeof(MinHeap));
+    mapped_file_t* file = pyds_malloc(sizeof(mapped_file_t));
+    if (!min_heap || !file) {
+        pyds_free(min_heap);
+        pyds_free(file);
+        if (status) *status = MAPPED_FILE_ERROR_IO;
+        return NULL;
+    }
+
+    mapped_file_status_t open_status = mapped_file_open(file, path, PYDS_CONTAINER_MIN_HEAP, sizeof(int),
+                                                        MIN_HEAP_FILE_INITIAL_CAPACITY, verify);
+    if (status) *status = open_status;
+    if (open_status != MAPPED_FILE_OK) {
+        pyds_free(min_heap);
+        pyds_free(file);
+        return NULL;
+    }
+
+    min_heap->file = file;
+    min_heap->shared = NULL;
+    min_heap->data = mapped_file_payload(file);
+    min_heap->payloads = NULL;
+    min_heap->size = (int)mapped_file_header(file)->size;
+    min_heap->capacity = (int)mapped_file_header(file)->capacity;
+    PYDS_STAT_RESET(min_heap->stats);
+    PYDS_STAT_HIGH_WATER(min_heap->stats, min_heap->size);
+
+    return min_heap;
+}
+
+char min_heap_sync(MinHeap* min_heap) {
+    if (!min_heap) return 0;
+    if (!min_heap->file) return 1;
+
+    return mapped_file_sync(min_heap->file, min_heap->size) == MAPPED_FILE_OK;
+}
+
+MinHeap* min_heap_attach(void* base, size_t length, char create, shared_region_status_t* status) {
+    shared_region_status_t attach_status = create
+        ? shared_region_init(base, length, PYDS_CONTAINER_MIN_HEAP, sizeof(int))
+        : shared_region_attach(base, length, PYDS_CONTAINER_MIN_HEAP, sizeof(int));
+    if (status) *status = attach_status;
+    if (attach_status != SHARED_REGION_OK) return NULL;
+
+    MinHeap* min_heap = pyds_malloc(sizeof(MinHeap));
+    if (!min_heap) return NULL;
+
+    pyds_shared_header_t* header = base;
+    uint64_t capacity = header->capacity < INT_MAX ? header->capacity : INT_MAX;
+
+    min_heap->shared = header;
+    min_heap->file = NULL;
+    min_heap->data = shared_region_payload(header);
+    min_heap->payloads = NULL;
+    min_heap->size = (int)header->size;
+    min_heap->capacity = (int)capacity;
+    PYDS_STAT_RESET(min_heap->stats);
+    PYDS_STAT_HIGH_WATER(min_heap->stats, min_heap->size);
+
+    return min_heap;
+}
+
+void min_heap_lock(MinHeap* min_heap) {
+    if (!min_heap || !min_heap->shared) return;
+    shared_region_lock(min_heap->shared);
+    min_heap->size = (int)min_heap->shared->size;
+}
+
+void min_heap_unlock(MinHeap* min_heap) {
+    if (!min_heap || !min_heap->shared) return;
+    min_heap->shared->size = (uint64_t)min_heap->size;
+    shared_region_unlock(min_heap->shared);
+}
+
+// Copies arr, and payloads when it is not NULL, into a new heap that the
+// caller then puts in heap order
+static MinHeap* min_heap_copy(int* arr, void** payloads, int length) {
+    MinHeap* min_heap = pyds_malloc(sizeof(MinHeap));
     if(!min_heap) return NULL;
 
-    min_heap->data = malloc(sizeof(int) * length);
+    min_heap->data = pyds_malloc(sizeof(int) * length);
     if(!min_heap->data) {
-        free(min_heap);
+        pyds_free(min_heap);
         return NULL;
     }
 
+    min_heap->payloads = NULL;
+    if (payloads) {
+        min_heap->payloads = pyds_malloc(sizeof(void*) * length);
+        if (!min_heap->payloads) {
+            pyds_free(min_heap->data);
+            pyds_free(min_heap);
+            return NULL;
+        }
+    }
+
     for (int i = 0; i < length; i++) {
         min_heap->data[i] = arr[i];
+        if (payloads) min_heap->payloads[i] = payloads[i];
     }
 
     min_heap->size = length;
     min_heap->capacity = length;
+    min_heap->file = NULL;
+    min_heap->shared = NULL;
+    PYDS_STAT_RESET(min_heap->stats);
+    PYDS_STAT_ALLOC(min_heap->stats, (payloads ? sizeof(int) + sizeof(void*) : sizeof(int)) * length);
+    PYDS_STAT_HIGH_WATER(min_heap->stats, length);
+
+    return min_heap;
+}
+
+static MinHeap* min_heap_build(int* arr, void** payloads, int length) {
+    MinHeap* min_heap = min_heap_copy(arr, payloads, length);
+    if (!min_heap) return NULL;
 
     for (int i = (length - 2) / 2; i >= 0; i--) {
         min_heap_sift_down(min_heap, i);
@@ -75,68 +260,338 @@ MinHeap* min_heap_heapify(int* arr, int length) {
     return min_heap;
 }
 
-void min_heap_free(MinHeap* min_heap) {
-    if (!min_heap) return;
-    free(min_heap->data);
-    free(min_heap);
+MinHeap* min_heap_heapify(int* arr, int length) {
+    return min_heap_build(arr, NULL, length);
 }
 
-void min_heap_insert(MinHeap* min_heap, int value) {
+MinHeap* min_heap_heapify_keyed(int* keys, void** payloads, int length) {
+    return min_heap_build(keys, payloads, length);
+}
+
+void min_heap_free(MinHeap* min_heap) {
     if (!min_heap) return;
+    if (min_heap->file) {
+        mapped_file_close(min_heap->file, min_heap->size);
+        pyds_free(min_heap->file);
+    } else if (!min_heap->shared) {
+        pyds_free(min_heap->data);
+    }
+    pyds_free(min_heap->payloads);
+    pyds_free(min_heap);
+}
 
-    if (min_heap->size == min_heap->capacity) {
-        int new_capacity = min_heap->capacity * 2;
-        int* new_data = realloc(min_heap->data, sizeof(int) * new_capacity);
-        if (!new_data) return;
+char min_heap_insert_keyed(MinHeap* min_heap, int key, void* payload) {
+    if (!min_heap) return 0;
 
-        min_heap->data = new_data;
-        min_heap->capacity = new_capacity;
-    }
+    PYDS_STAT_ADD(min_heap->stats, ops, 1);
+    if (min_heap->size == min_heap->capacity && !min_heap_grow(min_heap)) return 0;
 
-    min_heap->data[min_heap->size] = value;
+    mapped_file_touch(min_heap->file);
+    min_heap->data[min_heap->size] = key;
+    if (min_heap->payloads) min_heap->payloads[min_heap->size] = payload;
     min_heap_sift_up(min_heap, min_heap->size);
     min_heap->size++;
+    PYDS_STAT_HIGH_WATER(min_heap->stats, min_heap->size);
+    return 1;
 }
 
-char min_heap_remove(MinHeap* min_heap, int* removed) {
+char min_heap_insert(MinHeap* min_heap, int value) {
+    return min_heap_insert_keyed(min_heap, value, NULL);
+}
+
+char min_heap_remove_keyed(MinHeap* min_heap, int* removed_key, void** removed_payload) {
     if (!min_heap) return 0;
+    PYDS_STAT_ADD(min_heap->stats, ops, 1);
     if (min_heap->size == 0) return 0;
 
-    *removed = min_heap->data[0];
-    min_heap->data[0] = min_heap->data[--min_heap->size];
+    mapped_file_touch(min_heap->file);
+    *removed_key = min_heap->data[0];
+    min_heap->size--;
+    min_heap->data[0] = min_heap->data[min_heap->size];
+    if (min_heap->payloads) {
+        if (removed_payload) *removed_payload = min_heap->payloads[0];
+        min_heap->payloads[0] = min_heap->payloads[min_heap->size];
+    } else if (removed_payload) {
+        *removed_payload = NULL;
+    }
     min_heap_sift_down(min_heap, 0);
 
     return 1;
 }
 
-char min_heap_peek(MinHeap* min_heap, int* peek) {
+char min_heap_remove(MinHeap* min_heap, int* removed) {
+    return min_heap_remove_keyed(min_heap, removed, NULL);
+}
+
+char min_heap_peek_keyed(MinHeap* min_heap, int* key, void** payload) {
     if (!min_heap) return 0;
+    PYDS_STAT_ADD(min_heap->stats, ops, 1);
     if (min_heap->size == 0) return 0;
 
-    *peek = min_heap->data[0];
+    *key = min_heap->data[0];
+    if (payload) *payload = min_heap->payloads ? min_heap->payloads[0] : NULL;
 
     return 1;
 }
 
-char min_heap_pushpop(MinHeap* min_heap, int value, int* removed) {
+char min_heap_peek(MinHeap* min_heap, int* peek) {
+    return min_heap_peek_keyed(min_heap, peek, NULL);
+}
+
+char min_heap_pushpop_keyed(MinHeap* min_heap, int key, void* payload, int* removed_key, void** removed_payload) {
     if (!min_heap || min_heap->size == 0) {
-        *removed = value;
+        *removed_key = key;
+        if (removed_payload) *removed_payload = payload;
         return 1;
     }
 
-    if (value <= min_heap->data[0]) {
-        *removed = value;
+    PYDS_STAT_ADD(min_heap->stats, ops, 1);
+    PYDS_STAT_ADD(min_heap->stats, comparisons, 1);
+    if (key <= min_heap->data[0]) {
+        *removed_key = key;
+        if (removed_payload) *removed_payload = payload;
         return 1;
     }
 
-    *removed = min_heap->data[0];
-    min_heap->data[0] = value;
+    mapped_file_touch(min_heap->file);
+    *removed_key = min_heap->data[0];
+    min_heap->data[0] = key;
+    if (min_heap->payloads) {
+        if (removed_payload) *removed_payload = min_heap->payloads[0];
+        min_heap->payloads[0] = payload;
+    } else if (removed_payload) {
+        *removed_payload = NULL;
+    }
     min_heap_sift_down(min_heap, 0);
 
     return 1;
 }
 
+char min_heap_pushpop(MinHeap* min_heap, int value, int* removed) {
+    return min_heap_pushpop_keyed(min_heap, value, NULL, removed, NULL);
+}
+
 int min_heap_length(MinHeap* min_heap) {
     if (!min_heap) return 0;
     return min_heap->size;
-}
\ No newline at end of file
+}
+
+void min_heap_get_stats(const MinHeap* min_heap, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (min_heap) *out = min_heap->stats;
+#else
+    (void)min_heap;
+#endif
+}
+
+void min_heap_reset_stats(MinHeap* min_heap) {
+    if (!min_heap) return;
+    PYDS_STAT_RESET(min_heap->stats);
+    PYDS_STAT_HIGH_WATER(min_heap->stats, min_heap->size);
+}
+
+size_t min_heap_memory_usage(const MinHeap* min_heap) {
+    if (!min_heap) return 0;
+
+    size_t usage = sizeof(MinHeap);
+    if (min_heap->file) usage += sizeof(mapped_file_t);
+    else if (!min_heap->shared) usage += sizeof(int) * (size_t)min_heap->capacity;
+    if (min_heap->payloads) usage += sizeof(void*) * (size_t)min_heap->capacity;
+    return usage;
+}
+
+// Min-max heap: the same array, where nodes on even levels (the root is
+// level 0) are the smallest of their subtree and nodes on odd levels the
+// largest. Atkinson, Sack, Santoro and Strothotte, "Min-max heaps and
+// generalized priority queues" (CACM 1986).
+
+static inline int min_max_heap_is_min_level(int index) {
+#if defined(__GNUC__)
+    return ((31 - __builtin_clz((unsigned)index + 1)) & 1) == 0;
+#else
+    int level = 0;
+    for (unsigned n = (unsigned)index + 1; n > 1; n >>= 1) level++;
+    return (level & 1) == 0;
+#endif
+}
+
+// less is 1 on min levels and 0 on max levels: the node at index moves up
+// past grandparents it should precede
+static inline void min_max_heap_bubble_up(MinHeap* heap, int index, const int less) {
+    int value = heap->data[index];
+    while (index > 2) {
+        int grandparent = ((index - 1) / 2 - 1) / 2;
+        int other = heap->data[grandparent];
+        PYDS_STAT_ADD(heap->stats, comparisons, 1);
+        if (less ? value >= other : value <= other) break;
+        heap->data[index] = other;
+        PYDS_STAT_ADD(heap->stats, moves, 1);
+        index = grandparent;
+    }
+    heap->data[index] = value;
+}
+
+static void min_max_heap_sift_up(MinHeap* heap, int index) {
+    if (index == 0) return;
+
+    int parent = (index - 1) / 2;
+    int value = heap->data[index];
+    PYDS_STAT_ADD(heap->stats, comparisons, 1);
+    if (min_max_heap_is_min_level(index)) {
+        if (value > heap->data[parent]) {
+            heap->data[index] = heap->data[parent];
+            heap->data[parent] = value;
+            PYDS_STAT_ADD(heap->stats, moves, 1);
+            min_max_heap_bubble_up(heap, parent, 0);
+        } else {
+            min_max_heap_bubble_up(heap, index, 1);
+        }
+    } else {
+        if (value < heap->data[parent]) {
+            heap->data[index] = heap->data[parent];
+            heap->data[parent] = value;
+            PYDS_STAT_ADD(heap->stats, moves, 1);
+            min_max_heap_bubble_up(heap, parent, 1);
+        } else {
+            min_max_heap_bubble_up(heap, index, 0);
+        }
+    }
+}
+
+// Moves the node at index down to its place among its children and
+// grandchildren; less is 1 on min levels and 0 on max levels
+static void min_max_heap_trickle_down(MinHeap* heap, int index, const int less) {
+    int* data = heap->data;
+    int size = heap->size;
+
+    while (2 * index + 1 < size) {
+        // The most extreme of up to two children and four grandchildren
+        int best = 2 * index + 1;
+        int last = 4 * index + 6 < size - 1 ? 4 * index + 6 : size - 1;
+        int candidates[] = {2 * index + 2, 4 * index + 3, 4 * index + 4, 4 * index + 5, 4 * index + 6};
+        for (int i = 0; i < 5 && candidates[i] <= last; i++) {
+            int c = candidates[i];
+            PYDS_STAT_ADD(heap->stats, comparisons, 1);
+            if (less ? data[c] < data[best] : data[c] > data[best]) best = c;
+        }
+
+        int value = data[index];
+        PYDS_STAT_ADD(heap->stats, comparisons, 1);
+        if (less ? data[best] >= value : data[best] <= value) return;
+
+        data[index] = data[best];
+        data[best] = value;
+        PYDS_STAT_ADD(heap->stats, moves, 1);
+        if (best <= 2 * index + 2) return;
+
+        // A grandchild: the value may now be out of order with its new parent
+        int parent = (best - 1) / 2;
+        if (less ? value > data[parent] : value < data[parent]) {
+            data[best] = data[parent];
+            data[parent] = value;
+            PYDS_STAT_ADD(heap->stats, moves, 1);
+        }
+        index = best;
+    }
+}
+
+static void min_max_heap_sift_down(MinHeap* heap, int index) {
+    min_max_heap_trickle_down(heap, index, min_max_heap_is_min_level(index));
+}
+
+// Index of the largest value of a non-empty heap
+static inline int min_max_heap_max_index(const MinHeap* heap) {
+    if (heap->size <= 2) return heap->size - 1;
+    return heap->data[1] >= heap->data[2] ? 1 : 2;
+}
+
+MinHeap* min_max_heap_heapify(int* arr, int length) {
+    MinHeap* heap = min_heap_copy(arr, NULL, length);
+    if (!heap) return NULL;
+
+    for (int i = (length - 2) / 2; i >= 0; i--) {
+        min_max_heap_sift_down(heap, i);
+    }
+
+    return heap;
+}
+
+char min_max_heap_insert(MinHeap* heap, int value) {
+    if (!heap) return 0;
+
+    PYDS_STAT_ADD(heap->stats, ops, 1);
+    if (heap->size == heap->capacity && !min_heap_grow(heap)) return 0;
+
+    heap->data[heap->size] = value;
+    min_max_heap_sift_up(heap, heap->size);
+    heap->size++;
+    PYDS_STAT_HIGH_WATER(heap->stats, heap->size);
+    return 1;
+}
+
+char min_max_heap_peek_min(MinHeap* heap, int* peek) {
+    return min_heap_peek(heap, peek);
+}
+
+char min_max_heap_peek_max(MinHeap* heap, int* peek) {
+    if (!heap) return 0;
+    PYDS_STAT_ADD(heap->stats, ops, 1);
+    if (heap->size == 0) return 0;
+
+    *peek = heap->data[min_max_heap_max_index(heap)];
+    return 1;
+}
+
+// Fills the hole at index with the last value
+static void min_max_heap_remove_at(MinHeap* heap, int index) {
+    heap->size--;
+    if (index == heap->size) return;
+
+    heap->data[index] = heap->data[heap->size];
+    min_max_heap_sift_down(heap, index);
+}
+
+char min_max_heap_pop_min(MinHeap* heap, int* removed) {
+    if (!heap) return 0;
+    PYDS_STAT_ADD(heap->stats, ops, 1);
+    if (heap->size == 0) return 0;
+
+    *removed = heap->data[0];
+    min_max_heap_remove_at(heap, 0);
+    return 1;
+}
+
+char min_max_heap_pop_max(MinHeap* heap, int* removed) {
+    if (!heap) return 0;
+    PYDS_STAT_ADD(heap->stats, ops, 1);
+    if (heap->size == 0) return 0;
+
+    int index = min_max_heap_max_index(heap);
+    *removed = heap->data[index];
+    min_max_heap_remove_at(heap, index);
+    return 1;
+}
+
+void min_max_heap_pushpop_max(MinHeap* heap, int value, int* removed) {
+    *removed = value;
+    if (!heap || heap->size == 0) return;
+
+    PYDS_STAT_ADD(heap->stats, ops, 1);
+    PYDS_STAT_ADD(heap->stats, comparisons, 1);
+    int index = min_max_heap_max_index(heap);
+    if (value >= heap->data[index]) return;
+
+    *removed = heap->data[index];
+    heap->data[index] = value;
+    if (index == 0) return;
+
+    // A max node's parent is the root, which the new value may undercut
+    PYDS_STAT_ADD(heap->stats, comparisons, 1);
+    if (value < heap->data[0]) {
+        heap->data[index] = heap->data[0];
+        heap->data[0] = value;
+        PYDS_STAT_ADD(heap->stats, moves, 1);
+    }
+    min_max_heap_trickle_down(heap, index, 0);
+}
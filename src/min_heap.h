@@ -3,21 +3,80 @@
 #ifndef MIN_HEAP_H
 #define MIN_HEAP_H
 
+#include "mapped_file.h"
+#include "shared_region.h"
+#include "stats.h"
+
 typedef struct MinHeap {
     int* data;
+    void** payloads;  // Opaque payload per element, moved with data[], or NULL
     int size;
     int capacity;
+    mapped_file_t* file;  // Backing file mapping, or NULL for heap memory
+    pyds_shared_header_t* shared;  // Shared region header, or NULL for private memory
+#ifdef PYDS_STATS
+    pyds_stats_t stats;
+#endif
 } MinHeap;
 
 MinHeap* min_heap_create();
 MinHeap* min_heap_heapify(int* arr, int length);
 void min_heap_free(MinHeap* min_heap);
 
-void min_heap_insert(MinHeap* min_heap, int value);
+// File-backed heaps keep their array in an mmap'd file; opening an existing
+// file maps it in place. min_heap_sync() is the durability point.
+MinHeap* min_heap_open(const char* path, char verify, mapped_file_status_t* status);
+char min_heap_sync(MinHeap* min_heap);
+
+// Shared heaps live in a caller-owned region that other processes can attach
+// at any address. Capacity is fixed by the region length. Every call on a
+// shared heap must be made between min_heap_lock() and min_heap_unlock(),
+// which take the region's process-shared lock and reload/publish the size.
+MinHeap* min_heap_attach(void* base, size_t length, char create, shared_region_status_t* status);
+void min_heap_lock(MinHeap* min_heap);
+void min_heap_unlock(MinHeap* min_heap);
+
+// Keyed heaps carry an opaque payload with every key and move it together
+// with the key on each sift; the heap never dereferences payloads. The plain
+// functions store NULL payloads. Keyed heaps are always in private memory.
+MinHeap* min_heap_create_keyed();
+MinHeap* min_heap_heapify_keyed(int* keys, void** payloads, int length);
+char min_heap_insert_keyed(MinHeap* min_heap, int key, void* payload);
+char min_heap_remove_keyed(MinHeap* min_heap, int* removed_key, void** removed_payload);
+char min_heap_peek_keyed(MinHeap* min_heap, int* key, void** payload);
+char min_heap_pushpop_keyed(MinHeap* min_heap, int key, void* payload, int* removed_key, void** removed_payload);
+
+// Inserts return 0 when the array cannot grow: out of memory, a file that
+// cannot be resized, or a full shared region. The heap is then unchanged.
+char min_heap_insert(MinHeap* min_heap, int value);
 char min_heap_remove(MinHeap* min_heap, int* removed);
 char min_heap_peek(MinHeap* min_heap, int* peek);
 char min_heap_pushpop(MinHeap* min_heap, int value, int* removed);
 
 int min_heap_length(MinHeap* min_heap);
 
+// Min-max heaps use the same struct and storage with min_heap_create(),
+// min_heap_length() and min_heap_free(), but keep the smallest value at the
+// root and the largest among its children, so both ends are O(1) to read and
+// O(log n) to remove. They hold plain ints in private memory; the min_heap_*
+// functions that reorder values must not be called on them.
+MinHeap* min_max_heap_heapify(int* arr, int length);
+char min_max_heap_insert(MinHeap* heap, int value);
+char min_max_heap_peek_min(MinHeap* heap, int* peek);
+char min_max_heap_peek_max(MinHeap* heap, int* peek);
+char min_max_heap_pop_min(MinHeap* heap, int* removed);
+char min_max_heap_pop_max(MinHeap* heap, int* removed);
+// Bounded buffers: replaces the largest value with value if value is
+// smaller, and stores whichever of the two is left out in removed
+void min_max_heap_pushpop_max(MinHeap* heap, int value, int* removed);
+
+// Bytes allocated for the heap and its payload slots; mapped files and
+// shared regions are not counted
+size_t min_heap_memory_usage(const MinHeap* min_heap);
+
+// Counters from a PYDS_STATS build; all zero otherwise. Resetting restarts
+// high_water at the current size.
+void min_heap_get_stats(const MinHeap* min_heap, pyds_stats_t* out);
+void min_heap_reset_stats(MinHeap* min_heap);
+
 #endif
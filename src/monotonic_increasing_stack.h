@@ -5,8 +5,10 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include "stats.h"
 
 /* Result codes for monotonic_increasing_stack operations */
 typedef enum {
@@ -14,7 +16,9 @@ typedef enum {
     MIS_ERROR_NULL_PTR,
     MIS_ERROR_MEMORY,
     MIS_ERROR_EMPTY,
-    MIS_ERROR_UNKNOWN
+    MIS_ERROR_UNKNOWN,
+    MIS_ERROR_FORMAT,
+    MIS_ERROR_UNSUPPORTED
 } mis_status_t;
 
 /* Opaque type for monotonic increasing stack */
@@ -26,6 +30,33 @@ typedef struct monotonic_increasing_stack_s monotonic_increasing_stack_t;
  */
 mis_status_t monotonic_increasing_stack_create(monotonic_increasing_stack_t** out_stack);
 
+/**
+ * Creates a stack over a caller-owned shared memory region so several
+ * processes can use it at once. Each operation takes the region's
+ * process-shared lock; capacity is fixed by the region length.
+ * Only the dynamic array backend supports shared regions.
+ * @param out_stack Pointer to store the stack.
+ * @param base Start of the region, aligned to at least 8 bytes.
+ * @param length Region length in bytes.
+ * @param create Lay out an empty stack instead of attaching to an existing one.
+ * @return MIS_SUCCESS or error code.
+ */
+mis_status_t monotonic_increasing_stack_attach(monotonic_increasing_stack_t** out_stack, void* base, size_t length, bool create);
+
+/**
+ * Holds the lock of a shared stack across several calls, e.g. to read the
+ * size and then copy the elements. The lock is recursive. Does nothing for
+ * stacks that are not shared.
+ * @param stack Pointer to stack.
+ */
+void monotonic_increasing_stack_lock(const monotonic_increasing_stack_t* stack);
+
+/**
+ * Releases a lock taken with monotonic_increasing_stack_lock.
+ * @param stack Pointer to stack.
+ */
+void monotonic_increasing_stack_unlock(const monotonic_increasing_stack_t* stack);
+
 /**
  * Destroys the stack and frees memory.
  * @param stack Pointer to pointer to stack; after call *stack = NULL.
@@ -73,6 +104,38 @@ mis_status_t monotonic_increasing_stack_is_empty(const monotonic_increasing_stac
  */
 mis_status_t monotonic_increasing_stack_size(const monotonic_increasing_stack_t* stack, uint32_t* out_size);
 
+/**
+ * Copies the elements from bottom to top.
+ * @param stack Pointer to stack.
+ * @param out Array with room for every element of the stack.
+ * @return MIS_SUCCESS or error code.
+ */
+mis_status_t monotonic_increasing_stack_to_array(const monotonic_increasing_stack_t* stack, int32_t* out);
+
+/**
+ * Bytes allocated for the stack and its backing container. A shared
+ * region is not counted.
+ * @param stack Pointer to stack.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t monotonic_increasing_stack_memory_usage(const monotonic_increasing_stack_t* stack);
+
+/**
+ * Copies the operation counters of a PYDS_STATS build. cascade holds how
+ * many elements each push popped; allocation counters include the backing
+ * container.
+ * @param stack Pointer to stack.
+ * @param out Receives the counters; all zero when built without PYDS_STATS.
+ */
+void monotonic_increasing_stack_get_stats(const monotonic_increasing_stack_t* stack, pyds_stats_t* out);
+
+/**
+ * Zeroes the operation counters, including the backing container's;
+ * high_water restarts at the current size.
+ * @param stack Pointer to stack.
+ */
+void monotonic_increasing_stack_reset_stats(monotonic_increasing_stack_t* stack);
+
 #ifdef __cplusplus
 }
 #endif
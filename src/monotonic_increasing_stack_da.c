@@ -2,24 +2,29 @@
 
 #include "monotonic_increasing_stack.h"
 #include <stdlib.h>
+#include <string.h>
 #include "dynamic_array.h"
+#include "alloc.h"
 
 /**
  * @brief Monotonic increasing stack structure using a dynamic array.
  */
 struct monotonic_increasing_stack_s {
     dynamic_array_t* arr;  /**< Dynamic array holding stack elements */
+#ifdef PYDS_STATS
+    pyds_stats_t stats;    /**< Operation counters; calloc zeroes them */
+#endif
 };
 
 mis_status_t monotonic_increasing_stack_create(monotonic_increasing_stack_t** out_stack) {
     if (out_stack == NULL) return MIS_ERROR_NULL_PTR;
 
-    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)calloc(1, sizeof(monotonic_increasing_stack_t));
+    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)pyds_calloc(1, sizeof(monotonic_increasing_stack_t));
     if (!stack) return MIS_ERROR_MEMORY;
 
     stack->arr = dynamic_array_create(0); // Initial capacity 0 = default internal policy
     if (stack->arr == NULL) {
-        free(stack);
+        pyds_free(stack);
         return MIS_ERROR_MEMORY;
     }
 
@@ -27,6 +32,39 @@ mis_status_t monotonic_increasing_stack_create(monotonic_increasing_stack_t** ou
     return MIS_SUCCESS;
 }
 
+mis_status_t monotonic_increasing_stack_attach(monotonic_increasing_stack_t** out_stack, void* base, size_t length, bool create) {
+    if (out_stack == NULL || base == NULL) return MIS_ERROR_NULL_PTR;
+
+    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)pyds_calloc(1, sizeof(monotonic_increasing_stack_t));
+    dynamic_array_t* arr = pyds_malloc(sizeof(dynamic_array_t));
+    if (!stack || !arr) {
+        pyds_free(stack);
+        pyds_free(arr);
+        return MIS_ERROR_MEMORY;
+    }
+
+    dyn_array_status_t status = dynamic_array_attach(arr, base, length, create);
+    if (status != DYN_ARRAY_OK) {
+        pyds_free(stack);
+        pyds_free(arr);
+        if (status == DYN_ARRAY_ERROR_UNSUPPORTED) return MIS_ERROR_UNSUPPORTED;
+        if (status == DYN_ARRAY_ERROR_FORMAT) return MIS_ERROR_FORMAT;
+        return MIS_ERROR_MEMORY;
+    }
+
+    stack->arr = arr;
+    *out_stack = stack;
+    return MIS_SUCCESS;
+}
+
+void monotonic_increasing_stack_lock(const monotonic_increasing_stack_t* stack) {
+    if (stack != NULL) dynamic_array_lock(stack->arr);
+}
+
+void monotonic_increasing_stack_unlock(const monotonic_increasing_stack_t* stack) {
+    if (stack != NULL) dynamic_array_unlock(stack->arr);
+}
+
 void monotonic_increasing_stack_destroy(monotonic_increasing_stack_t** stack_ptr) {
     if (stack_ptr == NULL || *stack_ptr == NULL) return;
 
@@ -38,14 +76,14 @@ void monotonic_increasing_stack_destroy(monotonic_increasing_stack_t** stack_ptr
         stack->arr = NULL;
     }
 
-    free(stack);
+    pyds_free(stack);
     *stack_ptr = NULL;
 }
 
-mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack, int32_t value) {
-    if (stack == NULL || stack->arr == NULL) return MIS_ERROR_NULL_PTR;
-
+static mis_status_t monotonic_increasing_stack_push_locked(monotonic_increasing_stack_t* stack, int32_t value) {
     int32_t top_val;
+    size_t popped = 0;
+    PYDS_STAT_ADD(stack->stats, ops, 1);
     while (!dynamic_array_is_empty(stack->arr)) {
         size_t array_size = dynamic_array_size(stack->arr);
         if (__builtin_expect(array_size == 0, 0)) return MIS_ERROR_EMPTY;
@@ -53,11 +91,15 @@ mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack
         dyn_array_status_t get_status = dynamic_array_get(stack->arr, array_size - 1, &top_val);
         if (get_status != DYN_ARRAY_OK) return MIS_ERROR_UNKNOWN;
 
+        PYDS_STAT_ADD(stack->stats, comparisons, 1);
         if (top_val <= value) break;
 
         dyn_array_status_t pop_status = dynamic_array_pop_back(stack->arr, NULL);
         if (pop_status != DYN_ARRAY_OK) return MIS_ERROR_UNKNOWN;
+        popped++;
     }
+    PYDS_STAT_CASCADE(stack->stats, popped);
+    (void)popped;
 
     dyn_array_status_t push_status = dynamic_array_push_back(stack->arr, value);
     if (push_status != DYN_ARRAY_OK) return MIS_ERROR_MEMORY;
@@ -65,10 +107,22 @@ mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack
     return MIS_SUCCESS;
 }
 
+mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack, int32_t value) {
+    if (stack == NULL || stack->arr == NULL) return MIS_ERROR_NULL_PTR;
+
+    dynamic_array_lock(stack->arr);
+    mis_status_t status = monotonic_increasing_stack_push_locked(stack, value);
+    dynamic_array_unlock(stack->arr);
+    return status;
+}
+
 mis_status_t monotonic_increasing_stack_pop(monotonic_increasing_stack_t* stack, int32_t* out_removed) {
     if (stack == NULL || stack->arr == NULL || out_removed == NULL) return MIS_ERROR_NULL_PTR;
 
+    dynamic_array_lock(stack->arr);
+    PYDS_STAT_ADD(stack->stats, ops, 1);
     dyn_array_status_t pop_status = dynamic_array_pop_back(stack->arr, out_removed);
+    dynamic_array_unlock(stack->arr);
     if (pop_status == DYN_ARRAY_ERROR_OUT_OF_RANGE) return MIS_ERROR_EMPTY;
     if (pop_status != DYN_ARRAY_OK) return MIS_ERROR_MEMORY;
 
@@ -78,25 +132,73 @@ mis_status_t monotonic_increasing_stack_pop(monotonic_increasing_stack_t* stack,
 mis_status_t monotonic_increasing_stack_top(const monotonic_increasing_stack_t* stack, int32_t* out_top) {
     if (stack == NULL || stack->arr == NULL || out_top == NULL) return MIS_ERROR_NULL_PTR;
 
+    dynamic_array_lock(stack->arr);
     size_t array_size = dynamic_array_size(stack->arr);
-    if (array_size == 0) return MIS_ERROR_EMPTY;
+    dyn_array_status_t get_status = array_size == 0
+        ? DYN_ARRAY_ERROR_OUT_OF_RANGE
+        : dynamic_array_get(stack->arr, array_size - 1, out_top);
+    dynamic_array_unlock(stack->arr);
 
-    dyn_array_status_t get_status = dynamic_array_get(stack->arr, array_size - 1, out_top);
+    if (array_size == 0) return MIS_ERROR_EMPTY;
     if (get_status != DYN_ARRAY_OK) return MIS_ERROR_MEMORY;
-
     return MIS_SUCCESS;
 }
 
 mis_status_t monotonic_increasing_stack_is_empty(const monotonic_increasing_stack_t* stack, bool* out_is_empty) {
     if (stack == NULL || stack->arr == NULL || out_is_empty == NULL) return MIS_ERROR_NULL_PTR;
 
+    dynamic_array_lock(stack->arr);
     *out_is_empty = dynamic_array_is_empty(stack->arr);
+    dynamic_array_unlock(stack->arr);
     return MIS_SUCCESS;
 }
 
 mis_status_t monotonic_increasing_stack_size(const monotonic_increasing_stack_t* stack, uint32_t* out_size) {
     if (stack == NULL || stack->arr == NULL || out_size == NULL) return MIS_ERROR_NULL_PTR;
 
+    dynamic_array_lock(stack->arr);
     *out_size = (uint32_t)dynamic_array_size(stack->arr);
+    dynamic_array_unlock(stack->arr);
     return MIS_SUCCESS;
 }
+
+mis_status_t monotonic_increasing_stack_to_array(const monotonic_increasing_stack_t* stack, int32_t* out) {
+    if (stack == NULL || stack->arr == NULL || out == NULL) return MIS_ERROR_NULL_PTR;
+
+    dynamic_array_lock(stack->arr);
+    size_t array_size = dynamic_array_size(stack->arr);
+    for (size_t i = 0; i < array_size; i++) {
+        out[i] = *dynamic_array_slot(stack->arr, i);
+    }
+    dynamic_array_unlock(stack->arr);
+    return MIS_SUCCESS;
+}
+
+void monotonic_increasing_stack_get_stats(const monotonic_increasing_stack_t* stack, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (stack == NULL) return;
+
+    // Memory and size counters come from the backing array
+    pyds_stats_t inner;
+    dynamic_array_get_stats(stack->arr, &inner);
+    *out = stack->stats;
+    out->reallocs = inner.reallocs;
+    out->allocations = inner.allocations;
+    out->bytes_allocated = inner.bytes_allocated;
+    out->high_water = inner.high_water;
+#else
+    (void)stack;
+#endif
+}
+
+void monotonic_increasing_stack_reset_stats(monotonic_increasing_stack_t* stack) {
+    if (stack == NULL) return;
+    PYDS_STAT_RESET(stack->stats);
+    dynamic_array_reset_stats(stack->arr);
+}
+
+size_t monotonic_increasing_stack_memory_usage(const monotonic_increasing_stack_t* stack) {
+    if (stack == NULL) return 0;
+    return sizeof(monotonic_increasing_stack_t) + dynamic_array_memory_usage(stack->arr);
+}
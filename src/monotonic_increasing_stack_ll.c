@@ -2,21 +2,26 @@
 
 #include "monotonic_increasing_stack.h"
 #include "linked_list.h"
+#include "alloc.h"
 #include <stdlib.h>
+#include <string.h>
 
-struct monotonic_increasing_stack_ll_s {
+struct monotonic_increasing_stack_s {
     LinkedList* ll;
+#ifdef PYDS_STATS
+    pyds_stats_t stats;  // calloc zeroes the counters
+#endif
 };
 
 mis_status_t monotonic_increasing_stack_create(monotonic_increasing_stack_t** out_stack) {
     if (out_stack == NULL) return MIS_ERROR_NULL_PTR;
 
-    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)calloc(1, sizeof(monotonic_increasing_stack_t));
+    monotonic_increasing_stack_t* stack = (monotonic_increasing_stack_t*)pyds_calloc(1, sizeof(monotonic_increasing_stack_t));
     if (stack == NULL) return MIS_ERROR_MEMORY;
 
     stack->ll = linked_list_create();
     if (stack->ll == NULL) {
-        free(stack);
+        pyds_free(stack);
         return MIS_ERROR_MEMORY;
     }
 
@@ -24,6 +29,22 @@ mis_status_t monotonic_increasing_stack_create(monotonic_increasing_stack_t** ou
     return MIS_SUCCESS;
 }
 
+mis_status_t monotonic_increasing_stack_attach(monotonic_increasing_stack_t** out_stack, void* base, size_t length, bool create) {
+    (void)base; (void)length; (void)create;
+    if (out_stack == NULL) return MIS_ERROR_NULL_PTR;
+
+    // List nodes are process-local pointers and cannot live in a shared region
+    return MIS_ERROR_UNSUPPORTED;
+}
+
+void monotonic_increasing_stack_lock(const monotonic_increasing_stack_t* stack) {
+    (void)stack;
+}
+
+void monotonic_increasing_stack_unlock(const monotonic_increasing_stack_t* stack) {
+    (void)stack;
+}
+
 void monotonic_increasing_stack_destroy(monotonic_increasing_stack_t** stack_ptr) {
     if (stack_ptr == NULL || *stack_ptr == NULL) return;
 
@@ -34,18 +55,22 @@ void monotonic_increasing_stack_destroy(monotonic_increasing_stack_t** stack_ptr
         stack->ll = NULL;
     }
 
-    free(stack);
+    pyds_free(stack);
     *stack_ptr = NULL;
 }
 
 mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack, int32_t value) {
     if (stack == NULL || stack->ll == NULL) return MIS_ERROR_NULL_PTR;
 
+    size_t popped = 0;
+    PYDS_STAT_ADD(stack->stats, ops, 1);
+
     // Pop while top element is greater than value
     while (true) {
         int32_t top_val = 0;
         bool peek_success = linked_list_peek(stack->ll, &top_val);
 
+        if (peek_success) PYDS_STAT_ADD(stack->stats, comparisons, 1);
         if (!peek_success || top_val <= value) {
             break;
         }
@@ -55,7 +80,10 @@ mis_status_t monotonic_increasing_stack_push(monotonic_increasing_stack_t* stack
             // Unexpected failure
             return MIS_ERROR_UNKNOWN;
         }
+        popped++;
     }
+    PYDS_STAT_CASCADE(stack->stats, popped);
+    (void)popped;
 
     bool prepend_success = linked_list_prepend(stack->ll, value);
     if (!prepend_success) {
@@ -69,6 +97,7 @@ mis_status_t monotonic_increasing_stack_pop(monotonic_increasing_stack_t* stack,
     if (stack == NULL || stack->ll == NULL) return MIS_ERROR_NULL_PTR;
     if (out_removed == NULL) return MIS_ERROR_NULL_PTR;
 
+    PYDS_STAT_ADD(stack->stats, ops, 1);
     bool pop_success = linked_list_pop(stack->ll, out_removed);
     if (!pop_success) {
         return MIS_ERROR_EMPTY;  // Stack empty
@@ -97,10 +126,50 @@ mis_status_t monotonic_increasing_stack_is_empty(const monotonic_increasing_stac
     return MIS_SUCCESS;
 }
 
-mis_status_t monotonic_increasing_stack_size(const monotonic_increasing_stack_t* stack, int32_t* out_size) {
+mis_status_t monotonic_increasing_stack_size(const monotonic_increasing_stack_t* stack, uint32_t* out_size) {
     if (stack == NULL || stack->ll == NULL) return MIS_ERROR_NULL_PTR;
     if (out_size == NULL) return MIS_ERROR_NULL_PTR;
 
-    *out_size = linked_list_length(stack->ll);
+    *out_size = (uint32_t)linked_list_length(stack->ll);
+    return MIS_SUCCESS;
+}
+
+mis_status_t monotonic_increasing_stack_to_array(const monotonic_increasing_stack_t* stack, int32_t* out) {
+    if (stack == NULL || stack->ll == NULL) return MIS_ERROR_NULL_PTR;
+    if (out == NULL) return MIS_ERROR_NULL_PTR;
+
+    // The head of the list is the top of the stack, so fill from the end
+    int index = linked_list_length(stack->ll);
+    for (const Node* current = stack->ll->head; current; current = current->next) {
+        out[--index] = current->value;
+    }
     return MIS_SUCCESS;
-}
\ No newline at end of file
+}
+
+void monotonic_increasing_stack_get_stats(const monotonic_increasing_stack_t* stack, pyds_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+#ifdef PYDS_STATS
+    if (stack == NULL) return;
+
+    // Memory and size counters come from the backing list
+    pyds_stats_t inner;
+    linked_list_get_stats(stack->ll, &inner);
+    *out = stack->stats;
+    out->allocations = inner.allocations;
+    out->bytes_allocated = inner.bytes_allocated;
+    out->high_water = inner.high_water;
+#else
+    (void)stack;
+#endif
+}
+
+void monotonic_increasing_stack_reset_stats(monotonic_increasing_stack_t* stack) {
+    if (stack == NULL) return;
+    PYDS_STAT_RESET(stack->stats);
+    linked_list_reset_stats(stack->ll);
+}
+
+size_t monotonic_increasing_stack_memory_usage(const monotonic_increasing_stack_t* stack) {
+    if (stack == NULL) return 0;
+    return sizeof(monotonic_increasing_stack_t) + linked_list_memory_usage(stack->ll);
+}
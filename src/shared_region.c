@@ -0,0 +1,68 @@
+// src/shared_region.c
+
+#include <string.h>
+#include <errno.h>
+#include "shared_region.h"
+
+#define SHARED_REGION_ALIGNMENT 64
+
+static size_t shared_region_data_offset(void) {
+    return (sizeof(pyds_shared_header_t) + SHARED_REGION_ALIGNMENT - 1) & ~(size_t)(SHARED_REGION_ALIGNMENT - 1);
+}
+
+shared_region_status_t shared_region_init(void* base, size_t length, pyds_container_t type, size_t element_size) {
+    size_t offset = shared_region_data_offset();
+    if (!base || element_size == 0 || length < offset + element_size) return SHARED_REGION_ERROR_TOO_SMALL;
+
+    pyds_shared_header_t* header = base;
+    memset(header, 0, sizeof(*header));
+
+    pthread_mutexattr_t attr;
+    if (pthread_mutexattr_init(&attr) != 0) return SHARED_REGION_ERROR_MUTEX;
+    int err = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    if (err == 0) err = pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+#ifdef __linux__
+    if (err == 0) err = pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+#endif
+    if (err == 0) err = pthread_mutex_init(&header->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (err != 0) return SHARED_REGION_ERROR_MUTEX;
+
+    header->version = PYDS_SHARED_VERSION;
+    header->type = (uint16_t)type;
+    header->element_size = (uint32_t)element_size;
+    header->size = 0;
+    header->capacity = (length - offset) / element_size;
+    header->data_offset = offset;
+
+    // Publish the magic last so a concurrent attach never sees a half-built header
+    __atomic_store_n(&header->magic, PYDS_SHARED_MAGIC, __ATOMIC_RELEASE);
+    return SHARED_REGION_OK;
+}
+
+shared_region_status_t shared_region_attach(const void* base, size_t length, pyds_container_t type, size_t element_size) {
+    if (!base || length < sizeof(pyds_shared_header_t)) return SHARED_REGION_ERROR_TOO_SMALL;
+
+    const pyds_shared_header_t* header = base;
+    if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != PYDS_SHARED_MAGIC ||
+        header->version != PYDS_SHARED_VERSION || header->type != (uint16_t)type ||
+        header->element_size != element_size || header->data_offset < sizeof(pyds_shared_header_t) ||
+        header->data_offset > length || header->capacity > (length - header->data_offset) / element_size ||
+        header->size > header->capacity) {
+        return SHARED_REGION_ERROR_FORMAT;
+    }
+    return SHARED_REGION_OK;
+}
+
+void shared_region_lock(pyds_shared_header_t* header) {
+    int err = pthread_mutex_lock(&header->lock);
+#ifdef __linux__
+    if (err == EOWNERDEAD) pthread_mutex_consistent(&header->lock);
+#else
+    (void)err;
+#endif
+}
+
+void shared_region_unlock(pyds_shared_header_t* header) {
+    pthread_mutex_unlock(&header->lock);
+}
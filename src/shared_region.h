@@ -0,0 +1,97 @@
+// src/shared_region.h
+
+#ifndef SHARED_REGION_H
+#define SHARED_REGION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "mapped_file.h"
+
+/**
+ * @file shared_region.h
+ * @brief Container layout for memory shared between processes.
+ *
+ * A region starts with a pyds_shared_header_t and stores its payload at
+ * data_offset bytes from the header. Nothing in the region is a pointer, so
+ * every process may map it at a different address. The header mutex is
+ * process-shared and recursive; on Linux it is also robust, so a process
+ * dying while holding it does not deadlock the others.
+ */
+
+#define PYDS_SHARED_MAGIC 0x48535950u /**< "PYSH" when read little-endian */
+#define PYDS_SHARED_VERSION 1
+
+/**
+ * @brief Header at the start of a shared region.
+ */
+typedef struct {
+    uint32_t magic;        ///< PYDS_SHARED_MAGIC
+    uint16_t version;      ///< PYDS_SHARED_VERSION
+    uint16_t type;         ///< pyds_container_t
+    uint32_t element_size; ///< Size of one element in bytes
+    uint32_t reserved;
+    uint64_t size;         ///< Number of elements in use
+    uint64_t capacity;     ///< Number of elements the payload can hold
+    uint64_t data_offset;  ///< Payload offset from the start of the header
+    pthread_mutex_t lock;  ///< Guards size and payload
+} pyds_shared_header_t;
+
+/**
+ * @brief Status codes returned by shared region functions.
+ */
+typedef enum {
+    SHARED_REGION_OK = 0,
+    SHARED_REGION_ERROR_TOO_SMALL, ///< Region cannot hold a header and one element
+    SHARED_REGION_ERROR_FORMAT,    ///< Region does not hold a container of the expected type
+    SHARED_REGION_ERROR_MUTEX,     ///< The process-shared mutex could not be created
+} shared_region_status_t;
+
+/**
+ * @brief Lay out an empty container in a region, overwriting its contents.
+ * @param base Start of the region, aligned for pyds_shared_header_t.
+ * @param length Region length in bytes.
+ * @param type Container type.
+ * @param element_size Size of one element in bytes.
+ * @return Status code.
+ */
+shared_region_status_t shared_region_init(void* base, size_t length, pyds_container_t type, size_t element_size);
+
+/**
+ * @brief Validate a region previously laid out by shared_region_init.
+ * @param base Start of the region in this process.
+ * @param length Region length in bytes.
+ * @param type Expected container type.
+ * @param element_size Expected element size in bytes.
+ * @return Status code.
+ */
+shared_region_status_t shared_region_attach(const void* base, size_t length, pyds_container_t type, size_t element_size);
+
+/**
+ * @brief Lock the region, recovering the mutex if its previous owner died.
+ * @param header Region header.
+ */
+void shared_region_lock(pyds_shared_header_t* header);
+
+/**
+ * @brief Unlock the region.
+ * @param header Region header.
+ */
+void shared_region_unlock(pyds_shared_header_t* header);
+
+/**
+ * @brief Start of the payload of a region in this process.
+ */
+static inline void* shared_region_payload(pyds_shared_header_t* header) {
+    return (char*)header + header->data_offset;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SHARED_REGION_H
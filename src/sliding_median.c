@@ -0,0 +1,197 @@
+// src/sliding_median.c
+
+#include "alloc.h"
+#include "sliding_median.h"
+
+#if defined(__GNUC__)
+#define SLIDING_MEDIAN_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define SLIDING_MEDIAN_ALWAYS_INLINE inline
+#endif
+
+static inline uint64_t sliding_median_key(int32_t value, int slot) {
+    return ((uint64_t)((uint32_t)value ^ 0x80000000u) << 32) | (uint32_t)slot;
+}
+
+static inline int32_t sliding_median_key_value(uint64_t key) {
+    return (int32_t)((uint32_t)(key >> 32) ^ 0x80000000u);
+}
+
+// Each heap function is instantiated with low as a constant: 1 for the
+// max-heap of small samples, 0 for the min-heap of large ones. a goes
+// above b when it is larger in low and smaller in high.
+#define SLIDING_MEDIAN_ABOVE(a, b, low) ((low) ? (a) > (b) : (a) < (b))
+
+static SLIDING_MEDIAN_ALWAYS_INLINE void sliding_median_place(sliding_median_t* median, uint64_t* heap, int index,
+                                                              uint64_t key, const int low) {
+    heap[index] = key;
+    median->positions[(uint32_t)key] = low ? index : ~index;
+}
+
+static SLIDING_MEDIAN_ALWAYS_INLINE void sliding_median_sift_up(sliding_median_t* median, uint64_t* heap, int index,
+                                                                const int low) {
+    uint64_t key = heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!SLIDING_MEDIAN_ABOVE(key, heap[parent], low)) break;
+        sliding_median_place(median, heap, index, heap[parent], low);
+        index = parent;
+    }
+    sliding_median_place(median, heap, index, key, low);
+}
+
+static SLIDING_MEDIAN_ALWAYS_INLINE void sliding_median_sift_down(sliding_median_t* median, uint64_t* heap, int size,
+                                                                  int index, const int low) {
+    uint64_t key = heap[index];
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= size) break;
+        if (child + 1 < size && SLIDING_MEDIAN_ABOVE(heap[child + 1], heap[child], low)) child++;
+        if (!SLIDING_MEDIAN_ABOVE(heap[child], key, low)) break;
+        sliding_median_place(median, heap, index, heap[child], low);
+        index = child;
+    }
+    sliding_median_place(median, heap, index, key, low);
+}
+
+static SLIDING_MEDIAN_ALWAYS_INLINE void sliding_median_heap_push(sliding_median_t* median, uint64_t key, const int low) {
+    uint64_t* heap = low ? median->low : median->high;
+    int index = low ? median->low_size++ : median->high_size++;
+    heap[index] = key;
+    sliding_median_sift_up(median, heap, index, low);
+}
+
+// Puts key at index and sifts it whichever way it belongs
+static SLIDING_MEDIAN_ALWAYS_INLINE void sliding_median_heap_replace(sliding_median_t* median, int index, uint64_t key,
+                                                                    const int low) {
+    uint64_t* heap = low ? median->low : median->high;
+    int size = low ? median->low_size : median->high_size;
+
+    heap[index] = key;
+    if (index > 0 && SLIDING_MEDIAN_ABOVE(key, heap[(index - 1) / 2], low)) sliding_median_sift_up(median, heap, index, low);
+    else sliding_median_sift_down(median, heap, size, index, low);
+}
+
+static SLIDING_MEDIAN_ALWAYS_INLINE uint64_t sliding_median_heap_pop(sliding_median_t* median, const int low) {
+    uint64_t* heap = low ? median->low : median->high;
+    int size = low ? --median->low_size : --median->high_size;
+    uint64_t top = heap[0];
+
+    if (size > 0) sliding_median_heap_replace(median, 0, heap[size], low);
+    return top;
+}
+
+// Swaps the oldest sample for key without changing the heap sizes: key
+// takes the old entry's place if it belongs in that heap; otherwise the
+// other heap's root moves into that place and key takes the root's.
+static void sliding_median_replace_oldest(sliding_median_t* median, int slot, uint64_t key) {
+    int position = median->positions[slot];
+
+    if (position >= 0) {
+        if (median->high_size == 0 || key < median->high[0]) {
+            sliding_median_heap_replace(median, position, key, 1);
+        } else {
+            sliding_median_heap_replace(median, position, median->high[0], 1);
+            sliding_median_heap_replace(median, 0, key, 0);
+        }
+    } else {
+        if (median->low_size == 0 || key > median->low[0]) {
+            sliding_median_heap_replace(median, ~position, key, 0);
+        } else {
+            sliding_median_heap_replace(median, ~position, median->low[0], 0);
+            sliding_median_heap_replace(median, 0, key, 1);
+        }
+    }
+}
+
+sliding_median_t* sliding_median_create(int window, double quantile) {
+    if (window < 1 || !(quantile >= 0.0 && quantile <= 1.0)) return NULL;
+
+    sliding_median_t* median = pyds_malloc(sizeof(sliding_median_t));
+    if (!median) return NULL;
+
+    median->window = window;
+    median->quantile = quantile;
+    median->positions = pyds_malloc(sizeof(int) * (size_t)window);
+    median->low = pyds_malloc(sizeof(uint64_t) * (size_t)window);
+    median->high = pyds_malloc(sizeof(uint64_t) * (size_t)window);
+    if (!median->positions || !median->low || !median->high) {
+        sliding_median_free(median);
+        return NULL;
+    }
+    sliding_median_clear(median);
+
+    return median;
+}
+
+void sliding_median_free(sliding_median_t* median) {
+    if (!median) return;
+    pyds_free(median->positions);
+    pyds_free(median->low);
+    pyds_free(median->high);
+    pyds_free(median);
+}
+
+void sliding_median_clear(sliding_median_t* median) {
+    median->count = 0;
+    median->oldest = 0;
+    median->low_size = 0;
+    median->high_size = 0;
+}
+
+char sliding_median_value(const sliding_median_t* median, double* result) {
+    if (median->count == 0) return 0;
+
+    // The quantile's rank is the root of low, plus a fraction of the way
+    // to the root of high
+    double rank = median->quantile * (double)(median->count - 1);
+    double fraction = rank - (double)(median->low_size - 1);
+    double value = (double)sliding_median_key_value(median->low[0]);
+    if (fraction > 0.0 && median->high_size > 0) {
+        value += ((double)sliding_median_key_value(median->high[0]) - value) * fraction;
+    }
+    *result = value;
+    return 1;
+}
+
+static inline void sliding_median_add(sliding_median_t* median, int32_t value) {
+    // A full window keeps its heap sizes, so only the first window samples rebalance
+    if (median->count == median->window) {
+        int slot = median->oldest;
+        median->oldest = slot + 1 == median->window ? 0 : slot + 1;
+        sliding_median_replace_oldest(median, slot, sliding_median_key(value, slot));
+        return;
+    }
+
+    int slot = median->oldest + median->count;
+    if (slot >= median->window) slot -= median->window;
+    median->count++;
+
+    uint64_t key = sliding_median_key(value, slot);
+    if (median->high_size > 0 && key > median->high[0]) sliding_median_heap_push(median, key, 0);
+    else sliding_median_heap_push(median, key, 1);
+
+    // low holds the samples up to the quantile's rank, rounded down
+    int target = (int)(median->quantile * (double)(median->count - 1)) + 1;
+    while (median->low_size > target) sliding_median_heap_push(median, sliding_median_heap_pop(median, 1), 0);
+    while (median->low_size < target) sliding_median_heap_push(median, sliding_median_heap_pop(median, 0), 1);
+}
+
+double sliding_median_push(sliding_median_t* median, int32_t value) {
+    double result = 0.0;
+    sliding_median_add(median, value);
+    sliding_median_value(median, &result);
+    return result;
+}
+
+void sliding_median_update(sliding_median_t* median, const int32_t* values, double* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        sliding_median_add(median, values[i]);
+        sliding_median_value(median, &out[i]);
+    }
+}
+
+size_t sliding_median_memory_usage(const sliding_median_t* median) {
+    if (!median) return 0;
+    return sizeof(sliding_median_t) + (sizeof(int) + 2 * sizeof(uint64_t)) * (size_t)median->window;
+}
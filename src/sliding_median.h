@@ -0,0 +1,100 @@
+// src/sliding_median.h
+
+#ifndef SLIDING_MEDIAN_H
+#define SLIDING_MEDIAN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file sliding_median.h
+ * @brief Running quantile of the last window int32 samples.
+ *
+ * The window is split between two heaps: a max-heap of the smallest
+ * samples and a min-heap of the rest, sized so the quantile's rank falls on
+ * the max-heap's root. The samples live in a ring, and each ring slot
+ * records where its sample sits in the heaps, so the sample that leaves
+ * the window is removed by position in O(log window) instead of being
+ * deleted lazily.
+ *
+ * Heap entries are 64-bit keys: the sample with its sign bit flipped, so
+ * unsigned order matches signed order, above its ring slot. Keys are then
+ * distinct and a sift compares them in registers without reading the ring.
+ */
+
+typedef struct {
+    int window;          ///< Most samples kept
+    int count;           ///< Samples in the window
+    int oldest;          ///< Ring slot of the oldest sample
+    double quantile;     ///< Quantile in [0, 1]; 0.5 is the median
+    int* positions;      ///< Per ring slot: index in low if >= 0, else ~index in high
+    uint64_t* low;       ///< Max-heap of the smallest samples
+    uint64_t* high;      ///< Min-heap of the others
+    int low_size;
+    int high_size;
+} sliding_median_t;
+
+/**
+ * @brief Creates an empty window.
+ * @param window Most samples kept, at least 1.
+ * @param quantile Quantile to report, in [0, 1].
+ * @return sliding_median_t* Pointer to the window, or NULL on allocation failure
+ * or invalid arguments.
+ */
+sliding_median_t* sliding_median_create(int window, double quantile);
+
+/**
+ * @brief Frees the window.
+ * @param median Pointer to window; NULL is ignored.
+ */
+void sliding_median_free(sliding_median_t* median);
+
+/**
+ * @brief Adds a sample, dropping the oldest one if the window is full.
+ * @param median Pointer to window.
+ * @param value Sample to add.
+ * @return The quantile of the samples now in the window, interpolated
+ * linearly between neighbouring ranks, so an even window's median is the
+ * mean of its two middle samples.
+ */
+double sliding_median_push(sliding_median_t* median, int32_t value);
+
+/**
+ * @brief Adds count samples, writing the quantile after each one to out.
+ * @param median Pointer to window.
+ * @param values Samples to add.
+ * @param out Receives count results; may not alias values.
+ * @param count Number of samples.
+ */
+void sliding_median_update(sliding_median_t* median, const int32_t* values, double* out, size_t count);
+
+/**
+ * @brief The quantile of the samples in the window.
+ * @param median Pointer to window.
+ * @param result Receives the quantile.
+ * @return 1 on success, 0 if the window is empty.
+ */
+char sliding_median_value(const sliding_median_t* median, double* result);
+
+/**
+ * @brief Empties the window.
+ * @param median Pointer to window.
+ */
+void sliding_median_clear(sliding_median_t* median);
+
+/**
+ * @brief Bytes allocated for the window.
+ * @param median Pointer to window.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t sliding_median_memory_usage(const sliding_median_t* median);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLIDING_MEDIAN_H */
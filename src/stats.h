@@ -0,0 +1,73 @@
+// src/stats.h
+
+#ifndef PYDS_STATS_H
+#define PYDS_STATS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file stats.h
+ * @brief Opt-in operation counters shared by every structure.
+ *
+ * When PYDS_STATS is defined each structure embeds a pyds_stats_t that its
+ * operations update, and exposes it through <prefix>_get_stats() and
+ * <prefix>_reset_stats(). Otherwise the member does not exist and every
+ * PYDS_STAT_* macro expands to nothing, so the default build pays nothing.
+ *
+ * Histograms use log2 buckets: bucket 0 counts zeros and bucket i > 0
+ * counts values in [2^(i-1), 2^i).
+ */
+
+#define PYDS_STATS_BUCKETS 32
+
+/**
+ * @brief Counters kept by a structure built with PYDS_STATS.
+ */
+typedef struct {
+    uint64_t ops;             ///< Public operations that read or change the structure
+    uint64_t comparisons;     ///< Element comparisons (heap sifts, list searches, stack pops)
+    uint64_t moves;           ///< Element moves during heap sifts
+    uint64_t steps;           ///< Nodes visited while walking a list
+    uint64_t reallocs;        ///< Buffer resizes and segment allocations
+    uint64_t allocations;     ///< Buffers and nodes allocated
+    uint64_t bytes_allocated; ///< Bytes requested for those allocations
+    uint64_t high_water;      ///< Largest number of elements held
+    uint64_t cascade[PYDS_STATS_BUCKETS]; ///< Elements popped by each monotonic stack push
+} pyds_stats_t;
+
+/**
+ * @brief Returns the log2 histogram bucket for value.
+ */
+static inline int pyds_stats_bucket(uint64_t value) {
+    if (value == 0) return 0;
+    int bucket = 64 - __builtin_clzll(value);
+    return bucket < PYDS_STATS_BUCKETS ? bucket : PYDS_STATS_BUCKETS - 1;
+}
+
+#ifdef PYDS_STATS
+#define PYDS_STATS_ENABLED 1
+#define PYDS_STAT_RESET(s) memset(&(s), 0, sizeof(pyds_stats_t))
+#define PYDS_STAT_ADD(s, field, n) ((s).field += (uint64_t)(n))
+#define PYDS_STAT_ALLOC(s, bytes) ((s).allocations++, (s).bytes_allocated += (uint64_t)(bytes))
+#define PYDS_STAT_HIGH_WATER(s, size) \
+    ((uint64_t)(size) > (s).high_water ? (void)((s).high_water = (uint64_t)(size)) : (void)0)
+#define PYDS_STAT_CASCADE(s, pops) ((s).cascade[pyds_stats_bucket((uint64_t)(pops))]++)
+#else
+#define PYDS_STATS_ENABLED 0
+#define PYDS_STAT_RESET(s) ((void)0)
+#define PYDS_STAT_ADD(s, field, n) ((void)0)
+#define PYDS_STAT_ALLOC(s, bytes) ((void)0)
+#define PYDS_STAT_HIGH_WATER(s, size) ((void)0)
+#define PYDS_STAT_CASCADE(s, pops) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PYDS_STATS_H
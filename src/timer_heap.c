@@ -0,0 +1,178 @@
+// src/timer_heap.c
+
+#include "alloc.h"
+#include "timer_heap.h"
+
+#define TIMER_HEAP_ARITY 4
+#define TIMER_HEAP_INITIAL_CAPACITY 16
+#define TIMER_HEAP_NO_SLOT UINT32_MAX
+
+static inline void timer_heap_place(timer_heap_t* timers, uint32_t index, timer_heap_entry_t entry) {
+    timers->heap[index] = entry;
+    timers->positions[entry.slot] = index;
+}
+
+static void timer_heap_sift_up(timer_heap_t* timers, uint32_t index, timer_heap_entry_t entry) {
+    while (index > 0) {
+        uint32_t parent = (index - 1) / TIMER_HEAP_ARITY;
+        if (!(entry.deadline < timers->heap[parent].deadline)) break;
+        timer_heap_place(timers, index, timers->heap[parent]);
+        index = parent;
+    }
+    timer_heap_place(timers, index, entry);
+}
+
+static void timer_heap_sift_down(timer_heap_t* timers, uint32_t index, timer_heap_entry_t entry) {
+    timer_heap_entry_t* heap = timers->heap;
+    uint32_t size = timers->size;
+
+    while (1) {
+        size_t first = (size_t)index * TIMER_HEAP_ARITY + 1;
+        if (first >= size) break;
+
+        size_t last = first + TIMER_HEAP_ARITY < size ? first + TIMER_HEAP_ARITY : size;
+        uint32_t child = (uint32_t)first;
+        for (uint32_t i = child + 1; i < last; i++) {
+            if (heap[i].deadline < heap[child].deadline) child = i;
+        }
+        if (!(heap[child].deadline < entry.deadline)) break;
+        timer_heap_place(timers, index, heap[child]);
+        index = child;
+    }
+    timer_heap_place(timers, index, entry);
+}
+
+// Takes the entry at index out of the heap and returns its slot to the free list
+static void* timer_heap_remove_at(timer_heap_t* timers, uint32_t index) {
+    uint32_t slot = timers->heap[index].slot;
+    timer_heap_entry_t last = timers->heap[--timers->size];
+
+    if (index < timers->size) {
+        if (index > 0 && last.deadline < timers->heap[(index - 1) / TIMER_HEAP_ARITY].deadline) {
+            timer_heap_sift_up(timers, index, last);
+        } else {
+            timer_heap_sift_down(timers, index, last);
+        }
+    }
+
+    timers->generations[slot]++;
+    timers->positions[slot] = timers->free_slot;
+    timers->free_slot = slot;
+    return timers->payloads[slot];
+}
+
+// Grows every per-slot array together; the heap keeps its old arrays on failure
+static char timer_heap_grow(timer_heap_t* timers) {
+    if (timers->capacity >= TIMER_HEAP_MAX_TIMERS) return 0;
+    uint32_t capacity = timers->capacity > TIMER_HEAP_MAX_TIMERS / 2 ? TIMER_HEAP_MAX_TIMERS : timers->capacity * 2;
+
+    timer_heap_entry_t* heap = pyds_realloc(timers->heap, sizeof(timer_heap_entry_t) * capacity);
+    if (!heap) return 0;
+    timers->heap = heap;
+    uint32_t* positions = pyds_realloc(timers->positions, sizeof(uint32_t) * capacity);
+    if (!positions) return 0;
+    timers->positions = positions;
+    uint32_t* generations = pyds_realloc(timers->generations, sizeof(uint32_t) * capacity);
+    if (!generations) return 0;
+    timers->generations = generations;
+    void** payloads = pyds_realloc(timers->payloads, sizeof(void*) * capacity);
+    if (!payloads) return 0;
+    timers->payloads = payloads;
+
+    timers->capacity = capacity;
+    return 1;
+}
+
+timer_heap_t* timer_heap_create(void) {
+    timer_heap_t* timers = pyds_malloc(sizeof(timer_heap_t));
+    if (!timers) return NULL;
+
+    timers->size = 0;
+    timers->capacity = TIMER_HEAP_INITIAL_CAPACITY;
+    timers->used = 0;
+    timers->free_slot = TIMER_HEAP_NO_SLOT;
+    timers->heap = pyds_malloc(sizeof(timer_heap_entry_t) * TIMER_HEAP_INITIAL_CAPACITY);
+    timers->positions = pyds_malloc(sizeof(uint32_t) * TIMER_HEAP_INITIAL_CAPACITY);
+    timers->generations = pyds_malloc(sizeof(uint32_t) * TIMER_HEAP_INITIAL_CAPACITY);
+    timers->payloads = pyds_malloc(sizeof(void*) * TIMER_HEAP_INITIAL_CAPACITY);
+    if (!timers->heap || !timers->positions || !timers->generations || !timers->payloads) {
+        timer_heap_free(timers);
+        return NULL;
+    }
+
+    return timers;
+}
+
+void timer_heap_free(timer_heap_t* timers) {
+    if (!timers) return;
+    pyds_free(timers->heap);
+    pyds_free(timers->positions);
+    pyds_free(timers->generations);
+    pyds_free(timers->payloads);
+    pyds_free(timers);
+}
+
+char timer_heap_schedule(timer_heap_t* timers, double deadline, void* payload, uint64_t* handle) {
+    uint32_t slot = timers->free_slot;
+    if (slot != TIMER_HEAP_NO_SLOT) {
+        timers->free_slot = timers->positions[slot];
+    } else {
+        if (timers->used == timers->capacity && !timer_heap_grow(timers)) return 0;
+        slot = timers->used++;
+        timers->generations[slot] = 0;
+    }
+
+    timers->payloads[slot] = payload;
+    timer_heap_entry_t entry = {deadline, slot};
+    timer_heap_sift_up(timers, timers->size++, entry);
+
+    *handle = ((uint64_t)timers->generations[slot] << 32) | slot;
+    return 1;
+}
+
+char timer_heap_cancel(timer_heap_t* timers, uint64_t handle, void** payload) {
+    uint32_t slot = (uint32_t)handle;
+    if (slot >= timers->used || timers->generations[slot] != (uint32_t)(handle >> 32)) return 0;
+
+    // Handles of fired timers no longer match their slot's generation, but a
+    // made-up handle may name a free slot, whose position is a free-list link
+    uint32_t index = timers->positions[slot];
+    if (index >= timers->size || timers->heap[index].slot != slot) return 0;
+
+    void* removed = timer_heap_remove_at(timers, index);
+    if (payload) *payload = removed;
+    return 1;
+}
+
+char timer_heap_peek(const timer_heap_t* timers, double* deadline, void** payload) {
+    if (timers->size == 0) return 0;
+
+    *deadline = timers->heap[0].deadline;
+    if (payload) *payload = timers->payloads[timers->heap[0].slot];
+    return 1;
+}
+
+size_t timer_heap_pop_expired(timer_heap_t* timers, double now, void** out, size_t max) {
+    size_t count = 0;
+    while (count < max && timers->size > 0 && timers->heap[0].deadline <= now) {
+        out[count++] = timer_heap_remove_at(timers, 0);
+    }
+    return count;
+}
+
+void timer_heap_clear(timer_heap_t* timers) {
+    for (uint32_t i = 0; i < timers->size; i++) timers->generations[timers->heap[i].slot]++;
+
+    // Every slot keeps its generation, so they all go back on the free list
+    for (uint32_t slot = 0; slot < timers->used; slot++) {
+        timers->positions[slot] = slot + 1 < timers->used ? slot + 1 : TIMER_HEAP_NO_SLOT;
+    }
+    timers->free_slot = timers->used > 0 ? 0 : TIMER_HEAP_NO_SLOT;
+    timers->size = 0;
+}
+
+size_t timer_heap_memory_usage(const timer_heap_t* timers) {
+    if (!timers) return 0;
+    return sizeof(timer_heap_t) +
+           (sizeof(timer_heap_entry_t) + 2 * sizeof(uint32_t) + sizeof(void*)) * (size_t)timers->capacity;
+}
@@ -0,0 +1,186 @@
+// src/ws_deque.c
+
+#include <stdlib.h>
+#include "alloc.h"
+#include "ws_deque.h"
+
+#define WS_DEQUE_MIN_CAPACITY 16
+
+static inline int64_t ws_deque_mask(const ws_deque_ring_t* ring) {
+    return (int64_t)ring->slots.capacity - 1;
+}
+
+static inline int32_t* ws_deque_slot(ws_deque_ring_t* ring, int64_t index) {
+    return dynamic_array_slot(&ring->slots, (size_t)(index & ws_deque_mask(ring)));
+}
+
+static ws_deque_ring_t* ws_deque_ring_create(size_t capacity) {
+    ws_deque_ring_t* ring = pyds_malloc(sizeof(ws_deque_ring_t));
+    if (!ring) return NULL;
+
+    if (dynamic_array_init(&ring->slots, capacity) != DYN_ARRAY_OK) {
+        pyds_free(ring);
+        return NULL;
+    }
+    ring->retired = NULL;
+    return ring;
+}
+
+// Frees ring and every ring it retired
+static void ws_deque_ring_free(ws_deque_ring_t* ring) {
+    while (ring) {
+        ws_deque_ring_t* retired = ring->retired;
+        dynamic_array_free(&ring->slots);
+        pyds_free(ring);
+        ring = retired;
+    }
+}
+
+static size_t ws_deque_ring_bytes(const ws_deque_ring_t* ring) {
+    return sizeof(ws_deque_ring_t) - sizeof(dynamic_array_t) + dynamic_array_memory_usage(&ring->slots);
+}
+
+/*
+ * Thieves and other readers that may be looking at a ring the owner is about
+ * to free announce themselves in thieves. The owner publishes a new ring and
+ * then reads thieves, a reader increments thieves and then reads the ring,
+ * all sequentially consistent: either the owner sees the reader and keeps the
+ * retired rings, or the reader sees the new ring.
+ */
+static inline ws_deque_ring_t* ws_deque_enter(ws_deque_t* deque) {
+    __atomic_fetch_add(&deque->thieves, 1, __ATOMIC_SEQ_CST);
+    return __atomic_load_n(&deque->ring, __ATOMIC_SEQ_CST);
+}
+
+static inline void ws_deque_leave(ws_deque_t* deque) {
+    __atomic_fetch_sub(&deque->thieves, 1, __ATOMIC_RELEASE);
+}
+
+// Owner only: frees the rings the current one retired if no reader can see them
+static void ws_deque_reclaim(ws_deque_t* deque, ws_deque_ring_t* ring) {
+    if (__atomic_load_n(&deque->thieves, __ATOMIC_SEQ_CST) != 0) return;
+
+    ws_deque_ring_free(ring->retired);
+    ring->retired = NULL;
+    __atomic_store_n(&deque->retired_bytes, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Replaces the owner's full ring with one of twice the capacity
+ * holding the values from top to bottom at the same indices.
+ */
+static ws_deque_ring_t* ws_deque_grow(ws_deque_t* deque, ws_deque_ring_t* ring, int64_t top, int64_t bottom) {
+    if (ring->slots.capacity > SIZE_MAX / 2) return NULL;
+
+    ws_deque_ring_t* grown = ws_deque_ring_create(ring->slots.capacity * 2);
+    if (!grown) return NULL;
+
+    for (int64_t i = top; i < bottom; i++) {
+        *ws_deque_slot(grown, i) = __atomic_load_n(ws_deque_slot(ring, i), __ATOMIC_RELAXED);
+    }
+    grown->retired = ring;
+    size_t retired_bytes = __atomic_load_n(&deque->retired_bytes, __ATOMIC_RELAXED) + ws_deque_ring_bytes(ring);
+    __atomic_store_n(&deque->retired_bytes, retired_bytes, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->ring, grown, __ATOMIC_SEQ_CST);
+
+    ws_deque_reclaim(deque, grown);
+    return grown;
+}
+
+ws_deque_t* ws_deque_create(size_t capacity) {
+    size_t rounded = WS_DEQUE_MIN_CAPACITY;
+    while (rounded < capacity) {
+        if (rounded > SIZE_MAX / 2) return NULL;
+        rounded *= 2;
+    }
+
+    ws_deque_t* deque = pyds_calloc(1, sizeof(ws_deque_t));
+    if (!deque) return NULL;
+
+    deque->ring = ws_deque_ring_create(rounded);
+    if (!deque->ring) {
+        pyds_free(deque);
+        return NULL;
+    }
+    return deque;
+}
+
+void ws_deque_destroy(ws_deque_t* deque) {
+    if (!deque) return;
+    ws_deque_ring_free(deque->ring);
+    pyds_free(deque);
+}
+
+ws_deque_status_t ws_deque_push(ws_deque_t* deque, int32_t value) {
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    ws_deque_ring_t* ring = __atomic_load_n(&deque->ring, __ATOMIC_RELAXED);
+
+    if (ring->retired) ws_deque_reclaim(deque, ring);
+    if (bottom - top > ws_deque_mask(ring)) {
+        ring = ws_deque_grow(deque, ring, top, bottom);
+        if (!ring) return WS_DEQUE_NO_MEMORY;
+    }
+
+    __atomic_store_n(ws_deque_slot(ring, bottom), value, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return WS_DEQUE_OK;
+}
+
+ws_deque_status_t ws_deque_pop(ws_deque_t* deque, int32_t* value) {
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+    ws_deque_ring_t* ring = __atomic_load_n(&deque->ring, __ATOMIC_RELAXED);
+    if (ring->retired) ws_deque_reclaim(deque, ring);
+    __atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {
+        __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return WS_DEQUE_EMPTY;
+    }
+
+    *value = __atomic_load_n(ws_deque_slot(ring, bottom), __ATOMIC_RELAXED);
+    if (top < bottom) return WS_DEQUE_OK;
+
+    // Last value: race the thieves for it
+    ws_deque_status_t status = WS_DEQUE_OK;
+    if (!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        status = WS_DEQUE_EMPTY;
+    }
+    __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return status;
+}
+
+ws_deque_status_t ws_deque_steal(ws_deque_t* deque, int32_t* value) {
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom) return WS_DEQUE_EMPTY;
+
+    ws_deque_ring_t* ring = ws_deque_enter(deque);
+    int32_t stolen = __atomic_load_n(ws_deque_slot(ring, top), __ATOMIC_RELAXED);
+    bool won = __atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    ws_deque_leave(deque);
+
+    if (!won) return WS_DEQUE_ABORT;
+    *value = stolen;
+    return WS_DEQUE_OK;
+}
+
+size_t ws_deque_size(const ws_deque_t* deque) {
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    return bottom > top ? (size_t)(bottom - top) : 0;
+}
+
+size_t ws_deque_memory_usage(ws_deque_t* deque) {
+    if (!deque) return 0;
+
+    ws_deque_ring_t* ring = ws_deque_enter(deque);
+    size_t usage = sizeof(ws_deque_t) + ws_deque_ring_bytes(ring) +
+                   __atomic_load_n(&deque->retired_bytes, __ATOMIC_RELAXED);
+    ws_deque_leave(deque);
+    return usage;
+}
@@ -0,0 +1,120 @@
+#ifndef WS_DEQUE_H
+#define WS_DEQUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "dynamic_array.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @file ws_deque.h
+ * @brief Chase-Lev work-stealing deque of int32 values.
+ *
+ * One owner thread pushes and pops at the bottom without locks; any number
+ * of thief threads steal from the top with one compare-and-swap. The memory
+ * orderings follow Lê, Pop, Cohen and Zappa Nardelli, "Correct and
+ * Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013), written with
+ * the __atomic builtins like the rest of the core.
+ *
+ * Values live in a ring: a dynamic_array_t whose capacity is a power of two,
+ * indexed by top and bottom modulo the capacity. A thief may still be
+ * reading the ring when the owner outgrows it, so growth builds a new ring
+ * of twice the capacity with dynamic_array_init() and retires the old one
+ * instead of reallocating it. Retired rings are freed by the owner once no
+ * steal is in flight: right after growing, or else on a later push or pop,
+ * and at the latest by ws_deque_destroy(). Together they never hold more
+ * slots than the current ring.
+ *
+ * Values are int32, typically indices into a table of tasks.
+ */
+
+typedef enum {
+    WS_DEQUE_OK = 0,
+    WS_DEQUE_EMPTY,      ///< Nothing to pop or steal
+    WS_DEQUE_ABORT,      ///< A steal lost a race for the top value; retry
+    WS_DEQUE_NO_MEMORY,  ///< A push could not grow the ring
+} ws_deque_status_t;
+
+typedef struct ws_deque_ring {
+    dynamic_array_t slots;          ///< Capacity is a power of two; size is unused
+    struct ws_deque_ring* retired;  ///< Older rings this one replaced
+} ws_deque_ring_t;
+
+#define WS_DEQUE_CACHE_LINE 64
+
+/**
+ * top and bottom sit on their own cache lines, so thieves spinning on top do
+ * not slow the owner's pushes. Access the fields through the functions only.
+ */
+typedef struct {
+    int64_t top;  ///< Index of the next value to steal; only grows
+    char top_line[WS_DEQUE_CACHE_LINE - sizeof(int64_t)];
+    int64_t bottom;  ///< Index the owner pushes at next
+    ws_deque_ring_t* ring;
+    char bottom_line[WS_DEQUE_CACHE_LINE - sizeof(int64_t) - sizeof(ws_deque_ring_t*)];
+    int64_t thieves;  ///< Steals in flight, which may be reading a retired ring
+    size_t retired_bytes;  ///< Bytes held by rings the owner has not freed yet
+} ws_deque_t;
+
+/**
+ * @brief Creates an empty deque.
+ * @param capacity Slots to start with, rounded up to a power of two.
+ * @return ws_deque_t* Pointer to the deque, or NULL on allocation failure.
+ */
+ws_deque_t* ws_deque_create(size_t capacity);
+
+/**
+ * @brief Frees the deque and every ring. No other thread may use it.
+ * @param deque Pointer to deque; NULL is ignored.
+ */
+void ws_deque_destroy(ws_deque_t* deque);
+
+/**
+ * @brief Add a value at the bottom. Owner thread only.
+ * @param deque Pointer to deque.
+ * @param value Value to add.
+ * @return WS_DEQUE_NO_MEMORY if the ring was full and could not grow.
+ */
+ws_deque_status_t ws_deque_push(ws_deque_t* deque, int32_t value);
+
+/**
+ * @brief Remove the bottom value, the one pushed last. Owner thread only.
+ * @param deque Pointer to deque.
+ * @param value Receives the value.
+ * @return WS_DEQUE_EMPTY if there was none, or a thief took the last one.
+ */
+ws_deque_status_t ws_deque_pop(ws_deque_t* deque, int32_t* value);
+
+/**
+ * @brief Remove the top value, the oldest one. Any thread.
+ * @param deque Pointer to deque.
+ * @param value Receives the value.
+ * @return WS_DEQUE_EMPTY if there was none, or WS_DEQUE_ABORT if another
+ * thread took it first, in which case the caller may retry.
+ */
+ws_deque_status_t ws_deque_steal(ws_deque_t* deque, int32_t* value);
+
+/**
+ * @brief Number of values, exact for the owner when no steal is running and
+ * a snapshot otherwise.
+ * @param deque Pointer to deque.
+ * @return Number of values.
+ */
+size_t ws_deque_size(const ws_deque_t* deque);
+
+/**
+ * @brief Bytes allocated for the deque, its current ring and the retired
+ * rings not freed yet. Any thread.
+ * @param deque Pointer to deque.
+ * @return Size in bytes, or 0 for NULL.
+ */
+size_t ws_deque_memory_usage(ws_deque_t* deque);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WS_DEQUE_H */
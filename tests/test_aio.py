@@ -0,0 +1,136 @@
+# tests/test_aio.py
+
+import asyncio
+import math
+import random
+
+import pytest
+from pydatastructs.aio import PriorityQueue, TimerHeap
+
+def test_queue_nowait_order_and_errors():
+    queue = PriorityQueue(maxsize=4)
+    for item in [5, (1, "a"), (3, "b"), -(2 ** 31)]:
+        queue.put_nowait(item)
+    assert (queue.qsize(), len(queue), queue.full(), queue.maxsize) == (4, 4, True, 4)
+    with pytest.raises(asyncio.QueueFull):
+        queue.put_nowait(0)
+    assert [queue.get_nowait() for _ in range(4)] == [-(2 ** 31), (1, "a"), (3, "b"), 5]
+    assert queue.empty()
+    with pytest.raises(asyncio.QueueEmpty):
+        queue.get_nowait()
+
+    with pytest.raises(TypeError, match="tuple that starts"):
+        queue.put_nowait(())
+    with pytest.raises(TypeError):
+        queue.put_nowait(("high", 1))
+    with pytest.raises(OverflowError):
+        queue.put(2 ** 31)
+    with pytest.raises(ValueError, match="too many times"):
+        PriorityQueue().task_done()
+    assert PriorityQueue(maxsize=-1).maxsize == 0
+
+def test_queue_wakes_waiting_tasks():
+    async def main():
+        queue = PriorityQueue()
+        getters = [asyncio.create_task(queue.get()) for _ in range(3)]
+        await asyncio.sleep(0)
+        for item in [(2, "b"), (1, "a"), (3, "c")]:
+            await queue.put(item)
+        # Each getter was woken in turn and took the smallest item left
+        assert await asyncio.gather(*getters) == [(1, "a"), (2, "b"), (3, "c")]
+
+        # A cancelled getter leaves no trace, and a getter cancelled after its
+        # wakeup passes the wakeup on
+        cancelled = asyncio.create_task(queue.get())
+        woken = asyncio.create_task(queue.get())
+        waiting = asyncio.create_task(queue.get())
+        await asyncio.sleep(0)
+        cancelled.cancel()
+        await asyncio.sleep(0)
+        queue.put_nowait(7)
+        woken.cancel()
+        assert await waiting == 7
+        assert cancelled.cancelled() and woken.cancelled()
+
+        with pytest.raises(asyncio.TimeoutError):
+            await asyncio.wait_for(queue.get(), 0.01)
+        queue.put_nowait(8)
+        assert await asyncio.wait_for(queue.get(), 1) == 8
+        return queue
+
+    queue = asyncio.run(main())
+    with pytest.raises(RuntimeError, match="different event loop"):
+        asyncio.run(queue.get())
+
+def test_queue_bounded_put_and_join():
+    async def main():
+        queue = PriorityQueue(maxsize=2)
+        done = []
+
+        async def consumer():
+            while True:
+                item = await queue.get()
+                done.append(item)
+                queue.task_done()
+
+        async def producer(start):
+            for i in range(start, 100, 4):
+                await queue.put(i)
+
+        worker = asyncio.create_task(consumer())
+        await asyncio.gather(*(producer(start) for start in range(4)))
+        await queue.join()
+        worker.cancel()
+        assert sorted(done) == list(range(100))
+        assert queue.empty() and queue.qsize() == 0
+
+        operation = queue.join()
+        await operation
+        with pytest.raises(RuntimeError, match="already awaited"):
+            await operation
+
+    asyncio.run(main())
+
+def test_timer_heap_matches_heapq():
+    rng = random.Random(47)
+    timers = TimerHeap()
+    pending = {}
+    now = 0.0
+    for _ in range(50):
+        for _ in range(200):
+            when = now + rng.uniform(0, 100)
+            callback = object()
+            pending[timers.schedule(when, callback)] = (when, callback)
+        for handle in rng.sample(sorted(pending), 50):
+            assert timers.cancel(handle)
+            assert not timers.cancel(handle)
+            del pending[handle]
+        assert len(timers) == len(pending)
+        assert timers.next_deadline == min(when for when, _ in pending.values())
+
+        now += 30
+        expired = sorted((entry for entry in pending.items() if entry[1][0] <= now), key=lambda e: e[1][0])
+        assert timers.pop_expired(now) == [callback for _, (_, callback) in expired]
+        for handle, _ in expired:
+            del pending[handle]
+            # A fired timer's handle never matches its slot's next timer
+            assert not timers.cancel(handle)
+            assert not timers.cancel(handle + (1 << 32))
+
+    assert not timers.cancel(-1) and not timers.cancel(2 ** 70)
+    timers.clear()
+    assert len(timers) == 0 and timers.next_deadline is None and timers.pop_expired(math.inf) == []
+    assert not any(timers.cancel(handle) for handle in pending)
+    with pytest.raises(ValueError, match="NaN"):
+        timers.schedule(math.nan, print)
+
+def test_timer_heap_drives_callbacks():
+    fired = []
+    timers = TimerHeap()
+    for when in [3.0, 1.0, 2.0, 1.0]:
+        timers.schedule(when, lambda when=when: fired.append(when))
+    handle = timers.schedule(1.5, lambda: fired.append("cancelled"))
+    assert timers.cancel(handle)
+    for callback in timers.pop_expired(2.0):
+        callback()
+    assert fired == [1.0, 1.0, 2.0] and timers.next_deadline == 3.0
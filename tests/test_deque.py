@@ -0,0 +1,155 @@
+# tests/test_deque.py
+
+import collections
+import io
+import pickle
+import random
+from array import array
+
+import pytest
+from pydatastructs.deque import Deque
+
+def segments_or_skip(dq):
+    try:
+        return dq.segments()
+    except NotImplementedError:
+        pytest.skip("segments need the contiguous storage build")
+
+def test_push_and_pop_at_both_ends():
+    dq = Deque()
+    dq.append(1)
+    dq.append(2)
+    dq.appendleft(0)
+    assert dq.to_list() == [0, 1, 2]
+    assert len(dq) == 3
+    assert dq.popleft() == 0
+    assert dq.pop() == 2
+    assert dq.pop() == 1
+    assert dq.pop() is None
+    assert dq.popleft() is None
+
+def test_getitem_setitem_across_the_wrap():
+    dq = Deque()
+    for v in range(5):
+        dq.appendleft(v)
+    dq.append(10)
+    assert dq.to_list() == [4, 3, 2, 1, 0, 10]
+    assert dq[0] == 4 and dq[-1] == 10
+    dq[1] = 30
+    dq[-2] = 0
+    assert dq.to_list() == [4, 30, 2, 1, 0, 10]
+    with pytest.raises(IndexError):
+        dq[6]
+    with pytest.raises(IndexError):
+        dq[6] = 1
+
+def test_growth_keeps_order():
+    dq = Deque()
+    expected = collections.deque()
+    for v in range(1000):
+        if v % 3:
+            dq.append(v)
+            expected.append(v)
+        else:
+            dq.appendleft(v)
+            expected.appendleft(v)
+    assert dq.to_list() == list(expected)
+
+def test_maxlen_drops_from_the_opposite_end():
+    dq = Deque(range(10), maxlen=4)
+    assert dq.maxlen == 4
+    assert dq.to_list() == [6, 7, 8, 9]
+    dq.appendleft(5)
+    assert dq.to_list() == [5, 6, 7, 8]
+    dq.append(9)
+    assert dq.to_list() == [6, 7, 8, 9]
+    assert Deque().maxlen is None
+
+    empty = Deque(maxlen=0)
+    empty.append(1)
+    assert len(empty) == 0
+    with pytest.raises(ValueError):
+        Deque(maxlen=-1)
+
+def test_extend_from_buffers_and_iterables():
+    dq = Deque([1, 2])
+    dq.extend(array('i', [3, 4]))
+    dq.extendleft(array('i', [0, -1]))
+    dq.extend(memoryview(array('i', range(10)))[::4])
+    dq.extend(x for x in (7, 8))
+    dq.extend(dq)
+    assert dq.to_list() == [-1, 0, 1, 2, 3, 4, 0, 4, 8, 7, 8] * 2
+
+    with pytest.raises(TypeError):
+        dq.extend([1, "x"])
+    with pytest.raises(OverflowError):
+        dq.extend(array('q', [2**40]))
+
+def test_matches_collections_deque():
+    rng = random.Random(7)
+    for maxlen in (None, 1, 5, 100):
+        dq, expected = Deque(maxlen=maxlen), collections.deque(maxlen=maxlen)
+        for _ in range(3000):
+            op = rng.randrange(6)
+            v = rng.randrange(-1000, 1000)
+            if op == 0:
+                dq.append(v), expected.append(v)
+            elif op == 1:
+                dq.appendleft(v), expected.appendleft(v)
+            elif op == 2 and expected:
+                assert dq.pop() == expected.pop()
+            elif op == 3 and expected:
+                assert dq.popleft() == expected.popleft()
+            elif op == 4:
+                values = [rng.randrange(100) for _ in range(rng.randrange(40))]
+                dq.extend(array('i', values)), expected.extend(values)
+            elif op == 5:
+                values = [rng.randrange(100) for _ in range(rng.randrange(40))]
+                dq.extendleft(values), expected.extendleft(values)
+        assert dq.to_list() == list(expected)
+
+def test_segments_cover_the_values():
+    dq = Deque(range(20))
+    for _ in range(8):
+        dq.popleft()
+    for v in range(20, 30):
+        dq.append(v)
+    head, tail = segments_or_skip(dq)
+    assert head.format == "i" and not head.readonly
+    assert head.tolist() + tail.tolist() == dq.to_list() == list(range(8, 30))
+
+    head[0] = -1
+    assert dq[0] == -1
+
+def test_segments_pin_the_storage():
+    dq = Deque(range(16))
+    head, tail = segments_or_skip(dq)
+    dq.pop()
+    dq.append(1)
+    with pytest.raises(BufferError):
+        dq.append(2)
+    with pytest.raises(BufferError):
+        dq.extend(range(100))
+
+    # Bounded deques never grow past maxlen, so a full one keeps accepting values
+    bounded = Deque(range(4), maxlen=4)
+    bounded_head, _ = segments_or_skip(bounded)
+    bounded.extend(bounded_head)
+    assert bounded.to_list() == [0, 1, 2, 3]
+
+    del head, tail
+    dq.append(2)
+    assert len(dq) == 17
+
+def test_pickle_and_bytes_keep_maxlen():
+    dq = Deque(range(5), maxlen=3)
+    for protocol in (2, pickle.HIGHEST_PROTOCOL):
+        copy = pickle.loads(pickle.dumps(dq, protocol))
+        assert copy.to_list() == [2, 3, 4] and copy.maxlen == 3
+
+    assert Deque.frombytes(dq.tobytes(), maxlen=2).to_list() == [3, 4]
+
+    stream = io.BytesIO()
+    dq.dump(stream)
+    stream.seek(0)
+    assert Deque.load(stream).to_list() == [2, 3, 4]
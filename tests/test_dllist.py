@@ -1,6 +1,15 @@
 # tests/test_dllist.py
 
-from pydatastructs.dllist import DoublyLinkedList
+import io
+import pickle
+import random
+import struct
+import threading
+from array import array
+
+import pytest
+import pydatastructs.dllist as dllist_module
+from pydatastructs.dllist import DoublyLinkedList, ObjectDoublyLinkedList, STATS_ENABLED
 
 def test_append_and_to_list():
     lst = DoublyLinkedList()
@@ -118,4 +127,177 @@ def test_pop_invalid():
     lst = DoublyLinkedList()
     lst.append(1)
     assert lst.pop(1) is None
-    assert lst.to_list() == [1]
\ No newline at end of file
+    assert lst.to_list() == [1]
+
+def test_to_list_as_array():
+    lst = DoublyLinkedList()
+    for value in (3, 3, 3, -1, 2**31 - 1):
+        lst.append(value)
+    assert lst.to_list() == [3, 3, 3, -1, 2**31 - 1]
+    assert lst.to_list(as_array=True) == array("i", [3, 3, 3, -1, 2**31 - 1])
+    assert DoublyLinkedList().to_list(as_array=True) == array("i")
+
+def test_pickle_roundtrip():
+    lst = DoublyLinkedList()
+    for v in [3, -1, 7, 2**31 - 1, -2**31]:
+        lst.append(v)
+    for protocol in range(2, pickle.HIGHEST_PROTOCOL + 1):
+        assert pickle.loads(pickle.dumps(lst, protocol)).to_list() == lst.to_list()
+
+def test_tobytes_frombytes():
+    lst = DoublyLinkedList()
+    lst.append(1)
+    lst.append(-2)
+    assert lst.tobytes() == struct.pack("<2i", 1, -2)
+    assert DoublyLinkedList.frombytes(lst.tobytes()).to_list() == [1, -2]
+
+def test_dump_load():
+    lst = DoublyLinkedList()
+    for v in range(200000):
+        lst.append(v)
+    stream = io.BytesIO()
+    lst.dump(stream)
+    stream.seek(0)
+    assert DoublyLinkedList.load(stream).to_list() == list(range(200000))
+
+def test_load_truncated():
+    lst = DoublyLinkedList()
+    lst.append(1)
+    lst.append(2)
+    stream = io.BytesIO()
+    lst.dump(stream)
+    with pytest.raises(EOFError):
+        DoublyLinkedList.load(io.BytesIO(stream.getvalue()[:-1]))
+
+def test_concurrent_append_and_pop():
+    lst = DoublyLinkedList()
+    popped = []
+
+    def worker():
+        for v in range(5000):
+            lst.append(v)
+            if v % 2:
+                popped.append(lst.pop(0))
+
+    threads = [threading.Thread(target=worker) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert len(popped) == 10000
+    assert len(lst) == 10000
+    assert len(lst.tobytes()) == 4 * 10000
+
+def test_restructuring_matches_list_model():
+    rng = random.Random(50)
+    lists = [DoublyLinkedList(), DoublyLinkedList()]
+    models = [[], []]
+    for _ in range(3000):
+        a = rng.randrange(2)
+        lst, model, other, other_model = lists[a], models[a], lists[1 - a], models[1 - a]
+        op = rng.randrange(6)
+        index = rng.randrange(-len(model) - 3, len(model) + 4)
+        if op == 0:
+            value = rng.randrange(-2 ** 31, 2 ** 31)
+            lst.append(value)
+            model.append(value)
+        elif op == 1:
+            lst.extend_from(other)
+            model += other_model
+            other_model.clear()
+        elif op == 2:
+            lst.splice(index, other)
+            model[index:index] = other_model
+            other_model.clear()
+        elif op == 3:
+            rest = lst.split(index)
+            assert rest.to_list() == model[index:]
+            other.splice(0, rest)
+            other_model[:0] = model[index:]
+            del model[index:]
+            assert len(rest) == 0
+        elif op == 4:
+            steps = rng.randrange(-25, 25)
+            lst.rotate(steps)
+            if model:
+                steps %= len(model)
+                model[:] = model[-steps:] + model[:-steps] if steps else model
+        else:
+            lst.reverse()
+            model.reverse()
+        assert lst.to_list() == model and len(other) == len(models[1 - a])
+
+def test_restructuring_moves_nodes_without_allocating():
+    lst, other = DoublyLinkedList(), DoublyLinkedList()
+    for value in range(1000):
+        lst.append(value)
+        other.append(-value)
+    model = list(range(1000)) + [-value for value in range(1000)]
+    blocks = dllist_module.allocated_blocks()
+    lst.extend_from(other)
+    tail = lst.split(500)
+    lst.splice(0, tail)
+    lst.rotate(-3)
+    lst.reverse()
+    assert dllist_module.allocated_blocks() == blocks + 1  # the list split() returned
+    assert len(other) == len(tail) == 0
+
+    model = model[500:] + model[:500]
+    model = (model[3:] + model[:3])[::-1]
+    lst.rotate()
+    assert lst.to_list() == model[-1:] + model[:-1]
+    with pytest.raises(TypeError, match="DoublyLinkedList"):
+        lst.extend_from([1, 2])
+    with pytest.raises(TypeError):
+        lst.splice(0, ObjectDoublyLinkedList())
+    with pytest.raises(ValueError, match="itself"):
+        lst.splice(0, lst)
+    with pytest.raises(TypeError):
+        lst.split("1")
+    assert lst.split(2 ** 100).to_list() == [] and len(lst) == 2000
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_count_walks():
+    lst = DoublyLinkedList()
+    for value in range(10):
+        lst.append(value)
+    lst.reset_stats()
+
+    lst.pop(5)
+    lst.remove(9)
+    stats = lst.stats()
+    assert stats["ops"] == 2
+    assert stats["steps"] == 5 + 9
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_count_restructuring_walks_from_the_nearer_end():
+    lst = DoublyLinkedList()
+    for value in range(10):
+        lst.append(value)
+    lst.reset_stats()
+
+    lst.rotate(2)  # the new head is 1 node before the tail
+    lst.split(7).reverse()  # 2 before the tail
+    stats = lst.stats()
+    assert stats["ops"] == 2
+    assert stats["steps"] == 1 + 2
+
+def test_object_list_holds_any_items():
+    items = ObjectDoublyLinkedList(["a", (1, 2), None])
+    items.append(3.5)
+    items.prepend({"k": 1})
+    assert items.to_list() == [{"k": 1}, "a", (1, 2), None, 3.5]
+    assert items.remove((1, 2)) == (1, 2)
+    assert items.remove("missing") is None
+    assert items.pop(3) == 3.5
+    assert items.pop(10) is None
+    assert pickle.loads(pickle.dumps(items)).to_list() == [{"k": 1}, "a", None]
+
+def test_object_list_remove_compares_by_value():
+    items = ObjectDoublyLinkedList([1, 2, 3])
+    assert items.remove(2.0) == 2
+    nan = float("nan")
+    items.append(nan)
+    assert items.remove(nan) is nan
+    assert items.to_list() == [1, 3]
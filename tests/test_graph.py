@@ -0,0 +1,169 @@
+# tests/test_graph.py
+
+import heapq
+import random
+from array import array
+
+import pytest
+from pydatastructs.graph import CSRGraph
+
+def random_graph(rng, n, m, symmetric=False, max_weight=20):
+    edges = {}
+    for _ in range(m):
+        u, v = rng.randrange(n), rng.randrange(n)
+        w = rng.randrange(max_weight)
+        edges[u, v] = w
+        if symmetric:
+            edges[v, u] = w
+    adjacency = [[] for _ in range(n)]
+    for (u, v), w in sorted(edges.items()):
+        adjacency[u].append((v, w))
+    indptr, indices, weights = array('i', [0]), array('i'), array('i')
+    for out in adjacency:
+        for v, w in out:
+            indices.append(v)
+            weights.append(w)
+        indptr.append(len(indices))
+    return CSRGraph(indptr, indices, weights), adjacency
+
+def reference_distances(adjacency, source):
+    distances = [-1] * len(adjacency)
+    distances[source] = 0
+    queue = [(0, source)]
+    while queue:
+        d, u = heapq.heappop(queue)
+        if d > distances[u]:
+            continue
+        for v, w in adjacency[u]:
+            if distances[v] == -1 or d + w < distances[v]:
+                distances[v] = d + w
+                heapq.heappush(queue, (d + w, v))
+    return distances
+
+def test_dijkstra_matches_heapq():
+    rng = random.Random(48)
+    graph, adjacency = random_graph(rng, 300, 1500)
+    assert len(graph) == graph.vertex_count == 300 and graph.edge_count == sum(map(len, adjacency))
+    for source in [0, 17, 299]:
+        distances, predecessors = graph.dijkstra(source)
+        assert list(distances) == reference_distances(adjacency, source)
+        assert predecessors[source] == -1
+        # Each predecessor lies on a shortest path
+        for v, u in enumerate(predecessors):
+            if u != -1:
+                assert distances[v] == distances[u] + min(w for t, w in adjacency[u] if t == v)
+            else:
+                assert v == source or distances[v] == -1
+
+def test_dijkstra_batches_across_threads():
+    rng = random.Random(480)
+    graph, adjacency = random_graph(rng, 200, 1000)
+    sources = array('i', [rng.randrange(200) for _ in range(13)])
+    single = [graph.dijkstra(s) for s in sources]
+    for threads in [1, 3, 8, 64]:
+        distances, predecessors = graph.dijkstra(sources, threads=threads)
+        assert len(distances) == len(predecessors) == 13 * 200
+        for row, (d, p) in enumerate(single):
+            assert distances[row * 200:(row + 1) * 200] == d
+            assert predecessors[row * 200:(row + 1) * 200] == p
+
+    # Results can go into the caller's buffers
+    distances, predecessors = array('q', [7]) * 400, array('i', [7]) * 400
+    assert graph.dijkstra([3, 4], distances=distances, predecessors=predecessors, threads=2) == (distances, predecessors)
+    assert list(distances[:200]) == reference_distances(adjacency, 3)
+    assert list(distances[200:]) == reference_distances(adjacency, 4)
+    assert graph.dijkstra([]) == (array('q'), array('i'))
+
+def test_astar_on_grid():
+    # A side x side grid with random weights of at least 1, so the Manhattan
+    # distance is an admissible heuristic
+    rng = random.Random(4800)
+    side = 30
+    adjacency = [[] for _ in range(side * side)]
+    for y in range(side):
+        for x in range(side):
+            for dx, dy in [(1, 0), (-1, 0), (0, 1), (0, -1)]:
+                if 0 <= x + dx < side and 0 <= y + dy < side:
+                    adjacency[y * side + x].append(((y + dy) * side + x + dx, rng.randrange(1, 5)))
+    indptr = array('i', [0])
+    for out in adjacency:
+        indptr.append(indptr[-1] + len(out))
+    graph = CSRGraph(indptr, array('i', [v for out in adjacency for v, _ in out]),
+                     array('i', [w for out in adjacency for _, w in out]))
+
+    for source, target in [(0, side * side - 1), (45, 700), (300, 300)]:
+        heuristic = array('i', [abs(v % side - target % side) + abs(v // side - target // side)
+                                for v in range(side * side)])
+        expected = reference_distances(adjacency, source)[target]
+        for h in [heuristic, None]:
+            distance, path = graph.astar(source, target, h)
+            assert distance == expected and path[0] == source and path[-1] == target
+            weights = [dict(adjacency[u])[v] for u, v in zip(path, path[1:])]
+            assert sum(weights) == distance
+
+    # An inconsistent heuristic still finds the shortest path
+    inconsistent = array('i', [rng.randrange(0, 2) for _ in range(side * side)])
+    inconsistent[side * side - 1] = 0
+    assert graph.astar(0, side * side - 1, inconsistent)[0] == reference_distances(adjacency, 0)[-1]
+
+    island = CSRGraph(array('i', [0, 1, 1, 1]), array('i', [1]), array('i', [5]))
+    assert island.astar(0, 2, None) is None
+    distances = array('q', [0]) * 3
+    assert island.astar(0, 1, array('i', [0, 0, 0]), distances=distances) == (5, [0, 1])
+    assert list(distances[:2]) == [0, 5]
+
+def kruskal(n, adjacency):
+    parent = list(range(n))
+    def find(v):
+        while parent[v] != v:
+            parent[v] = parent[parent[v]]
+            v = parent[v]
+        return v
+    total = 0
+    for w, u, v in sorted((w, u, v) for u in range(n) for v, w in adjacency[u]):
+        ru, rv = find(u), find(v)
+        if ru != rv:
+            parent[ru] = rv
+            total += w
+    return total
+
+def test_prim_matches_kruskal():
+    rng = random.Random(48000)
+    for n, m in [(1, 0), (50, 40), (200, 2000)]:
+        graph, adjacency = random_graph(rng, n, m, symmetric=True)
+        for root in {0, n - 1}:
+            total, predecessors = graph.prim(root)
+            assert total == kruskal(n, adjacency)
+            assert predecessors[root] == -1
+            assert total == sum(dict(adjacency[p])[v] for v, p in enumerate(predecessors) if p != -1)
+    assert CSRGraph(array('i', [0]), array('i'), array('i')).prim() == (0, array('i'))
+
+def test_validation():
+    with pytest.raises(TypeError, match="int32"):
+        CSRGraph([0, 1], array('i', [0]), array('i', [0]))
+    with pytest.raises(ValueError, match="indptr"):
+        CSRGraph(array('i'), array('i'), array('i'))
+    with pytest.raises(ValueError, match="weights"):
+        CSRGraph(array('i', [0, 1]), array('i', [0]), array('i'))
+    with pytest.raises(ValueError, match=r"indptr\[2\]"):
+        CSRGraph(array('i', [0, 2, 1]), array('i', [0, 0]), array('i', [0, 0]))
+    with pytest.raises(ValueError, match=r"indices\[1\]"):
+        CSRGraph(array('i', [0, 2]), array('i', [0, 1]), array('i', [0, 0]))
+    with pytest.raises(ValueError, match=r"weights\[0\] is negative"):
+        CSRGraph(array('i', [0, 1]), array('i', [0]), array('i', [-1]))
+
+    graph = CSRGraph(array('i', [0, 1, 1]), array('i', [1]), array('i', [2]))
+    with pytest.raises(ValueError, match="source 2"):
+        graph.dijkstra(2)
+    with pytest.raises(ValueError, match="source -1"):
+        graph.dijkstra([0, -1])
+    with pytest.raises(ValueError, match="threads"):
+        graph.dijkstra(0, threads=0)
+    with pytest.raises(ValueError, match="distances holds 2 values, the results 4"):
+        graph.dijkstra([0, 1], distances=array('q', [0, 0]))
+    with pytest.raises(TypeError, match="int64"):
+        graph.dijkstra(0, distances=array('i', [0, 0]))
+    with pytest.raises(ValueError, match="heuristic"):
+        graph.astar(0, 1, array('i', [0]))
+    with pytest.raises(ValueError, match="root"):
+        graph.prim(5)
@@ -0,0 +1,207 @@
+# tests/test_int_array.py
+
+import io
+import pickle
+from array import array
+
+import pytest
+from pydatastructs.int_array import IntArray, STATS_ENABLED
+
+def test_append_and_to_list():
+    arr = IntArray()
+    arr.append(1)
+    arr.append(2)
+    assert arr.to_list() == [1, 2]
+    assert len(arr) == 2
+
+def test_pop():
+    arr = IntArray()
+    arr.append(1)
+    arr.append(2)
+    assert arr.pop() == 2
+    assert arr.pop() == 1
+    assert arr.pop() is None
+
+def test_getitem_setitem():
+    arr = IntArray()
+    for v in range(5):
+        arr.append(v)
+    arr[0] = 10
+    arr[-1] = 40
+    assert arr[0] == 10
+    assert arr[-1] == 40
+    assert arr.to_list() == [10, 1, 2, 3, 40]
+
+def test_index_out_of_range():
+    arr = IntArray()
+    arr.append(1)
+    with pytest.raises(IndexError):
+        arr[1]
+    with pytest.raises(IndexError):
+        arr[5] = 1
+
+def test_clear_and_reserve():
+    arr = IntArray()
+    arr.reserve(1000)
+    for v in range(100):
+        arr.append(v)
+    arr.clear()
+    assert len(arr) == 0
+    assert arr.to_list() == []
+
+@pytest.fixture
+def open_array():
+    def opener(path, **kwargs):
+        try:
+            return IntArray.open(path, **kwargs)
+        except NotImplementedError:
+            pytest.skip("file-backed arrays are not supported by this build")
+    return opener
+
+def test_open_creates_file(tmp_path, open_array):
+    path = tmp_path / "values.pyds"
+    arr = open_array(str(path))
+    assert len(arr) == 0
+    assert path.exists()
+
+def test_open_persists_values(tmp_path, open_array):
+    path = tmp_path / "values.pyds"
+    arr = open_array(path)
+    for v in range(5000):
+        arr.append(v * 3)
+    arr.sync()
+    del arr
+
+    reopened = open_array(path, verify=True)
+    assert len(reopened) == 5000
+    assert reopened[0] == 0
+    assert reopened[4999] == 4999 * 3
+    assert reopened.to_list() == [v * 3 for v in range(5000)]
+
+def test_open_rejects_other_files(tmp_path, open_array):
+    path = tmp_path / "garbage.bin"
+    path.write_bytes(b"x" * 128)
+    with pytest.raises(ValueError):
+        open_array(path)
+
+def test_open_detects_corruption(tmp_path, open_array):
+    path = tmp_path / "values.pyds"
+    arr = open_array(path)
+    for v in range(10):
+        arr.append(v)
+    arr.sync()
+    del arr
+
+    raw = bytearray(path.read_bytes())
+    raw[64] ^= 0xFF
+    path.write_bytes(bytes(raw))
+    with pytest.raises(ValueError):
+        open_array(path, verify=True)
+
+def test_close_rehashes_only_after_changes(tmp_path, open_array):
+    path = tmp_path / "values.pyds"
+    arr = open_array(path)
+    for v in range(1000):
+        arr.append(v)
+    del arr
+
+    # Closing a mapping nothing was written to keeps the stored checksum,
+    # so damage done behind its back is still caught
+    raw = bytearray(path.read_bytes())
+    raw[64] ^= 0xFF
+    path.write_bytes(bytes(raw))
+    arr = open_array(path)
+    assert len(arr) == 1000
+    del arr
+    with pytest.raises(ValueError):
+        open_array(path, verify=True)
+
+    # A write that keeps the size still marks the mapping dirty
+    arr = open_array(path)
+    arr[0] = 7
+    del arr
+    assert open_array(path, verify=True).to_list() == [7] + list(range(1, 1000))
+
+def test_to_list_as_array():
+    arr = IntArray()
+    for value in range(-1000, 1000):
+        arr.append(value)
+    result = arr.to_list(as_array=True)
+    assert result.typecode == "i"
+    assert result.tolist() == arr.to_list() == list(range(-1000, 1000))
+
+def test_pickle_roundtrip():
+    arr = IntArray()
+    for v in range(-50, 50):
+        arr.append(v)
+    buffers = []
+    data = pickle.dumps(arr, 5, buffer_callback=buffers.append)
+    assert pickle.loads(data, buffers=buffers).to_list() == list(range(-50, 50))
+    assert pickle.loads(pickle.dumps(arr, 2)).to_list() == list(range(-50, 50))
+
+def test_dump_load():
+    arr = IntArray()
+    for v in range(100000):
+        arr.append(v)
+    stream = io.BytesIO()
+    arr.dump(stream)
+    stream.seek(0)
+    assert IntArray.load(stream).to_list() == list(range(100000))
+
+@pytest.fixture
+def attach_array():
+    def attacher(buffer, **kwargs):
+        try:
+            return IntArray.attach(buffer, **kwargs)
+        except NotImplementedError:
+            pytest.skip("shared arrays are not supported by this build")
+    return attacher
+
+def test_attach_shares_values(attach_array):
+    buf = bytearray(4096)
+    arr = attach_array(buf, create=True)
+    other = attach_array(buf)
+    for v in range(10):
+        arr.append(v)
+    other[3] = 30
+    assert len(other) == 10
+    assert arr[3] == 30
+    assert other.pop() == 9
+    assert arr.to_list() == [0, 1, 2, 30, 4, 5, 6, 7, 8]
+    assert pickle.loads(pickle.dumps(other)).to_list() == arr.to_list()
+
+def test_attach_has_fixed_capacity(attach_array):
+    arr = attach_array(bytearray(512), create=True)
+    count = 0
+    with pytest.raises(MemoryError):
+        while True:
+            arr.append(count)
+            count += 1
+    assert len(arr) == count
+    with pytest.raises(MemoryError):
+        arr.reserve(count + 1)
+    while arr.pop() is not None:
+        pass
+    arr.append(7)
+    assert arr.to_list() == [7]
+
+def test_attach_rejects_other_containers(attach_array):
+    from pydatastructs.min_heap import MinHeap
+
+    buf = bytearray(4096)
+    MinHeap.attach(buf, create=True)
+    with pytest.raises(ValueError):
+        attach_array(buf)
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_count_growth():
+    arr = IntArray()
+    arr.reset_stats()
+    for value in range(64):
+        arr.append(value)
+
+    stats = arr.stats()
+    assert stats["ops"] == 64
+    # 16 -> 32 -> 64 in either layout, each allocating the new capacity's worth
+    assert stats["reallocs"] == 2
+    assert stats["high_water"] == 64
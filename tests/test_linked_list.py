@@ -1,6 +1,12 @@
 # tests/test_linked_list.py
 
-from pydatastructs.linked_list import LinkedList
+import io
+import pickle
+from array import array
+
+import pytest
+from pydatastructs.linked_list import LinkedList, ObjectLinkedList, STATS_ENABLED
+from pydatastructs.min_heap import MinHeap
 
 def test_prepend_and_len():
     ll = LinkedList()
@@ -72,4 +78,57 @@ def test_peek_after_pop():
     ll = LinkedList()
     ll.prepend(1)
     ll.pop()
-    assert ll.peek() is None
\ No newline at end of file
+    assert ll.peek() is None
+
+def test_to_list_first_to_last():
+    ll = LinkedList()
+    for value in (1, 2, 3):
+        ll.prepend(value)
+    assert ll.to_list() == [3, 2, 1]
+    assert ll.to_list(as_array=True) == array("i", [3, 2, 1])
+
+def test_pickle_roundtrip():
+    ll = LinkedList()
+    for v in [1, 2, 3]:
+        ll.prepend(v)
+    restored = pickle.loads(pickle.dumps(ll, 5))
+    assert [restored.pop() for _ in range(3)] == [3, 2, 1]
+
+def test_dump_load_preserves_order():
+    ll = LinkedList()
+    for v in range(100000):
+        ll.prepend(v)
+    stream = io.BytesIO()
+    ll.dump(stream)
+    stream.seek(0)
+    restored = LinkedList.load(stream)
+    assert len(restored) == 100000
+    assert restored.tobytes() == ll.tobytes()
+    assert restored.pop() == 99999
+
+def test_load_wrong_container():
+    stream = io.BytesIO()
+    MinHeap().dump(stream)
+    stream.seek(0)
+    with pytest.raises(ValueError):
+        LinkedList.load(stream)
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_count_node_allocations():
+    ll = LinkedList()
+    for value in range(5):
+        ll.prepend(value)
+    ll.pop()
+
+    stats = ll.stats()
+    assert stats["ops"] == 6
+    assert stats["allocations"] == 5
+    assert stats["high_water"] == 5
+
+def test_object_list_prepend_pop():
+    items = ObjectLinkedList(["a", "b"])
+    items.prepend([1])
+    assert items.peek() == [1]
+    assert items.to_list() == [[1], "a", "b"]
+    assert pickle.loads(pickle.dumps(items)).to_list() == [[1], "a", "b"]
+    assert [items.pop() for _ in range(4)] == [[1], "a", "b", None]
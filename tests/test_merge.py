@@ -0,0 +1,98 @@
+# tests/test_merge.py
+
+import heapq
+import random
+import threading
+from array import array
+
+import pytest
+from pydatastructs.merge import Merger, merge_sorted
+
+def sorted_runs(count, seed=5):
+    rng = random.Random(seed)
+    return [array("i", sorted(rng.randrange(-1000, 1000) for _ in range(rng.randrange(0, 200))))
+            for _ in range(count)]
+
+@pytest.mark.parametrize("count", [0, 1, 2, 3, 17, 256])
+def test_merge_sorted_matches_heapq(count):
+    runs = sorted_runs(count)
+    merged = merge_sorted(runs)
+    assert isinstance(merged, array) and merged.typecode == "i"
+    assert merged.tolist() == list(heapq.merge(*runs))
+
+def test_merge_sorted_into_out_buffer():
+    runs = [array("i", [1, 4, 2 ** 31 - 1]), memoryview(array("i", [-(2 ** 31), 4, 9]))]
+    out = array("i", [0] * 7)
+    assert merge_sorted(runs, out, release_gil=True) == 6
+    assert out.tolist() == [-(2 ** 31), 1, 4, 4, 9, 2 ** 31 - 1, 0]
+
+    with pytest.raises(ValueError, match="out holds 5 values"):
+        merge_sorted(runs, array("i", [0] * 5))
+    with pytest.raises(TypeError, match="writable"):
+        merge_sorted(runs, bytes(24))
+    with pytest.raises(TypeError, match="int32 buffers"):
+        merge_sorted([[1, 2]])
+
+def test_out_must_not_overlap_the_runs():
+    buf = array("i", [5, 6, 7, 8, 1, 2, 3, 4])
+    view = memoryview(buf)
+    with pytest.raises(ValueError, match="overlaps run 0"):
+        merge_sorted([view[:4], view[4:]], out=buf)
+    with pytest.raises(ValueError, match="overlaps run 1"):
+        merge_sorted([array("i", [0]), view[4:]], out=view[2:6])
+    assert buf.tolist() == [5, 6, 7, 8, 1, 2, 3, 4]
+
+    # Neighbouring memory is fine
+    assert merge_sorted([view[4:]], out=view[:4]) == 4
+    assert buf.tolist() == [1, 2, 3, 4, 1, 2, 3, 4]
+
+    merger = Merger([view[:2]])
+    with pytest.raises(ValueError, match="overlaps run 0"):
+        merger.readinto(view[1:3])
+    assert merger.read().tolist() == [1, 2]
+
+def test_merger_streams_in_chunks():
+    runs = sorted_runs(40)
+    expected = list(heapq.merge(*runs))
+    merger = Merger(runs)
+    assert len(merger) == len(expected)
+
+    out = array("i", [0] * 100)
+    chunks = [merger.read(7).tolist(), [next(merger)]]
+    written = merger.readinto(out, release_gil=True)
+    chunks.append(out[:written].tolist())
+    chunks.append(list(merger))
+    assert [v for chunk in chunks for v in chunk] == expected
+    assert len(merger) == 0 and merger.read().tolist() == []
+
+def test_merger_holds_the_runs():
+    run = array("i", [1, 2, 3])
+    merger = Merger([run])
+    with pytest.raises(BufferError):
+        run.append(4)
+    assert merger.read().tolist() == [1, 2, 3]
+    del merger
+    run.append(4)
+
+def test_merger_threads_take_turns():
+    merger = Merger([array("i", range(0, 200000, 2)), array("i", range(1, 200000, 2))])
+    values, errors = [], []
+
+    def reader():
+        while True:
+            try:
+                chunk = merger.read(1000, release_gil=True)
+            except RuntimeError:
+                errors.append(1)
+                continue
+            if not chunk:
+                return
+            values.append(chunk.tolist())
+
+    threads = [threading.Thread(target=reader) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert sorted(v for chunk in values for v in chunk) == list(range(200000))
+    assert all(chunk == sorted(chunk) for chunk in values)
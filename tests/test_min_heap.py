@@ -1,6 +1,19 @@
 # tests/test_min_heap.py
 
-from pydatastructs.min_heap import MinHeap
+import gc
+import heapq
+import io
+import multiprocessing
+import pickle
+import random
+import struct
+import threading
+import weakref
+from array import array
+from multiprocessing import shared_memory
+
+import pytest
+from pydatastructs.min_heap import EventQueue, ExternalMinHeap, MinHeap, MinMaxHeap, ObjectMinHeap, STATS_ENABLED
 
 def test_insert_single():
     heap = MinHeap()
@@ -123,4 +136,407 @@ def test_heapify_creates_valid_heap():
 def test_heapify_empty():
     heap = MinHeap.heapify([])
     assert len(heap) == 0
-    assert heap.peek() is None
\ No newline at end of file
+    assert heap.peek() is None
+def test_heapify_empty_then_insert():
+    heap = MinHeap.heapify([])
+    heap.insert(3)
+    heap.insert(1)
+    assert heap.remove() == 1
+
+def test_constructor_takes_only_key_and_reverse():
+    with pytest.raises(TypeError):
+        MinHeap(len)
+    with pytest.raises(TypeError):
+        MinHeap(size=1)
+    with pytest.raises(TypeError, match="key must be callable"):
+        MinHeap(key=1)
+    assert MinHeap(key=None).key is None
+    assert MinHeap(reverse=True).reverse is True
+
+def test_key_is_called_once_per_insert():
+    calls = []
+
+    def key(word):
+        calls.append(word)
+        return len(word)
+
+    words = ["banana", "fig", "apple", "kiwi", "cherry", "date"]
+    heap = MinHeap(key=key)
+    for word in words:
+        heap.insert(word)
+    assert calls == words
+    assert heap.peek() == "fig"
+    out = [heap.remove() for _ in words]
+    assert [len(word) for word in out] == sorted(len(word) for word in words)
+    assert len(calls) == len(words)
+    assert heap.remove() is None
+
+@pytest.mark.parametrize("values", [
+    [5, -3, 2 ** 31 - 1, 0, -(2 ** 31), 7],
+    [],
+])
+def test_reverse_returns_largest_first(values):
+    heap = MinHeap(reverse=True)
+    for value in values:
+        heap.insert(value)
+    assert sorted(heap.to_list()) == sorted(values)
+    assert [heap.remove() for _ in values] == sorted(values, reverse=True)
+
+    heap = MinHeap.heapify(values, reverse=True)
+    assert heap.peek() == (max(values) if values else None)
+    assert heap.pushpop(2 ** 31 - 1) == 2 ** 31 - 1
+
+def test_key_with_reverse():
+    heap = MinHeap.heapify([(1, "a"), (9, "b"), (4, "c")], key=lambda job: job[0], reverse=True)
+    assert heap.pushpop((5, "d")) == (9, "b")
+    assert heap.pushpop((0, "e")) == (5, "d")
+    assert [heap.remove() for _ in range(3)] == [(4, "c"), (1, "a"), (0, "e")]
+
+def test_key_errors_leave_heap_unchanged():
+    heap = MinHeap(key=lambda item: item)
+    heap.insert(1)
+    with pytest.raises(TypeError):
+        heap.insert("x")
+    with pytest.raises(OverflowError):
+        heap.pushpop(2 ** 40)
+    with pytest.raises(TypeError):
+        MinHeap.heapify([1, 2.5], key=lambda item: item)
+    assert heap.to_list() == [1]
+
+def test_keyed_heap_pickles_but_has_no_int32_form():
+    heap = MinHeap.heapify(["ccc", "a", "bb"], key=len, reverse=True)
+    restored = pickle.loads(pickle.dumps(heap))
+    assert (restored.key, restored.reverse) == (len, True)
+    assert [restored.remove() for _ in range(3)] == ["ccc", "bb", "a"]
+
+    reversed_heap = MinHeap.heapify([1, 3, 2], reverse=True)
+    assert pickle.loads(pickle.dumps(reversed_heap)).remove() == 3
+
+    for method in (heap.tobytes, reversed_heap.tobytes, lambda: heap.dump(io.BytesIO())):
+        with pytest.raises(TypeError, match="without key or reverse"):
+            method()
+    with pytest.raises(TypeError):
+        heap.to_list(as_array=True)
+
+def test_keyed_heap_collects_cycles():
+    class Item:
+        pass
+
+    item = Item()
+    heap = MinHeap(key=lambda item: 0)
+    heap.insert(item)
+    item.heap = heap
+    ref = weakref.ref(item)
+    del heap, item
+    gc.collect()
+    assert ref() is None
+
+def test_open_persists_heap(tmp_path):
+    path = tmp_path / "heap.pyds"
+    heap = MinHeap.open(str(path))
+    for v in [9, 4, 7, 1, -2, 6, 5] * 500:
+        heap.insert(v)
+    heap.sync()
+    del heap
+
+    reopened = MinHeap.open(path, verify=True)
+    assert len(reopened) == 3500
+    assert reopened.peek() == -2
+    out = [reopened.remove() for _ in range(len(reopened))]
+    assert out == sorted([9, 4, 7, 1, -2, 6, 5] * 500)
+
+    # pushpop keeps the size, so only the dirty flag gets the checksum updated
+    reopened.insert(3)
+    reopened.sync()
+    assert reopened.pushpop(8) == 3
+    del reopened
+    assert MinHeap.open(path, verify=True).peek() == 8
+
+def test_open_rejects_other_files(tmp_path):
+    path = tmp_path / "garbage.bin"
+    path.write_bytes(b"y" * 128)
+    with pytest.raises(ValueError):
+        MinHeap.open(path)
+
+def test_to_list_returns_heap_array():
+    heap = MinHeap.heapify([9, 4, 7, 1])
+    values = heap.to_list()
+    assert sorted(values) == [1, 4, 7, 9]
+    assert values[0] == 1
+    assert heap.to_list(as_array=True) == array("i", values)
+
+def test_pickle_roundtrip():
+    heap = MinHeap.heapify([9, 4, 7, 1, -2, 6, 5])
+    for protocol in (2, 4, 5):
+        restored = pickle.loads(pickle.dumps(heap, protocol))
+        assert [restored.remove() for _ in range(7)] == [-2, 1, 4, 5, 6, 7, 9]
+
+def test_dump_load():
+    heap = MinHeap()
+    for v in range(100000, 0, -1):
+        heap.insert(v)
+    stream = io.BytesIO()
+    heap.dump(stream)
+    stream.seek(0)
+    restored = MinHeap.load(stream)
+    assert restored.tobytes() == heap.tobytes()
+    assert restored.peek() == 1
+
+def test_frombytes_restores_heap_order():
+    heap = MinHeap.frombytes(struct.pack("<4i", 5, 1, 4, 2))
+    assert [heap.remove() for _ in range(4)] == [1, 2, 4, 5]
+
+def test_attach_shares_heap():
+    buf = bytearray(4096)
+    heap = MinHeap.attach(buf, create=True)
+    other = MinHeap.attach(buf)
+    heap.insert(5)
+    heap.insert(1)
+    assert other.peek() == 1
+    assert len(other) == 2
+    assert other.remove() == 1
+    assert len(heap) == 1
+    assert heap.tobytes() == struct.pack("<i", 5)
+
+def test_attach_full_raises():
+    heap = MinHeap.attach(bytearray(512), create=True)
+    inserted = 0
+    with pytest.raises(MemoryError):
+        while True:
+            heap.insert(1000 - inserted)
+            inserted += 1
+    assert len(heap) == inserted
+    assert heap.remove() == 1000 - inserted + 1
+
+def test_attach_rejects_bad_buffers():
+    with pytest.raises(ValueError):
+        MinHeap.attach(bytearray(4096))
+    with pytest.raises(ValueError):
+        MinHeap.attach(bytearray(16), create=True)
+    with pytest.raises((BufferError, TypeError)):
+        MinHeap.attach(bytes(4096), create=True)
+
+def _insert_shared(name, values):
+    shm = shared_memory.SharedMemory(name=name)
+    heap = MinHeap.attach(shm.buf)
+    for v in values:
+        heap.insert(v)
+    del heap
+    shm.close()
+
+def test_attach_across_processes():
+    if "fork" not in multiprocessing.get_all_start_methods():
+        pytest.skip("fork start method is not available")
+    ctx = multiprocessing.get_context("fork")
+
+    shm = shared_memory.SharedMemory(create=True, size=1 << 16)
+    try:
+        heap = MinHeap.attach(shm.buf, create=True)
+        workers = [ctx.Process(target=_insert_shared, args=(shm.name, range(w, 2000, 4))) for w in range(4)]
+        for w in workers:
+            w.start()
+        for w in workers:
+            w.join()
+        assert all(w.exitcode == 0 for w in workers)
+
+        assert len(heap) == 2000
+        assert [heap.remove() for _ in range(2000)] == list(range(2000))
+        del heap
+    finally:
+        shm.close()
+        shm.unlink()
+
+def test_concurrent_inserts_are_not_lost():
+    heap = MinHeap()
+
+    def worker(start):
+        for v in range(start, 20000, 4):
+            heap.insert(v)
+
+    threads = [threading.Thread(target=worker, args=(t,)) for t in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert len(heap) == 20000
+    assert [heap.remove() for _ in range(20000)] == list(range(20000))
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_count_sift_work():
+    heap = MinHeap()
+    for value in range(8, 0, -1):
+        heap.insert(value)
+
+    stats = heap.stats()
+    assert stats["ops"] == 8
+    # Each descending insert moves the new minimum all the way to the root
+    assert stats["moves"] == sum(i.bit_length() - 1 for i in range(1, 9))
+    assert stats["comparisons"] == stats["moves"]
+    assert stats["reallocs"] == 2
+
+@pytest.mark.parametrize("values", [
+    [5.5, -1.25, 3.0, float("inf"), 0.0],
+    ["pear", "apple", "fig", "", "apples", "\u00e9clair", "\U0001f34e"],
+    [7, -(2 ** 40), 3, 2 ** 62, 0],
+    [(2, "b"), (1, "z"), (2, "a")],
+    [3, 1.5, 2 ** 80, -1],
+])
+def test_object_heap_orders_like_sorted(values):
+    heap = ObjectMinHeap(values)
+    assert [heap.remove() for _ in values] == sorted(values)
+    for value in values:
+        heap.insert(value)
+    assert [heap.remove() for _ in values] == sorted(values)
+    assert heap.remove() is None
+
+def test_object_heap_pushpop_and_pickle():
+    heap = ObjectMinHeap.heapify(["m", "c", "x"])
+    assert heap.pushpop("a") == "a"
+    assert heap.pushpop("d") == "c"
+    assert heap.peek() == "d"
+    restored = pickle.loads(pickle.dumps(heap))
+    assert type(restored) is ObjectMinHeap
+    assert restored.to_list() == heap.to_list()
+
+def test_object_heap_comparison_errors_keep_items():
+    heap = ObjectMinHeap([1, 2])
+    with pytest.raises(TypeError):
+        heap.insert("x")
+    assert sorted(heap.to_list(), key=str) == [1, 2, "x"]
+
+def test_object_heap_rejects_changes_from_comparisons():
+    heap = ObjectMinHeap()
+
+    class Meddler:
+        def __lt__(self, other):
+            heap.insert(0)
+            return True
+
+    heap.insert(Meddler())
+    with pytest.raises(RuntimeError, match="modified during a comparison"):
+        heap.insert(Meddler())
+    assert len(heap) == 2
+
+def test_object_heap_collects_cycles():
+    class Item:
+        def __lt__(self, other):
+            return id(self) < id(other)
+
+    heap = ObjectMinHeap([Item(), Item()])
+    heap.peek().heap = heap
+    ref = weakref.ref(heap.peek())
+    del heap
+    gc.collect()
+    assert ref() is None
+
+def test_min_max_heap_takes_both_ends():
+    rng = random.Random(7)
+    values = [rng.randrange(-1000, 1000) for _ in range(500)]
+    heap = MinMaxHeap()
+    for value in values:
+        heap.insert(value)
+    assert (heap.peek_min(), heap.peek_max()) == (min(values), max(values))
+
+    expected = sorted(values)
+    while expected:
+        if rng.random() < 0.5:
+            assert heap.pop_min() == expected.pop(0)
+        else:
+            assert heap.pop_max() == expected.pop()
+        assert len(heap) == len(expected)
+    assert heap.pop_min() is None and heap.pop_max() is None and heap.peek_max() is None
+
+def test_min_max_heap_heapify_and_pickle():
+    heap = MinMaxHeap.heapify(array("i", [4, 8, -3, 15, 0]))
+    assert (heap.peek_min(), heap.peek_max()) == (-3, 15)
+    clone = pickle.loads(pickle.dumps(heap))
+    assert clone.to_list() == heap.to_list()
+    assert [clone.pop_max() for _ in range(5)] == [15, 8, 4, 0, -3]
+    with pytest.raises(OverflowError):
+        MinMaxHeap.heapify([2 ** 31])
+
+def test_bounded_min_max_heap_evicts_the_largest():
+    heap = MinMaxHeap(maxlen=3)
+    assert [heap.insert(v) for v in (50, 10, 40, 20, 60, 5)] == [None, None, None, 50, 60, 40]
+    assert sorted(heap.to_list()) == [5, 10, 20]
+    assert heap.maxlen == 3 and pickle.loads(pickle.dumps(heap)).maxlen == 3
+    assert sorted(MinMaxHeap.heapify(range(100), maxlen=4).to_list()) == [0, 1, 2, 3]
+    assert MinMaxHeap(maxlen=0).insert(1) == 1
+    with pytest.raises(ValueError):
+        MinMaxHeap(maxlen=-1)
+
+def test_external_min_heap_spills_and_merges(tmp_path):
+    rng = random.Random(11)
+    heap = ExternalMinHeap(memory_limit=64 * 1024, directory=tmp_path)
+    expected = []
+    for step in range(200000):
+        if rng.random() < 0.8:
+            value = rng.randrange(-2 ** 31, 2 ** 31)
+            heap.insert(value)
+            heapq.heappush(expected, value)
+        else:
+            assert heap.remove() == (heapq.heappop(expected) if expected else None)
+    assert len(heap) == len(expected) and heap.peek() == expected[0]
+    assert heap.runs > 0 and heap.spilled > len(expected) // 2
+    assert list(tmp_path.iterdir()) == []  # the runs are unlinked files
+
+    assert [heap.remove() for _ in range(len(expected))] == sorted(expected)
+    assert heap.remove() is None and heap.runs == 0 and heap.spilled == 0
+
+def test_external_min_heap_errors(tmp_path):
+    with pytest.raises(ValueError, match="at least 65536"):
+        ExternalMinHeap(memory_limit=1024)
+    assert ExternalMinHeap().memory_limit == 64 << 20
+
+    heap = ExternalMinHeap(memory_limit=64 * 1024, directory=tmp_path / "missing")
+    with pytest.raises(OSError):
+        for value in range(100000):
+            heap.insert(value)
+    assert len(heap) == value and heap.spilled == 0 and heap.peek() == 0
+    with pytest.raises(OverflowError):
+        heap.insert(2 ** 31)
+
+def test_event_queue_is_fifo_within_a_time():
+    rng = random.Random(49)
+    queue = EventQueue()
+    expected = []
+    now, sequence = 0, 0
+    for _ in range(300):
+        for _ in range(rng.randrange(50)):
+            # Mostly ahead of the clock, sometimes at it or behind the latest event
+            time = now + rng.choice([0, 0, 1, 5, rng.randrange(100), -rng.randrange(3)])
+            queue.push(time, sequence)
+            heapq.heappush(expected, (time, sequence))
+            sequence += 1
+        assert len(queue) == len(expected)
+        if not expected:
+            continue
+        assert queue.next_time == expected[0][0]
+        if rng.random() < 0.5:
+            assert queue.pop() == heapq.heappop(expected)
+        else:
+            time, ids = queue.pop_batch()
+            same = []
+            while expected and expected[0][0] == time:
+                same.append(heapq.heappop(expected)[1])
+            assert ids == same
+        now = time if rng.random() < 0.5 else now
+
+    assert queue.peek() == (expected[0] if expected else None)
+    queue.clear()
+    assert len(queue) == 0 and queue.pop() is None and queue.pop_batch() is None and queue.next_time is None
+
+def test_event_queue_batches_and_limits():
+    queue = EventQueue()
+    for i in range(1000):
+        queue.push(7, i)
+    queue.push(-2 ** 63, 2 ** 63 - 1)
+    queue.push(2 ** 63 - 1, -1)
+    assert queue.pop() == (-2 ** 63, 2 ** 63 - 1)
+    assert queue.pop_batch() == (7, list(range(1000)))
+    assert queue.pop_batch() == (2 ** 63 - 1, [-1])
+    with pytest.raises(OverflowError):
+        queue.push(2 ** 63, 0)
+    with pytest.raises(TypeError, match="no arguments"):
+        EventQueue(1)
@@ -0,0 +1,173 @@
+# tests/test_modules.py
+
+import ctypes
+import gc
+import sys
+import tracemalloc
+
+import pytest
+import pydatastructs.linked_list as linked_list_module
+from pydatastructs.deque import Deque
+from pydatastructs.dllist import DoublyLinkedList
+from pydatastructs.int_array import IntArray
+from pydatastructs.linked_list import LinkedList
+from pydatastructs.min_heap import ExternalMinHeap, MinHeap, MinMaxHeap
+from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack
+from pydatastructs.ws_deque import WorkStealingDeque
+
+TYPES = [Deque, DoublyLinkedList, ExternalMinHeap, IntArray, LinkedList, MinHeap, MinMaxHeap,
+         MonotonicIncreasingStack, WorkStealingDeque]
+# WorkStealingDeque has no stats(): plain counters would race on its lock-free paths. ExternalMinHeap
+# has none either; its buffer's counters would miss the values removed from its runs
+STATS_TYPES = [cls for cls in TYPES if cls not in (ExternalMinHeap, WorkStealingDeque)]
+
+STATS_ENABLED = sys.modules[MinHeap.__module__].STATS_ENABLED
+ABI3 = ".abi3." in sys.modules[MinHeap.__module__].__file__
+
+def fill(container, count):
+    add = getattr(container, next(m for m in ("append", "insert", "prepend", "push") if hasattr(container, m)))
+    for value in range(count):
+        add(value)
+    return container
+
+@pytest.mark.parametrize("cls", TYPES)
+def test_types_are_immutable(cls):
+    with pytest.raises(TypeError):
+        cls.extra = 1
+
+# Deque takes an iterable and maxlen=, MinHeap key= and reverse=, MinMaxHeap maxlen=, ExternalMinHeap
+# memory_limit= and directory=; see their tests
+@pytest.mark.parametrize("cls", [cls for cls in TYPES if cls not in (Deque, ExternalMinHeap, MinHeap, MinMaxHeap)])
+def test_constructors_take_no_arguments(cls):
+    with pytest.raises(TypeError, match=r"takes no arguments"):
+        cls(1)
+    with pytest.raises(TypeError, match=r"takes no arguments"):
+        cls(size=1)
+
+@pytest.mark.skipif(sys.version_info < (3, 12), reason="isolated subinterpreters need Python 3.12")
+def test_import_in_isolated_subinterpreter():
+    try:
+        import _interpreters as interpreters
+    except ImportError:
+        interpreters = pytest.importorskip("_xxsubinterpreters")
+
+    interp = interpreters.create()
+    try:
+        failure = interpreters.run_string(interp, "\n".join([
+            "from pydatastructs.aio import PriorityQueue, TimerHeap",
+            "from pydatastructs.deque import Deque",
+            "from pydatastructs.dllist import DoublyLinkedList",
+            "from pydatastructs.graph import CSRGraph",
+            "from pydatastructs.int_array import IntArray",
+            "from pydatastructs.linked_list import LinkedList",
+            "from pydatastructs.merge import Merger, merge_sorted",
+            "from pydatastructs.min_heap import EventQueue, ExternalMinHeap, MinHeap, MinMaxHeap",
+            "from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack",
+            "from pydatastructs.sliding_median import SlidingMedian",
+            "from pydatastructs.ws_deque import WorkStealingDeque",
+            "assert MinHeap.heapify([3, 1, 2]).peek() == 1",
+        ]))
+    finally:
+        interpreters.destroy(interp)
+    assert failure is None
+
+@pytest.mark.skipif(STATS_ENABLED, reason="stats are compiled in")
+@pytest.mark.parametrize("cls", STATS_TYPES)
+def test_stats_need_a_stats_build(cls):
+    with pytest.raises(RuntimeError, match=r"PYDATASTRUCTS_STATS=1"):
+        cls().stats()
+    with pytest.raises(RuntimeError, match=r"PYDATASTRUCTS_STATS=1"):
+        cls().reset_stats()
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+@pytest.mark.parametrize("cls", STATS_TYPES)
+def test_stats_reset(cls):
+    container = fill(cls(), 10)
+
+    stats = container.stats()
+    assert stats["ops"] == 10
+    assert stats["high_water"] == 10
+    assert sum(stats["latency_ns"].values()) == 10
+
+    container.reset_stats()
+    stats = container.stats()
+    assert stats["ops"] == 0
+    assert stats["latency_ns"] == {}
+    assert stats["high_water"] == 10
+
+@pytest.mark.parametrize("cls", TYPES)
+def test_sizeof_counts_native_memory(cls):
+    empty = sys.getsizeof(cls())
+    assert sys.getsizeof(fill(cls(), 1000)) >= empty + 4 * 1000
+
+@pytest.mark.skipif(ABI3, reason="the abi3 build does not report to tracemalloc")
+def test_native_blocks_are_traced():
+    tracemalloc.start()
+    try:
+        ll = fill(LinkedList(), 1000)
+        snapshot = tracemalloc.take_snapshot().filter_traces(
+            [tracemalloc.DomainFilter(True, linked_list_module.TRACEMALLOC_DOMAIN)])
+    finally:
+        tracemalloc.stop()
+    traced = sum(stat.size for stat in snapshot.statistics("filename"))
+    assert traced >= sys.getsizeof(ll) - sys.getsizeof(LinkedList()) >= 4 * 1000
+
+def test_set_allocator_needs_no_live_blocks():
+    gc.collect()
+    ll = fill(LinkedList(), 3)
+    with pytest.raises(RuntimeError, match=r"native blocks are live"):
+        linked_list_module.set_allocator(None)
+    del ll
+    with pytest.raises(TypeError):
+        linked_list_module.set_allocator(1)
+
+def test_set_allocator_capsule():
+    libc = ctypes.CDLL(None)
+    libc.malloc.restype = libc.calloc.restype = libc.realloc.restype = ctypes.c_void_p
+    libc.malloc.argtypes = [ctypes.c_size_t]
+    libc.calloc.argtypes = [ctypes.c_size_t, ctypes.c_size_t]
+    libc.realloc.argtypes = [ctypes.c_void_p, ctypes.c_size_t]
+    libc.free.argtypes = [ctypes.c_void_p]
+    calls = []
+
+    malloc = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_void_p, ctypes.c_size_t)
+    calloc = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_void_p, ctypes.c_size_t, ctypes.c_size_t)
+    realloc = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_size_t)
+    free = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p)
+
+    class Allocator(ctypes.Structure):
+        _fields_ = [("ctx", ctypes.c_void_p), ("malloc", malloc), ("calloc", calloc),
+                    ("realloc", realloc), ("free", free)]
+
+    allocator = Allocator(
+        None,
+        malloc(lambda ctx, size: calls.append("malloc") or libc.malloc(size)),
+        calloc(lambda ctx, count, size: calls.append("calloc") or libc.calloc(count, size)),
+        realloc(lambda ctx, ptr, size: calls.append("realloc") or libc.realloc(ptr, size)),
+        free(lambda ctx, ptr: calls.append("free") or libc.free(ptr)),
+    )
+    capsule_new = ctypes.pythonapi.PyCapsule_New
+    capsule_new.restype = ctypes.py_object
+    capsule_new.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_void_p]
+    name = b"pydatastructs.allocator"
+    capsule = capsule_new(ctypes.addressof(allocator), name, None)
+
+    gc.collect()
+    linked_list_module.set_allocator(capsule)
+    try:
+        ll = fill(LinkedList(), 3)
+        assert ll.to_list() == [2, 1, 0]
+        del ll
+    finally:
+        linked_list_module.set_allocator(None)
+    assert calls.count("calloc") + calls.count("malloc") == calls.count("free") == 4
+    assert linked_list_module.allocated_blocks() == 0
+
+@pytest.mark.skipif(ABI3 and sys.version_info < (3, 13), reason="needs PyMem_RawMalloc from the stable ABI")
+def test_set_allocator_pymem():
+    gc.collect()
+    linked_list_module.set_allocator("pymem")
+    try:
+        assert fill(LinkedList(), 3).to_list() == [2, 1, 0]
+    finally:
+        linked_list_module.set_allocator(None)
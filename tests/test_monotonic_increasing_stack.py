@@ -1,5 +1,10 @@
+import io
+import pickle
+import weakref
+from array import array
+
 import pytest
-from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack
+from pydatastructs.monotonic_increasing_stack import MonotonicIncreasingStack, ObjectMonotonicIncreasingStack, STATS_ENABLED
 
 def test_push_single():
     stack = MonotonicIncreasingStack()
@@ -83,3 +88,105 @@ def test_complex_sequence():
     stack.push(2)
     assert stack.top() == 2
     assert len(stack) == 1
+
+def test_growth_and_shrink_large():
+    stack = MonotonicIncreasingStack()
+    n = 100000
+    for v in range(n):
+        stack.push(v)
+    assert len(stack) == n
+    assert stack.top() == n - 1
+    for v in reversed(range(n // 2, n)):
+        assert stack.pop() == v
+    assert len(stack) == n // 2
+    stack.push(-1)
+    assert len(stack) == 1
+    assert stack.top() == -1
+
+def test_to_list_bottom_to_top():
+    stack = MonotonicIncreasingStack()
+    for value in (1, 5, 3, 4):
+        stack.push(value)
+    assert stack.to_list() == [1, 3, 4]
+    assert stack.to_list(as_array=True) == array("i", [1, 3, 4])
+
+def test_pickle_roundtrip():
+    stack = MonotonicIncreasingStack()
+    for v in [1, 4, 4, 9]:
+        stack.push(v)
+    restored = pickle.loads(pickle.dumps(stack, 5))
+    assert len(restored) == 4
+    assert [restored.pop() for _ in range(4)] == [9, 4, 4, 1]
+
+def test_dump_load():
+    stack = MonotonicIncreasingStack()
+    for v in range(70000):
+        stack.push(v)
+    stream = io.BytesIO()
+    stack.dump(stream)
+    stream.seek(0)
+    restored = MonotonicIncreasingStack.load(stream)
+    assert restored.tobytes() == stack.tobytes()
+    assert restored.top() == 69999
+
+def attach_stack(buffer, **kwargs):
+    try:
+        return MonotonicIncreasingStack.attach(buffer, **kwargs)
+    except NotImplementedError:
+        pytest.skip("shared stacks are not supported by this build")
+
+def test_attach_shares_stack():
+    buf = bytearray(4096)
+    stack = attach_stack(buf, create=True)
+    other = attach_stack(buf)
+    for v in [1, 5, 3, 4]:
+        stack.push(v)
+    assert other.top() == 4
+    assert len(other) == 3
+    other.push(2)
+    assert stack.tobytes() == MonotonicIncreasingStack.frombytes(other.tobytes()).tobytes()
+    assert [stack.pop() for _ in range(2)] == [2, 1]
+    assert stack.pop() is None
+
+def test_attach_full_raises():
+    stack = attach_stack(bytearray(512), create=True)
+    with pytest.raises(MemoryError):
+        for v in range(1000):
+            stack.push(v)
+    assert stack.top() == len(stack) - 1
+
+@pytest.mark.skipif(not STATS_ENABLED, reason="needs a PYDATASTRUCTS_STATS=1 build")
+def test_stats_record_pop_cascades():
+    stack = MonotonicIncreasingStack()
+    for value in [1, 2, 3, 4, 0, 5]:
+        stack.push(value)
+
+    # Five pushes pop nothing, and pushing 0 pops four values (bucket 4..7)
+    assert stack.stats()["cascade"] == {0: 5, 4: 1}
+    assert stack.stats()["high_water"] == 4
+
+def test_object_stack_pops_greater_items():
+    stack = ObjectMonotonicIncreasingStack(["d", "b", "c", "b", "e"])
+    assert stack.to_list() == ["b", "b", "e"]
+    stack.push("a")
+    assert stack.top() == "a"
+    assert pickle.loads(pickle.dumps(stack)).to_list() == ["a"]
+    assert stack.pop() == "a"
+    assert stack.pop() is None
+
+def test_object_stack_releases_popped_items():
+    class Item:
+        def __init__(self, key):
+            self.key = key
+
+        def __lt__(self, other):
+            return self.key < other.key
+
+    stack = ObjectMonotonicIncreasingStack()
+    first = Item(5)
+    ref = weakref.ref(first)
+    stack.push(first)
+    del first
+    stack.push(Item(1))
+    assert ref() is None
+    assert len(stack) == 1
@@ -0,0 +1,60 @@
+# tests/test_sliding_median.py
+
+import math
+import random
+from array import array
+
+import pytest
+from pydatastructs.sliding_median import SlidingMedian
+
+def quantile(window, q):
+    ordered = sorted(window)
+    rank = q * (len(ordered) - 1)
+    low = math.floor(rank)
+    if low + 1 == len(ordered):
+        return float(ordered[low])
+    return ordered[low] + (ordered[low + 1] - ordered[low]) * (rank - low)
+
+@pytest.mark.parametrize("window", [1, 2, 5, 64])
+@pytest.mark.parametrize("q", [0.0, 0.1, 0.5, 0.9, 1.0])
+def test_matches_sorted_window(window, q):
+    rng = random.Random(window)
+    values = [rng.randrange(-50, 50) for _ in range(500)] + [2 ** 31 - 1, -(2 ** 31)] * 3
+    median = SlidingMedian(window, quantile=q)
+    results = median.update(array("i", values))
+    assert results.typecode == "d" and len(results) == len(values)
+    for i, result in enumerate(results):
+        assert result == pytest.approx(quantile(values[max(0, i + 1 - window):i + 1], q))
+    assert len(median) == window and median.value == results[-1]
+
+def test_push_update_and_out_agree():
+    values = [7, 3, 9, 1, 4, 4, 8]
+    pushed = SlidingMedian(4)
+    expected = [pushed.push(v) for v in values]
+    assert expected == [7.0, 5.0, 7.0, 5.0, 3.5, 4.0, 4.0]
+
+    assert SlidingMedian(4).update(values).tolist() == expected
+    out = array("d", [0.0] * 10)
+    chunked = SlidingMedian(4)
+    assert chunked.update(array("i", values[:3]), out) == 3
+    assert chunked.update(values[3:], memoryview(out)[3:]) == 4
+    assert out.tolist()[:7] == expected
+
+    chunked.clear()
+    assert len(chunked) == 0 and chunked.value is None
+    assert chunked.push(2) == 2.0
+
+def test_arguments_are_checked():
+    with pytest.raises(ValueError, match="window"):
+        SlidingMedian(0)
+    with pytest.raises(ValueError, match="quantile"):
+        SlidingMedian(3, quantile=1.5)
+    median = SlidingMedian(3)
+    assert (median.window, median.quantile) == (3, 0.5)
+    with pytest.raises(ValueError, match="out holds 1 values"):
+        median.update([1, 2], array("d", [0.0]))
+    with pytest.raises(TypeError, match="float64"):
+        median.update([1, 2], array("f", [0.0, 0.0]))
+    with pytest.raises(OverflowError):
+        median.push(2 ** 31)
+    assert len(median) == 0
@@ -0,0 +1,79 @@
+# tests/test_ws_deque.py
+
+import sys
+import threading
+
+import pytest
+from pydatastructs.ws_deque import WorkStealingDeque
+
+def test_owner_pops_newest_thieves_steal_oldest():
+    dq = WorkStealingDeque()
+    for v in range(5):
+        dq.push(v)
+    assert len(dq) == 5
+    assert dq.pop() == 4
+    assert dq.steal() == 0
+    assert [dq.pop(), dq.steal(), dq.pop()] == [3, 1, 2]
+    assert dq.pop() is None
+    assert dq.steal() is None
+    assert len(dq) == 0
+
+def test_growth_keeps_values():
+    dq = WorkStealingDeque()
+    for v in range(100):
+        dq.push(v)
+    for v in range(40):
+        assert dq.steal() == v
+    # Wraps around the ring and grows again
+    for v in range(100, 1000):
+        dq.push(v)
+    assert sys.getsizeof(dq) >= 4 * 960
+    assert [dq.steal() for _ in range(960)] == list(range(40, 1000))
+
+def test_push_and_pop_need_the_owner_thread():
+    dq = WorkStealingDeque()
+    dq.push(1)
+    errors, stolen = [], []
+
+    def thief():
+        for method, args in ((dq.push, (2,)), (dq.pop, ())):
+            try:
+                method(*args)
+            except RuntimeError as e:
+                errors.append(str(e))
+        stolen.append(dq.steal())
+
+    t = threading.Thread(target=thief)
+    t.start()
+    t.join()
+    assert len(errors) == 2 and "push()" in errors[0] and "pop()" in errors[1]
+    assert stolen == [1]
+
+def test_every_value_is_taken_once():
+    dq = WorkStealingDeque()
+    count = 20000
+    taken = [[] for _ in range(4)]
+    done = threading.Event()
+
+    def thief(out):
+        while not done.is_set() or len(dq):
+            value = dq.steal()
+            if value is not None:
+                out.append(value)
+
+    threads = [threading.Thread(target=thief, args=(taken[i],)) for i in range(3)]
+    for t in threads:
+        t.start()
+    for v in range(count):
+        dq.push(v)
+        if v % 3 == 0:
+            value = dq.pop()
+            if value is not None:
+                taken[3].append(value)
+    done.set()
+    for t in threads:
+        t.join()
+
+    values = [v for out in taken for v in out]
+    assert len(values) == count
+    assert sorted(values) == list(range(count))